@@ -0,0 +1,86 @@
+#include "stdafx.h"
+#include "NToOneSequencedThroughputTest.h"
+
+#include "Disruptor/BusySpinWaitStrategy.h"
+#include "Disruptor/RoundRobinThreadAffinedTaskScheduler.h"
+
+#include "Disruptor.TestTools/ScopeExitFunctor.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    NToOneSequencedThroughputTest::NToOneSequencedThroughputTest(std::int32_t numPublishers, ProducerType producerType)
+        : m_numPublishers(numPublishers)
+    {
+        m_cyclicBarrier = std::make_shared< Tests::CountdownEvent >(m_numPublishers + 1);
+        m_ringBuffer = RingBuffer< ValueEvent >::create(producerType, ValueEvent::eventFactory(), m_bufferSize, std::make_shared< BusySpinWaitStrategy >());
+        m_scheduler = std::make_shared< RoundRobinThreadAffinedTaskScheduler >();
+        m_handler = std::make_shared< ValueAdditionEventHandler >();
+        m_batchEventProcessor = std::make_shared< BatchEventProcessor< ValueEvent > >(m_ringBuffer, m_ringBuffer->newBarrier(), m_handler);
+        m_ringBuffer->addGatingSequences({ m_batchEventProcessor->sequence() });
+    }
+
+    std::int64_t NToOneSequencedThroughputTest::run(Stopwatch& stopwatch)
+    {
+        m_scheduler->start(requiredProcessorCount());
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_scheduler->stop(); });
+
+        auto iterationsPerPublisher = m_iterations / m_numPublishers;
+
+        m_cyclicBarrier->reset();
+        auto latch = std::make_shared< Tests::ManualResetEvent >(false);
+        m_handler->reset(latch, m_batchEventProcessor->sequence()->value() + iterationsPerPublisher * m_numPublishers);
+
+        std::vector< std::future< void > > futures(m_numPublishers);
+        for (auto i = 0; i < m_numPublishers; ++i)
+        {
+            futures[i] = m_scheduler->scheduleAndStart(std::packaged_task< void() >([this, iterationsPerPublisher] { valuePublisher(m_cyclicBarrier, m_ringBuffer, iterationsPerPublisher); }));
+        }
+        auto processorTask = m_scheduler->scheduleAndStart(std::packaged_task< void() >([this] { m_batchEventProcessor->run(); }));
+
+        stopwatch.start();
+        m_cyclicBarrier->signal();
+        m_cyclicBarrier->wait();
+
+        for (auto i = 0; i < m_numPublishers; ++i)
+        {
+            futures[i].wait();
+        }
+
+        latch->waitOne();
+
+        stopwatch.stop();
+        m_batchEventProcessor->halt();
+        processorTask.wait_for(std::chrono::milliseconds(2000));
+
+        return iterationsPerPublisher * m_numPublishers;
+    }
+
+    std::int32_t NToOneSequencedThroughputTest::requiredProcessorCount() const
+    {
+        return m_numPublishers + 1;
+    }
+
+    void NToOneSequencedThroughputTest::valuePublisher(const std::shared_ptr< Tests::CountdownEvent >& countdownEvent,
+                                                       const std::shared_ptr< RingBuffer< ValueEvent > >& ringBuffer,
+                                                       std::int64_t iterations)
+    {
+        auto& rb = *ringBuffer;
+
+        countdownEvent->signal();
+        countdownEvent->wait();
+
+        for (std::int64_t i = 0; i < iterations; ++i)
+        {
+            auto sequence = rb.next();
+            auto& eventData = rb[sequence];
+            eventData.value = i;
+            rb.publish(sequence);
+        }
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/ProducerType.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "Disruptor.TestTools/CountdownEvent.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/ValueAdditionEventHandler.h"
+#include "Disruptor.PerfTests/ValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * Sequence a series of events from N publishers going to one event processor, to compare how the multi producer claim strategies scale with the number of publishers.
+     * 
+     * +----+
+     * | P1 |------+
+     * +----+      |
+     *   ..        v
+     * +----+    +-----+
+     * | PN |--->| EP1 |
+     * +----+    +-----+
+     * 
+     * P1  - Publisher 1
+     * PN  - Publisher N
+     * EP1 - EventProcessor 1
+     * 
+     */
+    class NToOneSequencedThroughputTest : public IThroughputTest
+    {
+    public:
+        NToOneSequencedThroughputTest(std::int32_t numPublishers, ProducerType producerType);
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        static void valuePublisher(const std::shared_ptr< Tests::CountdownEvent >& countdownEvent,
+                                   const std::shared_ptr< RingBuffer< ValueEvent > >& ringBuffer,
+                                   std::int64_t iterations);
+
+        const std::int32_t m_numPublishers;
+        const std::int32_t m_bufferSize = 1024 * 64;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 2L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 20L;
+#endif
+
+        std::shared_ptr< Tests::CountdownEvent > m_cyclicBarrier;
+        std::shared_ptr< RingBuffer< ValueEvent > > m_ringBuffer;
+        std::shared_ptr< ITaskScheduler > m_scheduler;
+        std::shared_ptr< ValueAdditionEventHandler > m_handler;
+        std::shared_ptr< BatchEventProcessor< ValueEvent > > m_batchEventProcessor;
+    };
+
+
+    /**
+     * N to 1 throughput test using MultiProducerSequencer (compare-and-set claim)
+     */
+    template <std::int32_t TNumPublishers>
+    class NToOneSequencedCompareAndSetThroughputTest : public NToOneSequencedThroughputTest
+    {
+    public:
+        NToOneSequencedCompareAndSetThroughputTest()
+            : NToOneSequencedThroughputTest(TNumPublishers, ProducerType::Multi)
+        {
+        }
+    };
+
+
+    /**
+     * N to 1 throughput test using FetchAndAddMultiProducerSequencer (fetch-and-add claim)
+     */
+    template <std::int32_t TNumPublishers>
+    class NToOneSequencedFetchAndAddThroughputTest : public NToOneSequencedThroughputTest
+    {
+    public:
+        NToOneSequencedFetchAndAddThroughputTest()
+            : NToOneSequencedThroughputTest(TNumPublishers, ProducerType::MultiFetchAndAdd)
+        {
+        }
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,82 @@
+#include "stdafx.h"
+#include "OneToNSequencedThroughputTest.h"
+
+#include "Disruptor/BasicExecutor.h"
+#include "Disruptor/RoundRobinThreadAffinedTaskScheduler.h"
+#include "Disruptor/YieldingWaitStrategy.h"
+
+#include "Disruptor.TestTools/ScopeExitFunctor.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    OneToNSequencedThroughputTest::OneToNSequencedThroughputTest(std::int32_t numEventProcessors, std::int32_t gatingSequenceGroupSize)
+        : m_numEventProcessors(numEventProcessors)
+    {
+        m_taskScheduler = std::make_shared< RoundRobinThreadAffinedTaskScheduler >();
+        m_executor = std::make_shared< BasicExecutor >(m_taskScheduler);
+
+        m_ringBuffer = RingBuffer< ValueEvent >::createSingleProducer(ValueEvent::eventFactory(), m_bufferSize, std::make_shared< YieldingWaitStrategy >());
+        m_ringBuffer->setGatingSequenceGroupSize(gatingSequenceGroupSize);
+
+        auto sequenceBarrier = m_ringBuffer->newBarrier();
+
+        std::vector< std::shared_ptr< ISequence > > sequences;
+        for (auto i = 0; i < m_numEventProcessors; ++i)
+        {
+            m_handlers.push_back(std::make_shared< ValueAdditionEventHandler >());
+            m_batchEventProcessors.push_back(std::make_shared< BatchEventProcessor< ValueEvent > >(m_ringBuffer, sequenceBarrier, m_handlers[i]));
+            sequences.push_back(m_batchEventProcessors[i]->sequence());
+        }
+        m_ringBuffer->addGatingSequences(sequences);
+    }
+
+    std::int64_t OneToNSequencedThroughputTest::run(Stopwatch& stopwatch)
+    {
+        m_taskScheduler->start(requiredProcessorCount());
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_taskScheduler->stop(); });
+
+        std::vector< std::shared_ptr< Tests::ManualResetEvent > > latches;
+        std::vector< std::future< void > > processorTasks;
+        for (auto i = 0; i < m_numEventProcessors; ++i)
+        {
+            latches.push_back(std::make_shared< Tests::ManualResetEvent >(false));
+            m_handlers[i]->reset(latches[i], m_batchEventProcessors[i]->sequence()->value() + m_iterations);
+            processorTasks.push_back(m_executor->execute([this, i] { m_batchEventProcessors[i]->run(); }));
+        }
+
+        auto& rb = *m_ringBuffer;
+
+        stopwatch.start();
+
+        for (std::int64_t i = 0; i < m_iterations; ++i)
+        {
+            auto sequence = rb.next();
+            rb[sequence].value = i;
+            rb.publish(sequence);
+        }
+
+        for (auto&& latch : latches)
+            latch->waitOne();
+
+        stopwatch.stop();
+
+        for (auto&& processor : m_batchEventProcessors)
+            processor->halt();
+
+        for (auto&& task : processorTasks)
+            task.wait();
+
+        return m_numEventProcessors * m_iterations;
+    }
+
+    std::int32_t OneToNSequencedThroughputTest::requiredProcessorCount() const
+    {
+        return m_numEventProcessors + 1;
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
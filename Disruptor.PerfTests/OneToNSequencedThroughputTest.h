@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/IExecutor.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/ValueAdditionEventHandler.h"
+#include "Disruptor.PerfTests/ValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * Sequence a series of events from one publisher to N event processors, all gating the publisher, to measure how the publisher scales
+     * with the number of gating sequences.
+     *
+     *             +-----+
+     *      +----->| EP1 |
+     *      |      +-----+
+     * +----+        ..
+     * | P1 |
+     * +----+      +-----+
+     *      +----->| EPN |
+     *             +-----+
+     *
+     * P1  - Publisher 1
+     * EP1 - EventProcessor 1
+     * EPN - EventProcessor N
+     *
+     */
+    class OneToNSequencedThroughputTest : public IThroughputTest
+    {
+    public:
+        /**
+         * \param numEventProcessors number of event processors gating the publisher
+         * \param gatingSequenceGroupSize group size of the gating sequences of the ring buffer, 0 to read all of them
+         */
+        OneToNSequencedThroughputTest(std::int32_t numEventProcessors, std::int32_t gatingSequenceGroupSize);
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        const std::int32_t m_numEventProcessors;
+        const std::int32_t m_bufferSize = 1024 * 8;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 10L;
+#endif
+
+        std::shared_ptr< ITaskScheduler > m_taskScheduler;
+        std::shared_ptr< IExecutor > m_executor;
+        std::shared_ptr< RingBuffer< ValueEvent > > m_ringBuffer;
+        std::vector< std::shared_ptr< ValueAdditionEventHandler > > m_handlers;
+        std::vector< std::shared_ptr< BatchEventProcessor< ValueEvent > > > m_batchEventProcessors;
+    };
+
+
+    /**
+     * 1 to N throughput test reading all the gating sequences when the publisher reaches its cached gating sequence
+     */
+    template <std::int32_t TNumEventProcessors>
+    class OneToNSequencedThroughputTestWithAllGatingSequences : public OneToNSequencedThroughputTest
+    {
+    public:
+        OneToNSequencedThroughputTestWithAllGatingSequences()
+            : OneToNSequencedThroughputTest(TNumEventProcessors, 0)
+        {
+        }
+    };
+
+
+    /**
+     * 1 to N throughput test tracking the gating sequences by groups of 8 with a cached minimum
+     */
+    template <std::int32_t TNumEventProcessors>
+    class OneToNSequencedThroughputTestWithGroupedGatingSequences : public OneToNSequencedThroughputTest
+    {
+    public:
+        OneToNSequencedThroughputTestWithGroupedGatingSequences()
+            : OneToNSequencedThroughputTest(TNumEventProcessors, 8)
+        {
+        }
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
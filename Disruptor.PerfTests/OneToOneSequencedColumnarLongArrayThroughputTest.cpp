@@ -0,0 +1,196 @@
+#include "stdafx.h"
+#include "OneToOneSequencedColumnarLongArrayThroughputTest.h"
+
+#include <utility>
+
+#include "Disruptor/BasicExecutor.h"
+#include "Disruptor/RoundRobinThreadAffinedTaskScheduler.h"
+#include "Disruptor/YieldingWaitStrategy.h"
+
+#include "Disruptor.TestTools/ScopeExitFunctor.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+namespace
+{
+
+    template <class TEvent, std::size_t... I>
+    void setFields(TEvent& event, std::int64_t value, std::index_sequence< I... >)
+    {
+        using Expand = int[];
+        (void)Expand { 0, (event.template get< I >() = value, 0)... };
+    }
+
+} // namespace
+
+
+    void OneToOneSequencedColumnarLongArrayThroughputTest::FirstColumnAdditionHandler::reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount)
+    {
+        m_value.value = 0;
+        m_latch = latch;
+        m_count = expectedCount;
+    }
+
+    void OneToOneSequencedColumnarLongArrayThroughputTest::FirstColumnAdditionHandler::onBatch(LongColumnsEvent* first, std::size_t count, std::int64_t /*firstSequence*/)
+    {
+        auto values = first->column< 0 >();
+
+        auto sum = m_value.value;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum += values[i];
+        }
+        m_value.value = sum;
+
+        m_count -= static_cast< std::int64_t >(count);
+        if (m_count == 0)
+        {
+            if (m_latch != nullptr)
+                m_latch->set();
+        }
+    }
+
+    std::int64_t OneToOneSequencedColumnarLongArrayThroughputTest::FirstColumnAdditionHandler::value() const
+    {
+        return m_value.value;
+    }
+
+    OneToOneSequencedColumnarLongArrayThroughputTest::OneToOneSequencedColumnarLongArrayThroughputTest()
+    {
+        m_taskScheduler = std::make_shared< RoundRobinThreadAffinedTaskScheduler >();
+        m_executor = std::make_shared< BasicExecutor >(m_taskScheduler);
+
+        m_ringBuffer = LongColumns::create(ProducerType::Single, m_bufferSize, std::make_shared< YieldingWaitStrategy >());
+        auto sequenceBarrier = m_ringBuffer->newBarrier();
+        m_handler = std::make_shared< FirstColumnAdditionHandler >();
+        m_batchEventProcessor = std::make_shared< BatchEventProcessor< LongColumnsEvent > >(m_ringBuffer, sequenceBarrier, m_handler);
+        m_ringBuffer->addGatingSequences({ m_batchEventProcessor->sequence() });
+    }
+
+    std::int64_t OneToOneSequencedColumnarLongArrayThroughputTest::run(Stopwatch& stopwatch)
+    {
+        m_taskScheduler->start(requiredProcessorCount());
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_taskScheduler->stop(); });
+
+        auto latch = std::make_shared< Tests::ManualResetEvent >(false);
+        auto expectedCount = m_batchEventProcessor->sequence()->value() + m_iterations;
+        m_handler->reset(latch, m_iterations);
+        auto processorTask = m_executor->execute([this] { m_batchEventProcessor->run(); });
+
+        auto& rb = *m_ringBuffer;
+
+        stopwatch.start();
+
+        for (auto i = 0; i < m_iterations; ++i)
+        {
+            auto sequence = rb.next();
+            setFields(rb[sequence], i, std::make_index_sequence< 8 >());
+            rb.publish(sequence);
+        }
+
+        latch->waitOne();
+        stopwatch.stop();
+        PerfTestUtil::waitForEventProcessorSequence(expectedCount, m_batchEventProcessor);
+        m_batchEventProcessor->halt();
+        processorTask.wait_for(std::chrono::seconds(10));
+
+        PerfTestUtil::failIfNot(m_expectedResult, m_handler->value(),
+                                "Handler should have processed " + std::to_string(m_expectedResult) + " events, but was: " + std::to_string(m_handler->value()));
+
+        return m_iterations;
+    }
+
+    std::int32_t OneToOneSequencedColumnarLongArrayThroughputTest::requiredProcessorCount() const
+    {
+        return 2;
+    }
+
+
+    void OneToOneSequencedRowLongArrayThroughputTest::FirstFieldAdditionHandler::reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount)
+    {
+        m_value.value = 0;
+        m_latch = latch;
+        m_count = expectedCount;
+    }
+
+    void OneToOneSequencedRowLongArrayThroughputTest::FirstFieldAdditionHandler::onBatch(LongRow* first, std::size_t count, std::int64_t /*firstSequence*/)
+    {
+        auto sum = m_value.value;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum += first[i].values[0];
+        }
+        m_value.value = sum;
+
+        m_count -= static_cast< std::int64_t >(count);
+        if (m_count == 0)
+        {
+            if (m_latch != nullptr)
+                m_latch->set();
+        }
+    }
+
+    std::int64_t OneToOneSequencedRowLongArrayThroughputTest::FirstFieldAdditionHandler::value() const
+    {
+        return m_value.value;
+    }
+
+    OneToOneSequencedRowLongArrayThroughputTest::OneToOneSequencedRowLongArrayThroughputTest()
+    {
+        m_taskScheduler = std::make_shared< RoundRobinThreadAffinedTaskScheduler >();
+        m_executor = std::make_shared< BasicExecutor >(m_taskScheduler);
+
+        m_ringBuffer = RingBuffer< LongRow >::createSingleProducer([] { return LongRow(); }, m_bufferSize, std::make_shared< YieldingWaitStrategy >());
+        auto sequenceBarrier = m_ringBuffer->newBarrier();
+        m_handler = std::make_shared< FirstFieldAdditionHandler >();
+        m_batchEventProcessor = std::make_shared< BatchEventProcessor< LongRow > >(m_ringBuffer, sequenceBarrier, m_handler);
+        m_ringBuffer->addGatingSequences({ m_batchEventProcessor->sequence() });
+    }
+
+    std::int64_t OneToOneSequencedRowLongArrayThroughputTest::run(Stopwatch& stopwatch)
+    {
+        m_taskScheduler->start(requiredProcessorCount());
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_taskScheduler->stop(); });
+
+        auto latch = std::make_shared< Tests::ManualResetEvent >(false);
+        auto expectedCount = m_batchEventProcessor->sequence()->value() + m_iterations;
+        m_handler->reset(latch, m_iterations);
+        auto processorTask = m_executor->execute([this] { m_batchEventProcessor->run(); });
+
+        auto& rb = *m_ringBuffer;
+
+        stopwatch.start();
+
+        for (auto i = 0; i < m_iterations; ++i)
+        {
+            auto sequence = rb.next();
+            auto& event = rb[sequence];
+            for (auto&& value : event.values)
+            {
+                value = i;
+            }
+            rb.publish(sequence);
+        }
+
+        latch->waitOne();
+        stopwatch.stop();
+        PerfTestUtil::waitForEventProcessorSequence(expectedCount, m_batchEventProcessor);
+        m_batchEventProcessor->halt();
+        processorTask.wait_for(std::chrono::seconds(10));
+
+        PerfTestUtil::failIfNot(m_expectedResult, m_handler->value(),
+                                "Handler should have processed " + std::to_string(m_expectedResult) + " events, but was: " + std::to_string(m_handler->value()));
+
+        return m_iterations;
+    }
+
+    std::int32_t OneToOneSequencedRowLongArrayThroughputTest::requiredProcessorCount() const
+    {
+        return 2;
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/ColumnarRingBuffer.h"
+#include "Disruptor/IBatchEventHandler.h"
+#include "Disruptor/IExecutor.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/PaddedLong.h"
+#include "Disruptor.PerfTests/PerfTestUtil.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * UniCast a series of events of 8 longs between 1 publisher and 1 event processor which only reads the first long of each event,
+     * the events being stored by a ColumnarRingBuffer: one array per long.
+     * The event processor receives spans (IBatchEventHandler<T>) and sums the first column of each span in a single loop.
+     *
+     * Compare with OneToOneSequencedRowLongArrayThroughputTest, which stores the same events as structures.
+     *
+     * +----+    +-----+
+     * | P1 |--->| EP1 |
+     * +----+    +-----+
+     *
+     * P1  - Publisher 1
+     * EP1 - EventProcessor 1
+     *
+     */
+    class OneToOneSequencedColumnarLongArrayThroughputTest : public IThroughputTest
+    {
+    public:
+        using LongColumns = ColumnarRingBuffer< std::int64_t, std::int64_t, std::int64_t, std::int64_t, std::int64_t, std::int64_t, std::int64_t, std::int64_t >;
+        using LongColumnsEvent = LongColumns::EventType;
+
+        class FirstColumnAdditionHandler final : public IBatchEventHandler< LongColumnsEvent >
+        {
+        public:
+            void reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount);
+
+            void onBatch(LongColumnsEvent* first, std::size_t count, std::int64_t firstSequence) override;
+
+            std::int64_t value() const;
+
+        private:
+            PaddedLong m_value;
+            std::int64_t m_count = 0;
+            std::shared_ptr< Tests::ManualResetEvent > m_latch;
+        };
+
+        OneToOneSequencedColumnarLongArrayThroughputTest();
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        const std::int32_t m_bufferSize = 1024 * 64;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 10L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 100L;
+#endif
+
+        const std::int64_t m_expectedResult = PerfTestUtil::accumulatedAddition(m_iterations);
+
+        std::shared_ptr< ITaskScheduler > m_taskScheduler;
+        std::shared_ptr< IExecutor > m_executor;
+        std::shared_ptr< LongColumns > m_ringBuffer;
+        std::shared_ptr< FirstColumnAdditionHandler > m_handler;
+        std::shared_ptr< BatchEventProcessor< LongColumnsEvent > > m_batchEventProcessor;
+    };
+
+
+    /**
+     * UniCast a series of events of 8 longs between 1 publisher and 1 event processor which only reads the first long of each event,
+     * the events being stored as structures by a RingBuffer<T>. Baseline of OneToOneSequencedColumnarLongArrayThroughputTest.
+     *
+     * +----+    +-----+
+     * | P1 |--->| EP1 |
+     * +----+    +-----+
+     *
+     * P1  - Publisher 1
+     * EP1 - EventProcessor 1
+     *
+     */
+    class OneToOneSequencedRowLongArrayThroughputTest : public IThroughputTest
+    {
+    public:
+        struct LongRow
+        {
+            std::int64_t values[8];
+        };
+
+        class FirstFieldAdditionHandler final : public IBatchEventHandler< LongRow >
+        {
+        public:
+            void reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount);
+
+            void onBatch(LongRow* first, std::size_t count, std::int64_t firstSequence) override;
+
+            std::int64_t value() const;
+
+        private:
+            PaddedLong m_value;
+            std::int64_t m_count = 0;
+            std::shared_ptr< Tests::ManualResetEvent > m_latch;
+        };
+
+        OneToOneSequencedRowLongArrayThroughputTest();
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        const std::int32_t m_bufferSize = 1024 * 64;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 10L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 100L;
+#endif
+
+        const std::int64_t m_expectedResult = PerfTestUtil::accumulatedAddition(m_iterations);
+
+        std::shared_ptr< ITaskScheduler > m_taskScheduler;
+        std::shared_ptr< IExecutor > m_executor;
+        std::shared_ptr< RingBuffer< LongRow > > m_ringBuffer;
+        std::shared_ptr< FirstFieldAdditionHandler > m_handler;
+        std::shared_ptr< BatchEventProcessor< LongRow > > m_batchEventProcessor;
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,107 @@
+#include "stdafx.h"
+#include "OneToOneSequencedJournalingThroughputTest.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <cstdio>
+#include <stdexcept>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "Disruptor/BasicExecutor.h"
+#include "Disruptor/JournalSegment.h"
+#include "Disruptor/RoundRobinThreadAffinedTaskScheduler.h"
+#include "Disruptor/YieldingWaitStrategy.h"
+
+#include "Disruptor.TestTools/ScopeExitFunctor.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    OneToOneSequencedJournalingThroughputTest::OneToOneSequencedJournalingThroughputTest(JournalSyncPolicy syncPolicy)
+    {
+        m_taskScheduler = std::make_shared< RoundRobinThreadAffinedTaskScheduler >();
+        m_executor = std::make_shared< BasicExecutor >(m_taskScheduler);
+
+        char directory[] = "/tmp/disruptor-perf-tests-journal-XXXXXX";
+        if (mkdtemp(directory) == nullptr)
+            throw std::runtime_error("Unable to create the journal directory");
+
+        m_directory = directory;
+
+        m_latch = std::make_shared< Tests::ManualResetEvent >(false);
+        m_journalingHandler = std::make_shared< JournalingEventHandler< ValueEvent > >(m_directory, 64 * 1024 * 1024, syncPolicy);
+        m_eventHandler = std::make_shared< ValueAdditionEventHandler >();
+        m_ringBuffer = RingBuffer< ValueEvent >::createSingleProducer(ValueEvent::eventFactory(), m_bufferSize, std::make_shared< YieldingWaitStrategy >());
+
+        m_journalingProcessor = std::make_shared< BatchEventProcessor< ValueEvent > >(m_ringBuffer, m_ringBuffer->newBarrier(), m_journalingHandler);
+        auto sequenceBarrier = m_ringBuffer->newBarrier({ m_journalingProcessor->sequence() });
+        m_batchEventProcessor = std::make_shared< BatchEventProcessor< ValueEvent > >(m_ringBuffer, sequenceBarrier, m_eventHandler);
+        m_ringBuffer->addGatingSequences({ m_batchEventProcessor->sequence() });
+    }
+
+    OneToOneSequencedJournalingThroughputTest::~OneToOneSequencedJournalingThroughputTest()
+    {
+        removeSegments();
+        rmdir(m_directory.c_str());
+    }
+
+    std::int64_t OneToOneSequencedJournalingThroughputTest::run(Stopwatch& stopwatch)
+    {
+        m_taskScheduler->start(requiredProcessorCount());
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_taskScheduler->stop(); });
+
+        auto expectedCount = m_batchEventProcessor->sequence()->value() + m_iterations;
+
+        m_latch->reset();
+        m_eventHandler->reset(m_latch, expectedCount);
+
+        auto journalingTask = m_executor->execute([this] { m_journalingProcessor->run(); });
+        auto processorTask = m_executor->execute([this] { m_batchEventProcessor->run(); });
+        stopwatch.start();
+
+        auto&& rb = *m_ringBuffer;
+
+        for (auto i = 0; i < m_iterations; ++i)
+        {
+            auto sequence = rb.next();
+            rb[sequence].value = i;
+            rb.publish(sequence);
+        }
+
+        m_latch->waitOne();
+        stopwatch.stop();
+        PerfTestUtil::waitForEventProcessorSequence(expectedCount, m_batchEventProcessor);
+        m_journalingProcessor->halt();
+        m_batchEventProcessor->halt();
+        journalingTask.wait_for(std::chrono::seconds(10));
+        processorTask.wait_for(std::chrono::seconds(10));
+
+        // Each run journals to new segments
+        removeSegments();
+
+        PerfTestUtil::failIfNot(m_expectedResult, m_eventHandler->value(),
+                                "Handler should have processed " + std::to_string(m_expectedResult) + " events, but was: " + std::to_string(m_eventHandler->value()));
+
+        return m_iterations;
+    }
+
+    std::int32_t OneToOneSequencedJournalingThroughputTest::requiredProcessorCount() const
+    {
+        return 3;
+    }
+
+    void OneToOneSequencedJournalingThroughputTest::removeSegments()
+    {
+        for (auto index : JournalSegment::list(m_directory))
+            std::remove(JournalSegment::path(m_directory, index).c_str());
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <string>
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/IExecutor.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/JournalingEventHandler.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/PerfTestUtil.h"
+#include "Disruptor.PerfTests/ValueAdditionEventHandler.h"
+#include "Disruptor.PerfTests/ValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * Journal a series of items to memory-mapped segment files under /tmp before an event processor sees them.
+     *
+     * +----+    +----+    +-----+
+     * | P1 |--->| J1 |--->| EP1 |
+     * +----+    +----+    +-----+
+     *
+     * P1  - Publisher 1
+     * J1  - EventProcessor 1, running a JournalingEventHandler
+     * EP1 - EventProcessor 2, gated on J1
+     *
+     */
+    class OneToOneSequencedJournalingThroughputTest : public IThroughputTest
+    {
+    public:
+        explicit OneToOneSequencedJournalingThroughputTest(JournalSyncPolicy syncPolicy);
+
+        ~OneToOneSequencedJournalingThroughputTest() override;
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        void removeSegments();
+
+        const std::int32_t m_bufferSize = 1024 * 64;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 10L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 10L;
+#endif
+
+        std::string m_directory;
+        std::shared_ptr< RingBuffer< ValueEvent > > m_ringBuffer;
+        std::shared_ptr< JournalingEventHandler< ValueEvent > > m_journalingHandler;
+        std::shared_ptr< ValueAdditionEventHandler > m_eventHandler;
+        std::shared_ptr< Tests::ManualResetEvent > m_latch;
+        const std::int64_t m_expectedResult = PerfTestUtil::accumulatedAddition(m_iterations);
+        std::shared_ptr< BatchEventProcessor< ValueEvent > > m_journalingProcessor;
+        std::shared_ptr< BatchEventProcessor< ValueEvent > > m_batchEventProcessor;
+        std::shared_ptr< IExecutor > m_executor;
+        std::shared_ptr< ITaskScheduler > m_taskScheduler;
+    };
+
+
+    /**
+     * Records left to the write-back of the kernel.
+     */
+    class OneToOneSequencedJournalingNoSyncThroughputTest : public OneToOneSequencedJournalingThroughputTest
+    {
+    public:
+        OneToOneSequencedJournalingNoSyncThroughputTest()
+            : OneToOneSequencedJournalingThroughputTest(JournalSyncPolicy::None)
+        {
+        }
+    };
+
+
+    /**
+     * Records synced at most every 10 ms.
+     */
+    class OneToOneSequencedJournalingPeriodicSyncThroughputTest : public OneToOneSequencedJournalingThroughputTest
+    {
+    public:
+        OneToOneSequencedJournalingPeriodicSyncThroughputTest()
+            : OneToOneSequencedJournalingThroughputTest(JournalSyncPolicy::Periodic)
+        {
+        }
+    };
+
+
+    /**
+     * Records synced at the end of each batch, before EP1 sees them.
+     */
+    class OneToOneSequencedJournalingEndOfBatchSyncThroughputTest : public OneToOneSequencedJournalingThroughputTest
+    {
+    public:
+        OneToOneSequencedJournalingEndOfBatchSyncThroughputTest()
+            : OneToOneSequencedJournalingThroughputTest(JournalSyncPolicy::EndOfBatch)
+        {
+        }
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/IExecutor.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/MemoryPlacement.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/PaddedValueAdditionEventHandler.h"
+#include "Disruptor.PerfTests/PaddedValueEvent.h"
+#include "Disruptor.PerfTests/PerfTestUtil.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * UniCast a series of items between 1 publisher and 1 event processor, through a ring buffer of 2^20 events of 128 bytes,
+     * much larger than the caches and than the reach of the TLB with small pages.
+     *
+     * +----+    +-----+
+     * | P1 |--->| EP1 |
+     * +----+    +-----+
+     *
+     * P1  - Publisher 1
+     * EP1 - EventProcessor 1
+     *
+     */
+    class OneToOneSequencedLargeRingThroughputTest : public IThroughputTest
+    {
+    public:
+        explicit OneToOneSequencedLargeRingThroughputTest(const MemoryPlacement& placement);
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        const std::int32_t m_bufferSize = 1024 * 1024;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 10L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 100L;
+#endif
+
+        std::shared_ptr< RingBuffer< PaddedValueEvent > > m_ringBuffer;
+        std::shared_ptr< PaddedValueAdditionEventHandler > m_eventHandler;
+        std::shared_ptr< Tests::ManualResetEvent > m_latch;
+        const std::int64_t m_expectedResult = PerfTestUtil::accumulatedAddition(m_iterations);
+        std::shared_ptr< BatchEventProcessor< PaddedValueEvent > > m_batchEventProcessor;
+        std::shared_ptr< IExecutor > m_executor;
+        std::shared_ptr< ITaskScheduler > m_taskScheduler;
+    };
+
+
+    /**
+     * Events on the heap, in pages of the operating system.
+     */
+    class OneToOneSequencedLargeRingSmallPagesThroughputTest : public OneToOneSequencedLargeRingThroughputTest
+    {
+    public:
+        OneToOneSequencedLargeRingSmallPagesThroughputTest()
+            : OneToOneSequencedLargeRingThroughputTest(MemoryPlacement())
+        {
+        }
+    };
+
+
+    /**
+     * Events in 2 MB huge pages, faulted in when the ring buffer is created.
+     */
+    class OneToOneSequencedLargeRingHugePagesThroughputTest : public OneToOneSequencedLargeRingThroughputTest
+    {
+    public:
+        OneToOneSequencedLargeRingHugePagesThroughputTest()
+            : OneToOneSequencedLargeRingThroughputTest(MemoryPlacement().withHugePages())
+        {
+        }
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,114 @@
+#include "stdafx.h"
+#include "OneToOneSequencedNumaThroughputTest.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "Disruptor/BasicExecutor.h"
+#include "Disruptor/CpuTopology.h"
+#include "Disruptor/MemoryPlacement.h"
+#include "Disruptor/ThreadHelper.h"
+#include "Disruptor/TopologyAwareTaskScheduler.h"
+#include "Disruptor/YieldingWaitStrategy.h"
+
+#include "Disruptor.TestTools/ScopeExitFunctor.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    OneToOneSequencedNumaThroughputTest::OneToOneSequencedNumaThroughputTest(bool crossNode)
+    {
+        auto topology = CpuTopology::detect();
+
+        std::vector< std::int32_t > cpuIds;
+        for (auto&& cpu : topology.cpus())
+            cpuIds.push_back(cpu.id);
+
+        auto placement = topology.placementOrder(cpuIds, true);
+        m_consumerCpu = placement.front();
+        auto consumerNode = topology.find(m_consumerCpu)->node;
+
+        // Another physical core on the requested side. The same node variant falls back to a sibling, or to the CPU of the event processor, the cross
+        // node variant has no fallback: run() fails rather than measuring a same node placement
+        m_producerCpu = crossNode ? -1 : m_consumerCpu;
+        for (auto cpuId : placement)
+        {
+            auto cpu = topology.find(cpuId);
+            if (cpuId == m_consumerCpu || (cpu->node != consumerNode) != crossNode)
+                continue;
+
+            if (!topology.areSiblings(cpuId, m_consumerCpu))
+            {
+                m_producerCpu = cpuId;
+                break;
+            }
+
+            if (m_producerCpu == m_consumerCpu)
+                m_producerCpu = cpuId;
+        }
+
+        auto memoryPlacement = MemoryPlacement::isNodeBindingSupported() ? MemoryPlacement::bindToNode(consumerNode) : MemoryPlacement::firstTouchFromCpu(m_consumerCpu);
+
+        m_taskScheduler = std::make_shared< TopologyAwareTaskScheduler >(topology, std::vector< std::int32_t > { m_consumerCpu });
+        m_executor = std::make_shared< BasicExecutor >(m_taskScheduler);
+
+        m_latch = std::make_shared< Tests::ManualResetEvent >(false);
+        m_eventHandler = std::make_shared< ValueAdditionEventHandler >();
+        m_ringBuffer = RingBuffer< ValueEvent >::create(ProducerType::Single, ValueEvent::eventFactory(), m_bufferSize, std::make_shared< YieldingWaitStrategy >(), memoryPlacement);
+        auto sequenceBarrier = m_ringBuffer->newBarrier();
+        m_batchEventProcessor = std::make_shared< BatchEventProcessor< ValueEvent > >(m_ringBuffer, sequenceBarrier, m_eventHandler);
+        m_ringBuffer->addGatingSequences({ m_batchEventProcessor->sequence() });
+    }
+
+    std::int64_t OneToOneSequencedNumaThroughputTest::run(Stopwatch& stopwatch)
+    {
+        if (m_producerCpu < 0)
+            throw std::runtime_error("No CPU on another NUMA node than CPU " + std::to_string(m_consumerCpu) + ", the cross node placement cannot be measured");
+
+        m_taskScheduler->start(1);
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_taskScheduler->stop(); });
+
+        auto previousAffinity = ThreadHelper::getThreadAffinity();
+        ThreadHelper::AffinityMask producerAffinity;
+        ThreadHelper::setThreadAffinity(producerAffinity.set(m_producerCpu));
+        TestTools::ScopeExitFunctor restoreAffinity([previousAffinity] { ThreadHelper::setThreadAffinity(previousAffinity); });
+
+        auto expectedCount = m_batchEventProcessor->sequence()->value() + m_iterations;
+
+        m_latch->reset();
+        m_eventHandler->reset(m_latch, expectedCount);
+
+        auto processorTask = m_executor->execute([this] { m_batchEventProcessor->run(); });
+        stopwatch.start();
+
+        auto&& rb = *m_ringBuffer;
+
+        for (auto i = 0; i < m_iterations; ++i)
+        {
+            auto sequence = rb.next();
+            rb[sequence].value = i;
+            rb.publish(sequence);
+        }
+
+        m_latch->waitOne();
+        stopwatch.stop();
+        PerfTestUtil::waitForEventProcessorSequence(expectedCount, m_batchEventProcessor);
+        m_batchEventProcessor->halt();
+        processorTask.wait_for(std::chrono::seconds(10));
+
+        PerfTestUtil::failIfNot(m_expectedResult, m_eventHandler->value(),
+                                "Handler should have processed " + std::to_string(m_expectedResult) + " events, but was: " + std::to_string(m_eventHandler->value()));
+
+        return m_iterations;
+    }
+
+    std::int32_t OneToOneSequencedNumaThroughputTest::requiredProcessorCount() const
+    {
+        return 2;
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
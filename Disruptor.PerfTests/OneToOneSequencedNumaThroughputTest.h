@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/IExecutor.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/PerfTestUtil.h"
+#include "Disruptor.PerfTests/ValueAdditionEventHandler.h"
+#include "Disruptor.PerfTests/ValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * UniCast a series of items between 1 publisher and 1 event processor, with the memory of the ring buffer placed on the NUMA node of the event processor.
+     *
+     * +----+    +-----+
+     * | P1 |--->| EP1 |
+     * +----+    +-----+
+     *
+     * The event processor is pinned to the first CPU of the topology placement, the ring buffer is bound to its node (or first-touched from its CPU
+     * when node binding is not available). The publisher is pinned either to another core of the same node, or to a core of another node.
+     * On a single node machine, the cross node variant fails instead of running on the same node.
+     *
+     * P1  - Publisher 1
+     * EP1 - EventProcessor 1
+     *
+     */
+    class OneToOneSequencedNumaThroughputTest : public IThroughputTest
+    {
+    public:
+        explicit OneToOneSequencedNumaThroughputTest(bool crossNode);
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        const std::int32_t m_bufferSize = 1024 * 64;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 10L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 100L;
+#endif
+
+        std::int32_t m_consumerCpu;
+        std::int32_t m_producerCpu;
+
+        std::shared_ptr< RingBuffer< ValueEvent > > m_ringBuffer;
+        std::shared_ptr< ValueAdditionEventHandler > m_eventHandler;
+        std::shared_ptr< Tests::ManualResetEvent > m_latch;
+        const std::int64_t m_expectedResult = PerfTestUtil::accumulatedAddition(m_iterations);
+        std::shared_ptr< BatchEventProcessor< ValueEvent > > m_batchEventProcessor;
+        std::shared_ptr< IExecutor > m_executor;
+        std::shared_ptr< ITaskScheduler > m_taskScheduler;
+    };
+
+
+    /**
+     * Publisher and event processor on the node holding the ring buffer.
+     */
+    class OneToOneSequencedSameNodeThroughputTest : public OneToOneSequencedNumaThroughputTest
+    {
+    public:
+        OneToOneSequencedSameNodeThroughputTest()
+            : OneToOneSequencedNumaThroughputTest(false)
+        {
+        }
+    };
+
+
+    /**
+     * Publisher on another node than the event processor and the ring buffer: every claim and publication crosses the interconnect.
+     */
+    class OneToOneSequencedCrossNodeThroughputTest : public OneToOneSequencedNumaThroughputTest
+    {
+    public:
+        OneToOneSequencedCrossNodeThroughputTest()
+            : OneToOneSequencedNumaThroughputTest(true)
+        {
+        }
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,81 @@
+#include "stdafx.h"
+#include "OneToOneSequencedSharedMemoryThroughputTest.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <string>
+
+#include "Disruptor/BasicExecutor.h"
+#include "Disruptor/RoundRobinThreadAffinedTaskScheduler.h"
+#include "Disruptor/SharedMemoryRegion.h"
+
+#include "Disruptor.TestTools/ScopeExitFunctor.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    OneToOneSequencedSharedMemoryThroughputTest::OneToOneSequencedSharedMemoryThroughputTest()
+    {
+        m_taskScheduler = std::make_shared< RoundRobinThreadAffinedTaskScheduler >();
+        m_executor = std::make_shared< BasicExecutor >(m_taskScheduler);
+
+        auto name = "/disruptor-perf-tests-" + std::to_string(SharedMemoryRegion::currentProcessId());
+
+        m_latch = std::make_shared< Tests::ManualResetEvent >(false);
+        m_eventHandler = std::make_shared< ValueAdditionEventHandler >();
+        m_ringBuffer = SharedMemoryRingBuffer< ValueEvent >::create(name, ProducerType::Single, m_bufferSize);
+        m_consumerRingBuffer = SharedMemoryRingBuffer< ValueEvent >::attach(name);
+
+        // Both mappings stay valid, the object is not left behind if the test is not destroyed
+        SharedMemoryRegion::unlink(name);
+
+        auto sequenceBarrier = m_consumerRingBuffer->newBarrier();
+        m_batchEventProcessor = std::make_shared< BatchEventProcessor< ValueEvent > >(m_consumerRingBuffer, sequenceBarrier, m_eventHandler);
+    }
+
+    std::int64_t OneToOneSequencedSharedMemoryThroughputTest::run(Stopwatch& stopwatch)
+    {
+        m_taskScheduler->start(requiredProcessorCount());
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_taskScheduler->stop(); });
+
+        auto expectedCount = m_batchEventProcessor->sequence()->value() + m_iterations;
+
+        m_latch->reset();
+        m_eventHandler->reset(m_latch, expectedCount);
+
+        auto processorTask = m_executor->execute([this] { m_batchEventProcessor->run(); });
+        stopwatch.start();
+
+        auto&& rb = *m_ringBuffer;
+
+        for (auto i = 0; i < m_iterations; ++i)
+        {
+            auto sequence = rb.next();
+            rb[sequence].value = i;
+            rb.publish(sequence);
+        }
+
+        m_latch->waitOne();
+        stopwatch.stop();
+        PerfTestUtil::waitForEventProcessorSequence(expectedCount, m_batchEventProcessor);
+        m_batchEventProcessor->halt();
+        processorTask.wait_for(std::chrono::seconds(10));
+
+        PerfTestUtil::failIfNot(m_expectedResult, m_eventHandler->value(),
+                                "Handler should have processed " + std::to_string(m_expectedResult) + " events, but was: " + std::to_string(m_eventHandler->value()));
+
+        return m_iterations;
+    }
+
+    std::int32_t OneToOneSequencedSharedMemoryThroughputTest::requiredProcessorCount() const
+    {
+        return 2;
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/IExecutor.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/SharedMemoryRingBuffer.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/PerfTestUtil.h"
+#include "Disruptor.PerfTests/ValueAdditionEventHandler.h"
+#include "Disruptor.PerfTests/ValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * UniCast a series of items between 1 publisher and 1 event processor through a SharedMemoryRingBuffer<T>.
+     *
+     * The event processor reads a second mapping of the shared memory object, as a consumer process would, so the test measures the cost of the
+     * consumer slot and of the shared futex compared to the OneToOneSequencedThroughputTest.
+     *
+     * +----+    +-----+
+     * | P1 |--->| EP1 |
+     * +----+    +-----+
+     *
+     * P1  - Publisher 1
+     * EP1 - EventProcessor 1, attached to the shared memory object
+     */
+    class OneToOneSequencedSharedMemoryThroughputTest : public IThroughputTest
+    {
+    public:
+        OneToOneSequencedSharedMemoryThroughputTest();
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        const std::int32_t m_bufferSize = 1024 * 64;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 10L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 100L;
+#endif
+
+        std::shared_ptr< SharedMemoryRingBuffer< ValueEvent > > m_ringBuffer;
+        std::shared_ptr< SharedMemoryRingBuffer< ValueEvent > > m_consumerRingBuffer;
+        std::shared_ptr< ValueAdditionEventHandler > m_eventHandler;
+        std::shared_ptr< Tests::ManualResetEvent > m_latch;
+        const std::int64_t m_expectedResult = PerfTestUtil::accumulatedAddition(m_iterations);
+        std::shared_ptr< BatchEventProcessor< ValueEvent > > m_batchEventProcessor;
+        std::shared_ptr< IExecutor > m_executor;
+        std::shared_ptr< ITaskScheduler > m_taskScheduler;
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,28 @@
+#include "stdafx.h"
+#include "PaddedValueAdditionEventHandler.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    void PaddedValueAdditionEventHandler::reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount)
+    {
+        m_value.value = 0;
+        m_latch = latch;
+        m_count = expectedCount;
+    }
+
+    std::int64_t PaddedValueAdditionEventHandler::count() const
+    {
+        return m_count;
+    }
+
+    std::int64_t PaddedValueAdditionEventHandler::value() const
+    {
+        return m_value.value;
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+
+#include "Disruptor/IEventHandler.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+#include "Disruptor.PerfTests/PaddedLong.h"
+#include "Disruptor.PerfTests/PaddedValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    class PaddedValueAdditionEventHandler final : public IEventHandler< PaddedValueEvent >
+    {
+    public:
+        void reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount);
+
+        void onEvent(PaddedValueEvent& value, std::int64_t sequence, bool /*endOfBatch*/) override
+        {
+            m_value.value = m_value.value + value.value;
+
+            if (count() == sequence)
+            {
+                if (m_latch != nullptr)
+                    m_latch->set();
+            }
+        }
+
+        std::int64_t count() const;
+        std::int64_t value() const;
+
+    private:
+        PaddedLong m_value;
+        std::int64_t m_count = 0;
+        std::shared_ptr< Tests::ManualResetEvent > m_latch;
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
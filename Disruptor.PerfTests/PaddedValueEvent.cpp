@@ -0,0 +1,17 @@
+#include "stdafx.h"
+#include "PaddedValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    const std::function< PaddedValueEvent() >& PaddedValueEvent::eventFactory()
+    {
+        static std::function< PaddedValueEvent() > result([] { return PaddedValueEvent(); });
+        return result;
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
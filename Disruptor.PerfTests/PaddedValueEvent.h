@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * ValueEvent padded to 128 bytes, the size of the events of the large ring buffer tests.
+     */
+    class PaddedValueEvent
+    {
+    public:
+        static const std::function< PaddedValueEvent() >& eventFactory();
+
+        std::int64_t value = 0;
+        char padding[120];
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -8,15 +8,25 @@
 #include "OneToOneRawThroughputTest.h"
 
 // Sequenced
+#include "NToOneSequencedThroughputTest.h"
+#include "OneToNSequencedThroughputTest.h"
+#include "OneToOneSequencedBatchSpanThroughputTest.h"
 #include "OneToOneSequencedBatchThroughputTest.h"
+#include "OneToOneSequencedColumnarLongArrayThroughputTest.h"
+#include "OneToOneSequencedDevirtualizedThroughputTest.h"
+#include "OneToOneSequencedJournalingThroughputTest.h"
+#include "OneToOneSequencedLargeRingThroughputTest.h"
 #include "OneToOneSequencedLongArrayThroughputTest.h"
+#include "OneToOneSequencedNumaThroughputTest.h"
 #include "OneToOneSequencedPollerThroughputTest.h"
+#include "OneToOneSequencedSharedMemoryThroughputTest.h"
 #include "OneToOneSequencedThroughputTest.h"
 #include "OneToThreeDiamondSequencedThroughputTest.h"
 #include "OneToThreePipelineSequencedThroughputTest.h"
 #include "OneToThreeSequencedThroughputTest.h"
 #include "PingPongSequencedLatencyTest.h"
 #include "ThreeToOneSequencedBatchThroughputTest.h"
+#include "ThreeToOneShardedThroughputTest.h"
 #include "ThreeToOneSequencedThroughputTest.h"
 #include "ThreeToThreeSequencedThroughputTest.h"
 
@@ -41,9 +51,39 @@ namespace PerfTests
         registerTest< OneToOneRawThroughputTest >();
 
         // Sequenced
+        registerTest< NToOneSequencedCompareAndSetThroughputTest< 2 > >();
+        registerTest< NToOneSequencedCompareAndSetThroughputTest< 4 > >();
+        registerTest< NToOneSequencedCompareAndSetThroughputTest< 8 > >();
+        registerTest< NToOneSequencedCompareAndSetThroughputTest< 16 > >();
+        registerTest< NToOneSequencedFetchAndAddThroughputTest< 2 > >();
+        registerTest< NToOneSequencedFetchAndAddThroughputTest< 4 > >();
+        registerTest< NToOneSequencedFetchAndAddThroughputTest< 8 > >();
+        registerTest< NToOneSequencedFetchAndAddThroughputTest< 16 > >();
+        registerTest< OneToNSequencedThroughputTestWithAllGatingSequences< 8 > >();
+        registerTest< OneToNSequencedThroughputTestWithAllGatingSequences< 16 > >();
+        registerTest< OneToNSequencedThroughputTestWithAllGatingSequences< 32 > >();
+        registerTest< OneToNSequencedThroughputTestWithGroupedGatingSequences< 8 > >();
+        registerTest< OneToNSequencedThroughputTestWithGroupedGatingSequences< 16 > >();
+        registerTest< OneToNSequencedThroughputTestWithGroupedGatingSequences< 32 > >();
+        registerTest< OneToOneSequencedBatchSpanThroughputTest >();
         registerTest< OneToOneSequencedBatchThroughputTest >();
+        registerTest< OneToOneSequencedColumnarLongArrayThroughputTest >();
+        registerTest< OneToOneSequencedCrossNodeThroughputTest >();
+        registerTest< OneToOneSequencedDevirtualizedThroughputTest >();
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        registerTest< OneToOneSequencedJournalingEndOfBatchSyncThroughputTest >();
+        registerTest< OneToOneSequencedJournalingNoSyncThroughputTest >();
+        registerTest< OneToOneSequencedJournalingPeriodicSyncThroughputTest >();
+#endif
+        registerTest< OneToOneSequencedLargeRingHugePagesThroughputTest >();
+        registerTest< OneToOneSequencedLargeRingSmallPagesThroughputTest >();
         registerTest< OneToOneSequencedLongArrayThroughputTest >();
         registerTest< OneToOneSequencedPollerThroughputTest >();
+        registerTest< OneToOneSequencedRowLongArrayThroughputTest >();
+        registerTest< OneToOneSequencedSameNodeThroughputTest >();
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        registerTest< OneToOneSequencedSharedMemoryThroughputTest >();
+#endif
         registerTest< OneToOneSequencedThroughputTest >();
         registerTest< OneToThreeDiamondSequencedThroughputTest >();
         registerTest< OneToThreePipelineSequencedThroughputTest >();
@@ -51,6 +91,7 @@ namespace PerfTests
         registerTest< PingPongSequencedLatencyTest >();
         registerTest< ThreeToOneSequencedBatchThroughputTest >();
         registerTest< ThreeToOneSequencedThroughputTest >();
+        registerTest< ThreeToOneShardedThroughputTest >();
         registerTest< ThreeToThreeSequencedThroughputTest >();
 
         // Translator
@@ -0,0 +1,77 @@
+#include "stdafx.h"
+#include "ThreeToOneShardedThroughputTest.h"
+
+#include "Disruptor.TestTools/ScopeExitFunctor.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    ThreeToOneShardedThroughputTest::ThreeToOneShardedThroughputTest()
+    {
+        m_eventProcessor = std::make_shared< ShardedEventProcessor< ValueEvent, ValueAdditionEventHandler > >(m_ringBuffer, m_handler);
+        m_ringBuffer->addGatingSequences(m_eventProcessor->shardSequences());
+    }
+
+    std::int64_t ThreeToOneShardedThroughputTest::run(Stopwatch& stopwatch)
+    {
+        m_scheduler->start(5);
+        TestTools::ScopeExitFunctor atScopeExit([this] { m_scheduler->stop(); });
+
+        m_cyclicBarrier->reset();
+        auto latch = std::make_shared< Tests::ManualResetEvent >(false);
+        m_handler->reset(latch, m_eventProcessor->sequence()->value() + ((m_iterations / m_numPublishers) * m_numPublishers));
+
+        std::vector< std::future< void > > futures(m_numPublishers);
+        for (auto i = 0; i < m_numPublishers; ++i)
+        {
+            auto shard = m_ringBuffer->shard(i);
+            futures[i] = m_scheduler->scheduleAndStart(std::packaged_task< void() >([this, shard] { valuePublisher(m_cyclicBarrier, shard, m_iterations); }));
+        }
+        auto processorTask = m_scheduler->scheduleAndStart(std::packaged_task< void() >([this] { m_eventProcessor->run(); }));
+
+        stopwatch.start();
+        m_cyclicBarrier->signal();
+        m_cyclicBarrier->wait();
+
+        for (auto i = 0; i < m_numPublishers; ++i)
+        {
+            futures[i].wait();
+        }
+
+        latch->waitOne();
+
+        stopwatch.stop();
+        m_eventProcessor->halt();
+        processorTask.wait_for(std::chrono::milliseconds(2000));
+
+        return m_iterations;
+    }
+
+    std::int32_t ThreeToOneShardedThroughputTest::requiredProcessorCount() const
+    {
+        return 4;
+    }
+
+    void ThreeToOneShardedThroughputTest::valuePublisher(const std::shared_ptr< Tests::CountdownEvent >& countdownEvent,
+                                                         const std::shared_ptr< RingBuffer< ValueEvent > >& ringBuffer,
+                                                         std::int64_t iterations)
+    {
+        auto& rb = *ringBuffer;
+
+        countdownEvent->signal();
+        countdownEvent->wait();
+
+        for (std::int64_t i = 0; i < iterations; ++i)
+        {
+            auto sequence = rb.next();
+            auto& eventData = rb[sequence];
+            eventData.value = i;
+            rb.publish(sequence);
+        }
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Disruptor/BusySpinWaitStrategy.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/RoundRobinThreadAffinedTaskScheduler.h"
+#include "Disruptor/ShardedEventProcessor.h"
+#include "Disruptor/ShardedRingBuffer.h"
+
+#include "Disruptor.TestTools/CountdownEvent.h"
+
+#include "Disruptor.PerfTests/IThroughputTest.h"
+#include "Disruptor.PerfTests/ValueEvent.h"
+#include "Disruptor.PerfTests/ValueAdditionEventHandler.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    /**
+     * Sequence a series of events from multiple publishers going to one event processor, each publisher owning a single producer shard.
+     * Same workload as ThreeToOneSequencedThroughputTest, without contention between the publishers.
+     *
+     * +----+    +====+
+     * | P1 |--->| S1 |------+
+     * +----+    +====+      |
+     *                       v
+     * +----+    +====+    +-----+
+     * | P2 |--->| S2 |--->| EP1 |
+     * +----+    +====+    +-----+
+     *                       ^
+     * +----+    +====+      |
+     * | P3 |--->| S3 |------+
+     * +----+    +====+
+     *
+     * P1  - Publisher 1
+     * P2  - Publisher 2
+     * P3  - Publisher 3
+     * S1  - Shard 1 of the ShardedRingBuffer
+     * S2  - Shard 2 of the ShardedRingBuffer
+     * S3  - Shard 3 of the ShardedRingBuffer
+     * EP1 - ShardedEventProcessor 1
+     *
+     */
+    class ThreeToOneShardedThroughputTest : public IThroughputTest
+    {
+    public:
+        ThreeToOneShardedThroughputTest();
+
+        std::int64_t run(Stopwatch& stopwatch) override;
+
+        std::int32_t requiredProcessorCount() const override;
+
+    private:
+        static void valuePublisher(const std::shared_ptr< Tests::CountdownEvent >& countdownEvent,
+                                   const std::shared_ptr< RingBuffer< ValueEvent > >& ringBuffer,
+                                   std::int64_t iterations);
+
+        const std::int32_t m_numPublishers = 3;
+        const std::int32_t m_bufferSize = 1024 * 64;
+
+#ifdef _DEBUG
+        const std::int64_t m_iterations = 100L * 100L * 2L;
+#else
+        const std::int64_t m_iterations = 1000L * 1000L * 20L;
+#endif
+
+        std::shared_ptr< Tests::CountdownEvent > m_cyclicBarrier = std::make_shared< Tests::CountdownEvent >(m_numPublishers + 1);
+        std::shared_ptr< ShardedRingBuffer< ValueEvent > > m_ringBuffer = ShardedRingBuffer< ValueEvent >::create(ValueEvent::eventFactory(), m_numPublishers, m_bufferSize, std::make_shared< BusySpinWaitStrategy >());
+
+        std::shared_ptr< ITaskScheduler > m_scheduler = std::make_shared< RoundRobinThreadAffinedTaskScheduler >();
+        std::shared_ptr< ValueAdditionEventHandler > m_handler = std::make_shared< ValueAdditionEventHandler >();
+        std::shared_ptr< ShardedEventProcessor< ValueEvent, ValueAdditionEventHandler > > m_eventProcessor;
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
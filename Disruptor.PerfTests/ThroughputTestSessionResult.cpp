@@ -19,18 +19,18 @@ namespace PerfTests
     {}
 
     ThroughputTestSessionResult::ThroughputTestSessionResult(const std::exception& exception)
-        : m_exception(exception)
+        : m_failure(std::string(exception.what()))
     {}
 
     void ThroughputTestSessionResult::appendDetailedHtmlReport(std::int32_t runId, std::ostringstream& os)
     {
-        if (m_exception)
+        if (m_failure)
         {
             os
                 << " <tr>" << std::endl
                 << "     <td>" << runId << "</td>" << std::endl
                 << "     <td>FAILED</td>" << std::endl
-                << "     <td>" << m_exception.get().what() << "</td>" << std::endl
+                << "     <td>" << m_failure.get() << "</td>" << std::endl
                 << "</tr>" << std::endl;
         }
         else
@@ -49,8 +49,8 @@ namespace PerfTests
         std::ostringstream result;
         result.imbue(std::locale(result.getloc(), new Tests::HumanNumberFacet()));
 
-        if (m_exception)
-            result << "Run: FAILED: " << m_exception.get().what();
+        if (m_failure)
+            result << "Run: FAILED: " << m_failure.get();
         else
         {
             auto humanDuration = Tests::DurationHumanizer::deduceHumanDuration(duration());
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <exception>
 #include <iosfwd>
+#include <string>
 
 #include <boost/optional.hpp>
 
@@ -33,7 +34,8 @@ namespace PerfTests
     private:
         std::int64_t m_totalOperationsInRun = 0;
         ClockConfig::Duration m_duration;
-        boost::optional< std::exception > m_exception;
+        // The message is copied, a copy of the std::exception would be sliced
+        boost::optional< std::string > m_failure;
     };
 
 } // namespace PerfTests
@@ -0,0 +1,44 @@
+#include "stdafx.h"
+#include "ValueAdditionBatchEventHandler.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    void ValueAdditionBatchEventHandler::reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount)
+    {
+        m_value.value = 0;
+        m_latch = latch;
+        m_count = expectedCount;
+    }
+
+    void ValueAdditionBatchEventHandler::onBatch(ValueEvent* first, std::size_t count, std::int64_t firstSequence)
+    {
+        auto value = m_value.value;
+        for (auto i = 0u; i < count; ++i)
+        {
+            value += first[i].value;
+        }
+        m_value.value = value;
+
+        if (firstSequence + static_cast< std::int64_t >(count) - 1 == m_count)
+        {
+            if (m_latch != nullptr)
+                m_latch->set();
+        }
+    }
+
+    std::int64_t ValueAdditionBatchEventHandler::count() const
+    {
+        return m_count;
+    }
+
+    std::int64_t ValueAdditionBatchEventHandler::value() const
+    {
+        return m_value.value;
+    }
+
+} // namespace PerfTests
+} // namespace Disruptor
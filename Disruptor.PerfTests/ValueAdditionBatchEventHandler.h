@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+
+#include "Disruptor/IBatchEventHandler.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+#include "Disruptor.PerfTests/PaddedLong.h"
+#include "Disruptor.PerfTests/ValueEvent.h"
+
+
+namespace Disruptor
+{
+namespace PerfTests
+{
+
+    class ValueAdditionBatchEventHandler : public IBatchEventHandler< ValueEvent >
+    {
+    public:
+        void reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount);
+
+        void onBatch(ValueEvent* first, std::size_t count, std::int64_t firstSequence) override;
+
+        std::int64_t count() const;
+
+        std::int64_t value() const;
+
+    private:
+        PaddedLong m_value;
+        std::int64_t m_count = 0;
+        std::shared_ptr< Tests::ManualResetEvent > m_latch;
+    };
+
+} // namespace PerfTests
+} // namespace Disruptor
@@ -14,17 +14,6 @@ namespace PerfTests
         m_count = expectedCount;
     }
 
-    void ValueAdditionEventHandler::onEvent(ValueEvent& value, std::int64_t sequence, bool)
-    {
-        m_value.value = m_value.value + value.value;
-
-        if (count() == sequence)
-        {
-            if (m_latch != nullptr)
-                m_latch->set();
-        }
-    }
-
     std::int64_t ValueAdditionEventHandler::count() const
     {
         return m_count;
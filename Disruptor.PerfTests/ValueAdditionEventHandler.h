@@ -15,12 +15,21 @@ namespace Disruptor
 namespace PerfTests
 {
 
-    class ValueAdditionEventHandler : public IEventHandler< ValueEvent >
+    class ValueAdditionEventHandler final : public IEventHandler< ValueEvent >
     {
     public:
         void reset(const std::shared_ptr< Tests::ManualResetEvent >& latch, std::int64_t expectedCount);
 
-        void onEvent(ValueEvent& value, std::int64_t sequence, bool /*endOfBatch*/) override;
+        void onEvent(ValueEvent& value, std::int64_t sequence, bool /*endOfBatch*/) override
+        {
+            m_value.value = m_value.value + value.value;
+
+            if (count() == sequence)
+            {
+                if (m_latch != nullptr)
+                    m_latch->set();
+            }
+        }
 
         std::int64_t count() const;
 
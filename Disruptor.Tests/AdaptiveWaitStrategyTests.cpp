@@ -0,0 +1,199 @@
+#include "stdafx.h"
+
+#include <atomic>
+#include <thread>
+
+#include "Disruptor/AdaptiveWaitStrategy.h"
+#include "Disruptor/AlertException.h"
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/ArgumentNullException.h"
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/RingBuffer.h"
+#include "Disruptor/Sequence.h"
+
+#include "DummySequenceBarrier.h"
+#include "SequenceUpdater.h"
+#include "StubEvent.h"
+#include "WaitStrategyTestUtil.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    void waitOnBarrierWithDelayOf(std::int64_t sleepTimeMillis, const std::shared_ptr< AdaptiveWaitStrategy >& waitStrategy, ISequenceBarrier& barrier)
+    {
+        auto sequenceUpdater = std::make_shared< SequenceUpdater >(sleepTimeMillis, waitStrategy);
+        std::thread([=] { sequenceUpdater->run(); }).detach();
+        sequenceUpdater->waitForStartup();
+
+        Sequence cursor(0);
+        BOOST_CHECK_EQUAL(waitStrategy->waitFor(0, cursor, *sequenceUpdater->sequence, barrier), 0);
+    }
+
+    /**
+     * Barrier which stays alerted
+     */
+    class AlertedSequenceBarrier : public DummySequenceBarrier
+    {
+    public:
+        bool isAlerted() override
+        {
+            return true;
+        }
+
+        void checkAlert() override
+        {
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+        }
+    };
+
+    /**
+     * Parking strategy counting the barriers unregistered through the AdaptiveWaitStrategy
+     */
+    class UnregisterCountingWaitStrategy : public BlockingWaitStrategy
+    {
+    public:
+        void unregisterBarrier(const ISequenceBarrier& /*barrier*/) override
+        {
+            ++m_unregisterCount;
+        }
+
+        std::int32_t unregisterCount() const
+        {
+            return m_unregisterCount;
+        }
+
+    private:
+        std::atomic< std::int32_t > m_unregisterCount { 0 };
+    };
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(AdaptiveWaitStrategyTests)
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForValue)
+{
+    assertWaitForWithDelayOf(0, AdaptiveWaitStrategy::withLock());
+    assertWaitForWithDelayOf(1, AdaptiveWaitStrategy::withLiteLock());
+    assertWaitForWithDelayOf(10, AdaptiveWaitStrategy::withFutex());
+}
+
+BOOST_AUTO_TEST_CASE(ShouldCountWaitsSatisfiedImmediately)
+{
+    auto waitStrategy = AdaptiveWaitStrategy::withFutex();
+    Sequence cursor(5);
+    DummySequenceBarrier barrier;
+
+    BOOST_CHECK_EQUAL(waitStrategy->waitFor(5, cursor, cursor, barrier), 5);
+    BOOST_CHECK_EQUAL(waitStrategy->waitFor(3, cursor, cursor, barrier), 5);
+
+    auto counts = waitStrategy->phaseCounts();
+    BOOST_CHECK_EQUAL(counts.immediate, 2);
+    BOOST_CHECK_EQUAL(counts.spin, 0);
+    BOOST_CHECK_EQUAL(counts.park, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldShrinkSpinBudgetWhenEventsArriveAfterLongParks)
+{
+    auto waitStrategy = std::make_shared< AdaptiveWaitStrategy >(std::make_shared< BlockingWaitStrategy >(), 10, 1000);
+    DummySequenceBarrier barrier;
+    BOOST_CHECK_EQUAL(waitStrategy->spinTries(barrier), 1000);
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        waitOnBarrierWithDelayOf(20, waitStrategy, barrier);
+    }
+
+    BOOST_CHECK_EQUAL(waitStrategy->phaseCounts().park, 3);
+    BOOST_CHECK_EQUAL(waitStrategy->spinTries(barrier), 125);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldTuneTheSpinBudgetOfEachBarrier)
+{
+    auto waitStrategy = std::make_shared< AdaptiveWaitStrategy >(std::make_shared< BlockingWaitStrategy >(), 10, 1000);
+    DummySequenceBarrier parkingBarrier;
+    DummySequenceBarrier immediateBarrier;
+    Sequence cursor(5);
+
+    waitOnBarrierWithDelayOf(20, waitStrategy, parkingBarrier);
+
+    std::thread([&] { waitStrategy->waitFor(5, cursor, cursor, immediateBarrier); }).join();
+    BOOST_CHECK_EQUAL(waitStrategy->waitFor(5, cursor, cursor, immediateBarrier), 5);
+
+    BOOST_CHECK_EQUAL(waitStrategy->spinTries(parkingBarrier), 500);
+    BOOST_CHECK_EQUAL(waitStrategy->spinTries(immediateBarrier), 1000);
+
+    auto counts = waitStrategy->phaseCounts();
+    BOOST_CHECK_EQUAL(counts.immediate, 2);
+    BOOST_CHECK_EQUAL(counts.park, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReleaseTheStateOfAnUnregisteredBarrier)
+{
+    auto waitStrategy = std::make_shared< AdaptiveWaitStrategy >(std::make_shared< BlockingWaitStrategy >(), 10, 1000);
+    DummySequenceBarrier barrier;
+    Sequence cursor(5);
+
+    waitOnBarrierWithDelayOf(20, waitStrategy, barrier);
+    BOOST_CHECK_EQUAL(waitStrategy->spinTries(barrier), 500);
+
+    // Same address as a barrier constructed after the destruction of the previous one
+    waitStrategy->unregisterBarrier(barrier);
+    BOOST_CHECK_EQUAL(waitStrategy->spinTries(barrier), 1000);
+
+    BOOST_CHECK_EQUAL(waitStrategy->waitFor(5, cursor, cursor, barrier), 5);
+
+    auto counts = waitStrategy->phaseCounts();
+    BOOST_CHECK_EQUAL(counts.immediate, 1);
+    BOOST_CHECK_EQUAL(counts.park, 1);
+    BOOST_CHECK_EQUAL(waitStrategy->spinTries(barrier), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldUnregisterTheBarriersWhenTheyAreDestroyed)
+{
+    auto parkingStrategy = std::make_shared< UnregisterCountingWaitStrategy >();
+    auto waitStrategy = std::make_shared< AdaptiveWaitStrategy >(parkingStrategy);
+    auto ringBuffer = RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 16, waitStrategy);
+
+    auto barrier = ringBuffer->newBarrier();
+    ringBuffer->publish(ringBuffer->next());
+    BOOST_CHECK_EQUAL(barrier->waitFor(0), 0);
+
+    barrier.reset();
+
+    BOOST_CHECK_EQUAL(parkingStrategy->unregisterCount(), 1);
+    BOOST_CHECK_EQUAL(waitStrategy->phaseCounts().immediate, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReportAnAlertOfTheBarrierAsAStatus)
+{
+    auto waitStrategy = std::make_shared< AdaptiveWaitStrategy >(std::make_shared< BlockingWaitStrategy >(), 10, 1000);
+    AlertedSequenceBarrier barrier;
+    Sequence cursor(5);
+
+    BOOST_CHECK(waitStrategy->tryWaitFor(6, cursor, cursor, barrier).status == SequenceWaitStatus::Alerted);
+    BOOST_CHECK(waitStrategy->tryWaitFor(5, cursor, cursor, barrier).isAvailable());
+    BOOST_CHECK_THROW(waitStrategy->waitFor(6, cursor, cursor, barrier), AlertException);
+
+    auto counts = waitStrategy->phaseCounts();
+    BOOST_CHECK_EQUAL(counts.immediate, 1);
+    BOOST_CHECK_EQUAL(counts.park, 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectInvalidSpinBudgetBounds)
+{
+    auto parkingStrategy = std::make_shared< BlockingWaitStrategy >();
+
+    BOOST_CHECK_THROW(AdaptiveWaitStrategy(nullptr), ArgumentNullException);
+    BOOST_CHECK_THROW(AdaptiveWaitStrategy(parkingStrategy, 0, 10), ArgumentException);
+    BOOST_CHECK_THROW(AdaptiveWaitStrategy(parkingStrategy, 10, 9), ArgumentException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
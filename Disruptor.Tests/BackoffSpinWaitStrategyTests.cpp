@@ -0,0 +1,52 @@
+#include "stdafx.h"
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/BackoffSpinWaitStrategy.h"
+#include "Disruptor/Sequence.h"
+#include "Disruptor/SpinPolicy.h"
+#include "WaitStrategyTestUtil.h"
+
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(BackoffSpinWaitStrategyTests)
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForValue)
+{
+    assertWaitForWithDelayOf(50, std::make_shared< BackoffSpinWaitStrategy >());
+    assertWaitForWithDelayOf(50, std::make_shared< BackoffSpinWaitStrategy >(4, false));
+}
+
+BOOST_AUTO_TEST_CASE(ShouldDoubleThePausesUpToTheLimit)
+{
+    SpinPolicy spinPolicy(8);
+
+    std::vector< std::int32_t > pauseCounts;
+    for (auto i = 0; i < 6; ++i)
+    {
+        pauseCounts.push_back(spinPolicy.pauseCount());
+        spinPolicy.spinOnce();
+    }
+
+    BOOST_CHECK((pauseCounts == std::vector< std::int32_t > { 1, 2, 4, 8, 8, 8 }));
+
+    spinPolicy.reset();
+    BOOST_CHECK_EQUAL(spinPolicy.pauseCount(), 1);
+
+    BOOST_CHECK_THROW(SpinPolicy(0), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReturnFromWaitForChangeWhenTheValueHasAlreadyChanged)
+{
+    Sequence sequence(1);
+    SpinPolicy spinPolicy;
+
+    spinPolicy.waitForChange(sequence, 0);
+
+    BOOST_CHECK_EQUAL(SpinPolicy(1, false).usesWaitPkg(), false);
+    BOOST_CHECK_EQUAL(spinPolicy.usesWaitPkg(), SpinPolicy::isWaitPkgSupported());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
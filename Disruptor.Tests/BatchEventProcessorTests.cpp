@@ -1,7 +1,48 @@
 #include "stdafx.h"
 
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/SingleProducerSequencer.h"
+#include "Disruptor/StaticDispatch.h"
+
 #include "BatchEventProcessorTestsFixture.h"
+#include "BatchSpanHandlerMock.h"
+
 
+namespace Disruptor
+{
+namespace Tests
+{
+
+    class ReadCountingRingBuffer : public RingBuffer< StubEvent >
+    {
+    public:
+        ReadCountingRingBuffer()
+            : RingBuffer< StubEvent >(StubEvent::eventFactory(), std::make_shared< SingleProducerSequencer< StubEvent > >(16, std::make_shared< BlockingWaitStrategy >()))
+        {
+        }
+
+        StubEvent& operator[](std::int64_t sequence) const override
+        {
+            ++m_readCount;
+            return RingBuffer< StubEvent >::operator[](sequence);
+        }
+
+        mutable std::int32_t m_readCount = 0;
+    };
+
+    class StubEventSummingHandler : public IEventHandler< StubEvent >
+    {
+    public:
+        void onEvent(StubEvent& data, std::int64_t /*sequence*/, bool /*endOfBatch*/) override
+        {
+            m_sum += data.value();
+        }
+
+        std::int64_t m_sum = 0;
+    };
+
+} // namespace Tests
+} // namespace Disruptor
 
 using namespace Disruptor;
 using namespace Disruptor::Tests;
@@ -75,4 +116,131 @@ BOOST_FIXTURE_TEST_CASE(ShouldCallExceptionHandlerOnUncaughtException, BatchEven
     thread.join();
 }
 
+BOOST_FIXTURE_TEST_CASE(ShouldDeliverAvailableEventsAsSingleSpan, BatchEventProcessorTestsFixture)
+{
+    auto spanHandlerMock = std::make_shared< testing::StrictMock< BatchSpanHandlerMock< StubEvent > > >();
+    auto batchEventProcessor = std::make_shared< BatchEventProcessor< StubEvent > >(m_ringBuffer, m_sequenceBarrier, spanHandlerMock);
+
+    EXPECT_CALL(*spanHandlerMock, onBatch(&(*m_ringBuffer)[0], 3, 0)).WillOnce(testing::Invoke([this](StubEvent*, std::size_t, std::int64_t)
+    {
+        m_countDownEvent.signal();
+    }));
+
+    m_ringBuffer->publish(m_ringBuffer->next());
+    m_ringBuffer->publish(m_ringBuffer->next());
+    m_ringBuffer->publish(m_ringBuffer->next());
+
+    std::thread thread([batchEventProcessor] { batchEventProcessor->run(); });
+
+    BOOST_CHECK_EQUAL(m_countDownEvent.wait(std::chrono::milliseconds(50)), true);
+    batchEventProcessor->halt();
+    thread.join();
+
+    BOOST_CHECK_EQUAL(batchEventProcessor->sequence()->value(), 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(ShouldSplitSpanAtRingWrapPoint, BatchEventProcessorTestsFixture)
+{
+    auto spanHandlerMock = std::make_shared< testing::StrictMock< BatchSpanHandlerMock< StubEvent > > >();
+    auto batchEventProcessor = std::make_shared< BatchEventProcessor< StubEvent > >(m_ringBuffer, m_sequenceBarrier, spanHandlerMock);
+    m_ringBuffer->addGatingSequences({ batchEventProcessor->sequence() });
+
+    CountdownEvent firstBatchProcessed(1);
+
+    testing::InSequence s;
+    EXPECT_CALL(*spanHandlerMock, onBatch(&(*m_ringBuffer)[0], 14, 0)).WillOnce(testing::Invoke([&](StubEvent*, std::size_t, std::int64_t)
+    {
+        firstBatchProcessed.signal();
+    }));
+    EXPECT_CALL(*spanHandlerMock, onBatch(&(*m_ringBuffer)[14], 2, 14)).Times(1);
+    EXPECT_CALL(*spanHandlerMock, onBatch(&(*m_ringBuffer)[16], 2, 16)).WillOnce(testing::Invoke([this](StubEvent*, std::size_t, std::int64_t)
+    {
+        m_countDownEvent.signal();
+    }));
+
+    m_ringBuffer->publish(0, m_ringBuffer->next(14));
+
+    std::thread thread([batchEventProcessor] { batchEventProcessor->run(); });
+
+    BOOST_CHECK_EQUAL(firstBatchProcessed.wait(std::chrono::milliseconds(50)), true);
+
+    m_ringBuffer->publish(14, m_ringBuffer->next(4));
+
+    BOOST_CHECK_EQUAL(m_countDownEvent.wait(std::chrono::milliseconds(50)), true);
+    batchEventProcessor->halt();
+    thread.join();
+
+    BOOST_CHECK_EQUAL(batchEventProcessor->sequence()->value(), 17);
+}
+
+BOOST_FIXTURE_TEST_CASE(ShouldSkipSpanOnUncaughtException, BatchEventProcessorTestsFixture)
+{
+    InvalidOperationException ex("BatchEventProcessorTests.ShouldSkipSpanOnUncaughtException");
+
+    auto spanHandlerMock = std::make_shared< testing::StrictMock< BatchSpanHandlerMock< StubEvent > > >();
+    auto batchEventProcessor = std::make_shared< BatchEventProcessor< StubEvent > >(m_ringBuffer, m_sequenceBarrier, spanHandlerMock);
+    batchEventProcessor->setExceptionHandler(m_excpetionHandlerMock);
+
+    EXPECT_CALL(*spanHandlerMock, onBatch(&(*m_ringBuffer)[0], 2, 0)).WillOnce(testing::Throw(ex));
+    EXPECT_CALL(*m_excpetionHandlerMock, handleEventException(testing::_, 0, (*m_ringBuffer)[0]))
+        .WillOnce(testing::Invoke([this](const std::exception&, std::int64_t, StubEvent&)
+        {
+            m_countDownEvent.signal();
+        }));
+
+    m_ringBuffer->publish(0, m_ringBuffer->next(2));
+
+    std::thread thread([batchEventProcessor] { batchEventProcessor->run(); });
+
+    BOOST_CHECK_EQUAL(m_countDownEvent.wait(std::chrono::milliseconds(50)), true);
+    batchEventProcessor->halt();
+    thread.join();
+
+    BOOST_CHECK_EQUAL(batchEventProcessor->sequence()->value(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReadTheEventsOfAConcreteRingBufferWithoutVirtualDispatch)
+{
+    ReadCountingRingBuffer ringBuffer;
+    const RingBuffer< StubEvent >& baseRingBuffer = ringBuffer;
+
+    // A qualified read bypasses the override, the virtual read goes through it
+    BOOST_CHECK_EQUAL(&DataProviderDispatch< RingBuffer< StubEvent > >::get(baseRingBuffer, 3), &baseRingBuffer[3]);
+    BOOST_CHECK_EQUAL(ringBuffer.m_readCount, 1);
+
+    DataProviderDispatch< IDataProvider< StubEvent > >::get(baseRingBuffer, 3);
+    BOOST_CHECK_EQUAL(ringBuffer.m_readCount, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldOnlyProcessEventsOfExactlyTheStaticallyDispatchedTypes)
+{
+    std::shared_ptr< RingBuffer< StubEvent > > derivedRingBuffer = std::make_shared< ReadCountingRingBuffer >();
+    auto eventHandler = std::make_shared< StubEventSummingHandler >();
+
+    using StaticBatchEventProcessor = BatchEventProcessor< StubEvent, StubEventSummingHandler, RingBuffer< StubEvent > >;
+    BOOST_CHECK_THROW(StaticBatchEventProcessor(derivedRingBuffer, derivedRingBuffer->newBarrier(), eventHandler), ArgumentException);
+
+    auto ringBuffer = RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 16);
+    auto processor = std::make_shared< StaticBatchEventProcessor >(ringBuffer, ringBuffer->newBarrier(), eventHandler);
+    ringBuffer->addGatingSequences({ processor->sequence() });
+
+    for (auto i = 1; i <= 3; ++i)
+    {
+        auto sequence = ringBuffer->next();
+        (*ringBuffer)[sequence].value(i);
+        ringBuffer->publish(sequence);
+    }
+
+    std::thread thread([&] { processor->run(); });
+
+    auto timeout = ClockConfig::Clock::now() + std::chrono::seconds(10);
+    while (processor->sequence()->value() != 2 && ClockConfig::Clock::now() < timeout)
+        std::this_thread::yield();
+
+    processor->halt();
+    thread.join();
+
+    BOOST_CHECK_EQUAL(eventHandler->m_sum, 6);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
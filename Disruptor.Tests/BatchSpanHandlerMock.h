@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <gmock/gmock.h>
+
+#include "Disruptor/IBatchEventHandler.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    template <class T>
+    class BatchSpanHandlerMock : public IBatchEventHandler< T >
+    {
+    public:
+        MOCK_METHOD3_T(onBatch, void(T* first, std::size_t count, std::int64_t firstSequence));
+    };
+
+} // namespace Tests
+} // namespace Disruptor
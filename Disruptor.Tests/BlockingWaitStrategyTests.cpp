@@ -0,0 +1,209 @@
+#include "stdafx.h"
+
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/FutexWaitStrategy.h"
+#include "Disruptor/LiteBlockingWaitStrategy.h"
+#include "Disruptor/LiteTimeoutBlockingWaitStrategy.h"
+#include "Disruptor/RingBuffer.h"
+#include "Disruptor/SelectiveBlockingWaitStrategy.h"
+#include "Disruptor/TimeoutBlockingWaitStrategy.h"
+#include "Disruptor/TimeoutException.h"
+#include "Disruptor/TimeoutFutexWaitStrategy.h"
+
+#include "DummySequenceBarrier.h"
+#include "StubEvent.h"
+#include "WaitStrategyTestUtil.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    void assertParksOnRegisteredDependentSequence(const std::shared_ptr< IWaitStrategy >& waitStrategy)
+    {
+        auto ringBuffer = RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 16, waitStrategy);
+
+        auto upstreamSequence = std::make_shared< Sequence >();
+        auto upstreamWaitQueue = ringBuffer->newBarrier()->registerDependentSequence(upstreamSequence);
+        BOOST_REQUIRE(upstreamWaitQueue != nullptr);
+
+        auto barrier = ringBuffer->newBarrier({ upstreamSequence });
+
+        std::int64_t availableSequence = -1;
+        std::thread consumer([&] { availableSequence = barrier->waitFor(0); });
+
+        ringBuffer->publish(ringBuffer->next());
+
+        // Once the cursor is available, the consumer parks on the upstream sequence instead of spinning
+        while (upstreamWaitQueue->waiterCount() == 0)
+            std::this_thread::yield();
+
+        upstreamSequence->setValue(0);
+        upstreamWaitQueue->wakeAll();
+        consumer.join();
+
+        BOOST_CHECK_EQUAL(availableSequence, 0);
+    }
+
+    /**
+     * Barrier counting the calls to checkAlert(), which the parking strategies must not make
+     */
+    class AlertCountingSequenceBarrier : public DummySequenceBarrier
+    {
+    public:
+        bool isAlerted() override
+        {
+            return m_alerted;
+        }
+
+        void alert() override
+        {
+            m_alerted = true;
+        }
+
+        void clearAlert() override
+        {
+            m_alerted = false;
+        }
+
+        void checkAlert() override
+        {
+            ++m_checkAlertCount;
+
+            if (m_alerted)
+                DISRUPTOR_THROW_ALERT_EXCEPTION();
+        }
+
+        std::int32_t checkAlertCount() const
+        {
+            return m_checkAlertCount;
+        }
+
+    private:
+        std::atomic< bool > m_alerted { false };
+        std::atomic< std::int32_t > m_checkAlertCount { 0 };
+    };
+
+    void assertReportsAlertWhileParkedWithoutThrowing(const std::shared_ptr< IWaitStrategy >& waitStrategy)
+    {
+        Sequence cursor;
+        auto upstreamSequence = std::make_shared< Sequence >();
+        auto upstreamWaitQueue = waitStrategy->registerDependentSequence(upstreamSequence);
+        BOOST_REQUIRE(upstreamWaitQueue != nullptr);
+
+        AlertCountingSequenceBarrier barrier;
+        auto result = SequenceWaitResult::available(-1);
+
+        // Parked on the cursor
+        std::thread cursorConsumer([&] { result = waitStrategy->tryWaitFor(0, cursor, cursor, barrier); });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        barrier.alert();
+        waitStrategy->signalAllWhenAlerted();
+        cursorConsumer.join();
+
+        BOOST_CHECK(result.status == SequenceWaitStatus::Alerted);
+
+        // Parked on the queue of the upstream sequence
+        barrier.clearAlert();
+        cursor.setValue(0);
+        result = SequenceWaitResult::available(-1);
+
+        std::thread upstreamConsumer([&] { result = waitStrategy->tryWaitFor(0, cursor, *upstreamSequence, barrier); });
+
+        while (upstreamWaitQueue->waiterCount() == 0)
+            std::this_thread::yield();
+
+        barrier.alert();
+        waitStrategy->signalAllWhenAlerted();
+        upstreamConsumer.join();
+
+        BOOST_CHECK(result.status == SequenceWaitStatus::Alerted);
+        BOOST_CHECK_EQUAL(barrier.checkAlertCount(), 0);
+    }
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(BlockingWaitStrategyTests)
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForValue)
+{
+    assertWaitForWithDelayOf(50, std::make_shared< BlockingWaitStrategy >());
+}
+
+BOOST_AUTO_TEST_CASE(ShouldParkOnRegisteredDependentSequence)
+{
+    assertParksOnRegisteredDependentSequence(std::make_shared< BlockingWaitStrategy >());
+    assertParksOnRegisteredDependentSequence(std::make_shared< LiteBlockingWaitStrategy >());
+    assertParksOnRegisteredDependentSequence(std::make_shared< TimeoutBlockingWaitStrategy >(std::chrono::seconds(5)));
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+    assertParksOnRegisteredDependentSequence(std::make_shared< FutexWaitStrategy >());
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(ShouldTimeoutWaitingForRegisteredDependentSequence)
+{
+    auto ringBuffer = RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 16, std::make_shared< TimeoutBlockingWaitStrategy >(std::chrono::milliseconds(100)));
+
+    auto upstreamSequence = std::make_shared< Sequence >();
+    ringBuffer->newBarrier()->registerDependentSequence(upstreamSequence);
+    auto barrier = ringBuffer->newBarrier({ upstreamSequence });
+
+    ringBuffer->publish(ringBuffer->next());
+
+    BOOST_CHECK_THROW(barrier->waitFor(0), TimeoutException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldTimeoutOnceWaitingForAGroupOfRegisteredDependentSequences)
+{
+    auto timeout = std::chrono::milliseconds(500);
+    auto ringBuffer = RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 16, std::make_shared< TimeoutBlockingWaitStrategy >(timeout));
+
+    auto firstSequence = std::make_shared< Sequence >();
+    auto secondSequence = std::make_shared< Sequence >();
+    auto firstWaitQueue = ringBuffer->newBarrier()->registerDependentSequence(firstSequence);
+    ringBuffer->newBarrier()->registerDependentSequence(secondSequence);
+    auto barrier = ringBuffer->newBarrier({ firstSequence, secondSequence });
+
+    ringBuffer->publish(ringBuffer->next());
+
+    // The first member is reached shortly before the timeout, the second one never is
+    std::thread upstream([&]
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(400));
+        firstSequence->setValue(0);
+        firstWaitQueue->wakeAll();
+    });
+
+    auto start = ClockConfig::Clock::now();
+    BOOST_CHECK_THROW(barrier->waitFor(0), TimeoutException);
+    auto waited = ClockConfig::Clock::now() - start;
+
+    upstream.join();
+
+    BOOST_CHECK(waited >= timeout);
+    BOOST_CHECK(waited < timeout + std::chrono::milliseconds(350));
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReportAlertWhileParkedWithoutThrowing)
+{
+    assertReportsAlertWhileParkedWithoutThrowing(std::make_shared< BlockingWaitStrategy >());
+    assertReportsAlertWhileParkedWithoutThrowing(std::make_shared< LiteBlockingWaitStrategy >());
+    assertReportsAlertWhileParkedWithoutThrowing(std::make_shared< SelectiveBlockingWaitStrategy >());
+    assertReportsAlertWhileParkedWithoutThrowing(std::make_shared< TimeoutBlockingWaitStrategy >(std::chrono::seconds(5)));
+    assertReportsAlertWhileParkedWithoutThrowing(std::make_shared< LiteTimeoutBlockingWaitStrategy >(std::chrono::seconds(5)));
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+    assertReportsAlertWhileParkedWithoutThrowing(std::make_shared< FutexWaitStrategy >());
+    assertReportsAlertWhileParkedWithoutThrowing(std::make_shared< TimeoutFutexWaitStrategy >(std::chrono::seconds(5)));
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,230 @@
+#include "stdafx.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/ArgumentOutOfRangeException.h"
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/ByteEventProcessor.h"
+#include "Disruptor/ByteRingBuffer.h"
+#include "Disruptor/Sequence.h"
+
+#include "Disruptor.TestTools/CountdownEvent.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    // Message i of a producer holds (i * 37) % 300 + 1 bytes: the producer id, then bytes equal to the producer id plus i
+    std::vector< std::uint8_t > testMessage(std::int32_t producer, std::int32_t i)
+    {
+        std::vector< std::uint8_t > message(static_cast< std::size_t >((i * 37) % 300 + 1), static_cast< std::uint8_t >(producer + i));
+        message[0] = static_cast< std::uint8_t >(producer);
+        return message;
+    }
+
+    class MessageCheckingHandler : public IEventHandler< ByteRecord >
+    {
+    public:
+        MessageCheckingHandler(std::int32_t producerCount, std::int32_t messagesPerProducer)
+            : m_nextMessages(producerCount, 0)
+            , m_remaining(producerCount * messagesPerProducer)
+        {
+        }
+
+        void onEvent(ByteRecord& record, std::int64_t /*sequence*/, bool /*endOfBatch*/) override
+        {
+            // The messages of each producer are received in order
+            auto producer = record.data[0];
+            auto expected = testMessage(producer, m_nextMessages[producer]++);
+
+            if (record.length != expected.size() || !std::equal(expected.begin(), expected.end(), record.data))
+                ++mismatches;
+
+            if (--m_remaining == 0)
+                allReceived.signal();
+        }
+
+        std::int32_t mismatches = 0;
+        CountdownEvent allReceived { 1 };
+
+    private:
+        std::vector< std::int32_t > m_nextMessages;
+        std::int32_t m_remaining;
+    };
+
+    class EndOfBatchRecordingHandler : public IEventHandler< ByteRecord >
+    {
+    public:
+        void onEvent(ByteRecord& /*record*/, std::int64_t sequence, bool endOfBatch) override
+        {
+            deliveries.emplace_back(sequence, endOfBatch);
+        }
+
+        std::vector< std::pair< std::int64_t, bool > > deliveries;
+    };
+
+    void publishAndCheckMessages(ProducerType producerType, std::int32_t producerCount)
+    {
+        const auto messagesPerProducer = 2000;
+
+        auto ringBuffer = ByteRingBuffer::create(producerType, 32, std::make_shared< BlockingWaitStrategy >());
+        auto handler = std::make_shared< MessageCheckingHandler >(producerCount, messagesPerProducer);
+        auto processor = std::make_shared< ByteEventProcessor >(ringBuffer, ringBuffer->newBarrier(), handler);
+        ringBuffer->addGatingSequences({ processor->sequence() });
+
+        std::thread processorThread([processor] { processor->run(); });
+
+        std::vector< std::thread > producers;
+        for (auto producer = 0; producer < producerCount; ++producer)
+        {
+            producers.emplace_back([=]
+            {
+                for (auto i = 0; i < messagesPerProducer; ++i)
+                {
+                    auto message = testMessage(producer, i);
+                    ringBuffer->publish(message.data(), message.size());
+                }
+            });
+        }
+
+        for (auto&& producer : producers)
+            producer.join();
+
+        BOOST_CHECK_EQUAL(handler->allReceived.wait(std::chrono::seconds(5)), true);
+        processor->halt();
+        processorThread.join();
+
+        BOOST_CHECK_EQUAL(handler->mismatches, 0);
+        BOOST_CHECK_EQUAL(processor->sequence()->value(), ringBuffer->cursor());
+    }
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(ByteRingBufferTests)
+
+BOOST_AUTO_TEST_CASE(ShouldClaimChunksForTheHeaderAndThePayload)
+{
+    BOOST_CHECK_EQUAL(ByteRingBuffer::chunksFor(0), 1);
+    BOOST_CHECK_EQUAL(ByteRingBuffer::chunksFor(56), 1);
+    BOOST_CHECK_EQUAL(ByteRingBuffer::chunksFor(57), 2);
+
+    auto ringBuffer = ByteRingBuffer::create(ProducerType::Single, 8, std::make_shared< BlockingWaitStrategy >());
+    BOOST_CHECK_EQUAL(ringBuffer->maxRecordLength(), 4u * 64 - 8);
+
+    auto claim = ringBuffer->claim(100);
+    BOOST_CHECK_EQUAL(claim.firstSequence(), 0);
+    BOOST_CHECK_EQUAL(claim.lastSequence(), 1);
+    BOOST_CHECK_EQUAL(reinterpret_cast< std::uintptr_t >(claim.data()) % 64, 8u);
+
+    std::fill(claim.data(), claim.data() + claim.length(), 42);
+    ringBuffer->publish(claim);
+
+    auto record = ringBuffer->record(0);
+    BOOST_CHECK_EQUAL(record.isPadding, false);
+    BOOST_CHECK_EQUAL(record.length, 100u);
+    BOOST_CHECK_EQUAL(record.chunkCount, 2);
+    BOOST_CHECK_EQUAL(record.data[99], 42);
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldPadRecordsStraddlingTheWrapPoint)
+{
+    auto ringBuffer = ByteRingBuffer::create(ProducerType::Single, 8, std::make_shared< BlockingWaitStrategy >());
+    std::vector< std::uint8_t > message(150, 7);
+
+    ringBuffer->publish(message.data(), message.size());
+    ringBuffer->publish(message.data(), message.size());
+
+    // Chunks 6 to 8 would straddle the wrap point
+    auto claim = ringBuffer->claim(message.size());
+    BOOST_CHECK_EQUAL(claim.firstSequence(), 9);
+    ringBuffer->publish(claim);
+
+    auto padding = ringBuffer->record(6);
+    BOOST_CHECK_EQUAL(padding.isPadding, true);
+    BOOST_CHECK_EQUAL(padding.chunkCount, 3);
+    BOOST_CHECK_EQUAL(ringBuffer->record(9).length, 150u);
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 11);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldEndTheBatchOnTheLastRecordWhenTheBatchEndsWithPadding)
+{
+    auto ringBuffer = ByteRingBuffer::create(ProducerType::Single, 16, std::make_shared< BlockingWaitStrategy >());
+    auto handler = std::make_shared< EndOfBatchRecordingHandler >();
+    auto processor = std::make_shared< ByteEventProcessor >(ringBuffer, ringBuffer->newBarrier(), handler);
+    std::vector< std::uint8_t > message(150, 7);
+
+    // The records at chunks 0 and 3 are already consumed, the next batch is 6, 9, 12 then the padding of chunks 15 to 17
+    ringBuffer->addGatingSequences({ processor->sequence() });
+    processor->sequence()->setValue(5);
+
+    for (auto i = 0; i < 5; ++i)
+        ringBuffer->publish(message.data(), message.size());
+
+    auto claim = ringBuffer->claim(message.size());
+    BOOST_CHECK_EQUAL(claim.firstSequence(), 18);
+
+    std::thread processorThread([processor] { processor->run(); });
+
+    auto waitForSequence = [&](std::int64_t sequence)
+    {
+        auto timeout = ClockConfig::Clock::now() + std::chrono::seconds(10);
+        while (processor->sequence()->value() != sequence && ClockConfig::Clock::now() < timeout)
+            std::this_thread::yield();
+    };
+
+    waitForSequence(17);
+    ringBuffer->publish(claim);
+    waitForSequence(20);
+
+    processor->halt();
+    processorThread.join();
+
+    std::vector< std::pair< std::int64_t, bool > > expected { { 6, false }, { 9, false }, { 12, true }, { 18, true } };
+    BOOST_CHECK(handler->deliveries == expected);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectRecordsLargerThanHalfTheRing)
+{
+    auto ringBuffer = ByteRingBuffer::create(ProducerType::Multi, 8, std::make_shared< BlockingWaitStrategy >());
+
+    BOOST_CHECK_THROW(ringBuffer->claim(ringBuffer->maxRecordLength() + 1), ArgumentOutOfRangeException);
+    BOOST_CHECK_THROW(ByteRingBuffer::create(ProducerType::Single, 1, std::make_shared< BlockingWaitStrategy >()), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldNotPublishWhenTheRingIsFull)
+{
+    auto ringBuffer = ByteRingBuffer::create(ProducerType::Single, 8, std::make_shared< BlockingWaitStrategy >());
+    auto gatingSequence = std::make_shared< Sequence >();
+    ringBuffer->addGatingSequences({ gatingSequence });
+
+    std::vector< std::uint8_t > message(100, 1);
+    for (auto i = 0; i < 4; ++i)
+        BOOST_CHECK_EQUAL(ringBuffer->tryPublish(message.data(), message.size()), true);
+
+    BOOST_CHECK_EQUAL(ringBuffer->tryPublish(message.data(), message.size()), false);
+
+    gatingSequence->setValue(1);
+    BOOST_CHECK_EQUAL(ringBuffer->tryPublish(message.data(), message.size()), true);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldDeliverMixedSizeMessagesFromSingleProducer)
+{
+    publishAndCheckMessages(ProducerType::Single, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldDeliverMixedSizeMessagesFromMultipleProducers)
+{
+    publishAndCheckMessages(ProducerType::Multi, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
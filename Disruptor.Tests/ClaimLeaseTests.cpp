@@ -0,0 +1,198 @@
+#include "stdafx.h"
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/ClaimLease.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "LongEvent.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    struct ClaimLeaseFixture
+    {
+        struct FillerTranslator : public IEventTranslator< LongEvent >
+        {
+            void translateTo(LongEvent& eventData, std::int64_t /*sequence*/) override
+            {
+                eventData.value = -1;
+            }
+        };
+
+        ClaimLeaseFixture()
+            : m_filler(std::make_shared< FillerTranslator >())
+        {
+        }
+
+        static std::shared_ptr< RingBuffer< LongEvent > > createRingBuffer(ProducerType producerType)
+        {
+            return RingBuffer< LongEvent >::create(producerType, []() { return LongEvent(); }, 32, std::make_shared< BlockingWaitStrategy >());
+        }
+
+        struct ThrowingFillerTranslator : public IEventTranslator< LongEvent >
+        {
+            void translateTo(LongEvent& /*eventData*/, std::int64_t /*sequence*/) override
+            {
+                throw std::runtime_error("filler failure");
+            }
+        };
+
+        std::shared_ptr< FillerTranslator > m_filler;
+    };
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_FIXTURE_TEST_SUITE(ClaimLeaseTests, ClaimLeaseFixture)
+
+BOOST_AUTO_TEST_CASE(ShouldClaimSequencesFromTheRingBufferByLease)
+{
+    auto ringBuffer = createRingBuffer(ProducerType::Multi);
+    auto lease = ringBuffer->newClaimLease(4, m_filler);
+
+    BOOST_CHECK_EQUAL(lease->next(), 0);
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 3);
+    BOOST_CHECK_EQUAL(lease->remaining(), 3);
+
+    BOOST_CHECK_EQUAL(lease->next(), 1);
+    BOOST_CHECK_EQUAL(lease->next(), 2);
+    BOOST_CHECK_EQUAL(lease->next(), 3);
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 3);
+
+    BOOST_CHECK_EQUAL(lease->next(), 4);
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldMakeEachPublishedSequenceAvailable)
+{
+    auto ringBuffer = createRingBuffer(ProducerType::Multi);
+    auto lease = ringBuffer->newClaimLease(4, m_filler);
+
+    auto first = lease->next();
+    auto second = lease->next();
+    (*lease)[second].value = 42;
+    lease->publish(second);
+
+    BOOST_CHECK_EQUAL(ringBuffer->isPublished(first), false);
+    BOOST_CHECK_EQUAL(ringBuffer->isPublished(second), true);
+    BOOST_CHECK_EQUAL((*ringBuffer)[second].value, 42);
+
+    lease->publish(first);
+
+    BOOST_CHECK_EQUAL(ringBuffer->isPublished(first), true);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldPublishUnusedSequencesOfTheLeaseAsFillerWhenFlushed)
+{
+    for (auto producerType : { ProducerType::Single, ProducerType::Multi })
+    {
+        auto ringBuffer = createRingBuffer(producerType);
+        auto lease = ringBuffer->newClaimLease(4, m_filler);
+
+        auto sequence = lease->next();
+        (*lease)[sequence].value = 7;
+        lease->publish(sequence);
+
+        lease->flush();
+
+        BOOST_CHECK_EQUAL(lease->remaining(), 0);
+        BOOST_CHECK_EQUAL((*ringBuffer)[0].value, 7);
+        for (auto i = 1; i < 4; ++i)
+        {
+            BOOST_CHECK_EQUAL(ringBuffer->isPublished(i), true);
+            BOOST_CHECK_EQUAL((*ringBuffer)[i].value, -1);
+        }
+
+        BOOST_CHECK_EQUAL(lease->next(), 4);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ShouldFlushTheLeaseWhenDestroyed)
+{
+    auto ringBuffer = createRingBuffer(ProducerType::Multi);
+
+    {
+        auto lease = ringBuffer->newClaimLease(8, m_filler);
+        lease->publish(lease->next());
+    }
+
+    BOOST_CHECK_EQUAL(ringBuffer->isPublished(7), true);
+    BOOST_CHECK_EQUAL((*ringBuffer)[7].value, -1);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldFlushAnExpiredLeaseBeforeHandingOutTheNextSequence)
+{
+    auto ringBuffer = createRingBuffer(ProducerType::Multi);
+    auto lease = ringBuffer->newClaimLease(4, m_filler, std::chrono::milliseconds(10));
+
+    lease->publish(lease->next());
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    BOOST_CHECK_EQUAL(lease->next(), 4);
+    BOOST_CHECK_EQUAL(ringBuffer->isPublished(3), true);
+    BOOST_CHECK_EQUAL((*ringBuffer)[1].value, -1);
+    BOOST_CHECK_EQUAL(lease->remaining(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldLetAnotherThreadReclaimTheExpiredLeaseOfAnIdlePublisher)
+{
+    auto ringBuffer = createRingBuffer(ProducerType::Multi);
+    auto lease = ringBuffer->newClaimLease(4, m_filler, std::chrono::milliseconds(10));
+
+    lease->publish(lease->next());
+
+    bool reclaimedBeforeExpiry = true;
+    bool reclaimed = false;
+    std::thread consumer([&]
+    {
+        reclaimedBeforeExpiry = lease->reclaimIfExpired();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        reclaimed = lease->reclaimIfExpired();
+    });
+    consumer.join();
+
+    BOOST_CHECK_EQUAL(reclaimedBeforeExpiry, false);
+    BOOST_CHECK_EQUAL(reclaimed, true);
+    for (auto i = 1; i < 4; ++i)
+        BOOST_CHECK_EQUAL(ringBuffer->isPublished(i), true);
+    BOOST_CHECK_EQUAL(lease->remaining(), 0);
+    BOOST_CHECK_EQUAL(lease->reclaimIfExpired(), false);
+
+    BOOST_CHECK_EQUAL(lease->next(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldNotThrowFromTheDestructorWhenTheFillerThrows)
+{
+    auto ringBuffer = createRingBuffer(ProducerType::Multi);
+
+    {
+        auto lease = ringBuffer->newClaimLease(4, std::make_shared< ThrowingFillerTranslator >());
+        lease->publish(lease->next());
+    }
+
+    BOOST_CHECK_EQUAL(ringBuffer->isPublished(0), true);
+    BOOST_CHECK_EQUAL(ringBuffer->isPublished(1), false);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectInvalidLeaseSize)
+{
+    auto ringBuffer = createRingBuffer(ProducerType::Single);
+
+    BOOST_CHECK_THROW(ringBuffer->newClaimLease(0, m_filler), ArgumentException);
+    BOOST_CHECK_THROW(ringBuffer->newClaimLease(33, m_filler), ArgumentException);
+    BOOST_CHECK_THROW(ringBuffer->newClaimLease(4, nullptr), ArgumentNullException);
+    BOOST_CHECK_THROW(ringBuffer->newClaimLease(4, m_filler, std::chrono::milliseconds(-1)), ArgumentException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
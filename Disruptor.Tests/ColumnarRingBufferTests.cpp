@@ -0,0 +1,122 @@
+#include "stdafx.h"
+
+#include <thread>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/ColumnarRingBuffer.h"
+#include "Disruptor/IBatchEventHandler.h"
+
+#include "Disruptor.TestTools/CountdownEvent.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    using TickEvent = ColumnarEvent< std::int64_t, double, std::int32_t >;
+    using TickRingBuffer = ColumnarRingBuffer< std::int64_t, double, std::int32_t >;
+
+    class PriceSumHandler : public IBatchEventHandler< TickEvent >
+    {
+    public:
+        explicit PriceSumHandler(std::int64_t lastSequence)
+            : m_lastSequence(lastSequence)
+        {
+        }
+
+        void onBatch(TickEvent* first, std::size_t count, std::int64_t firstSequence) override
+        {
+            auto prices = first->column< 1 >();
+            for (std::size_t i = 0; i < count; ++i)
+                sum += prices[i];
+
+            spanSizes.push_back(count);
+
+            if (firstSequence + static_cast< std::int64_t >(count) - 1 == m_lastSequence)
+                processed.signal();
+        }
+
+        double sum = 0;
+        std::vector< std::size_t > spanSizes;
+        CountdownEvent processed { 1 };
+
+    private:
+        std::int64_t m_lastSequence;
+    };
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(ColumnarRingBufferTests)
+
+BOOST_AUTO_TEST_CASE(ShouldStoreEachFieldInItsOwnColumn)
+{
+    auto ringBuffer = TickRingBuffer::createSingleProducer(8);
+
+    for (auto i = 0; i < 8; ++i)
+    {
+        auto sequence = ringBuffer->next();
+        auto& event = (*ringBuffer)[sequence];
+        event.get< 0 >() = i;
+        event.get< 1 >() = i * 0.5;
+        event.get< 2 >() = -i;
+        ringBuffer->publish(sequence);
+    }
+
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 7);
+    BOOST_CHECK_EQUAL((*ringBuffer)[5].get< 0 >(), 5);
+    BOOST_CHECK_EQUAL((*ringBuffer)[5].get< 1 >(), 2.5);
+    BOOST_CHECK_EQUAL(ringBuffer->get< 2 >(5), -5);
+    BOOST_CHECK_EQUAL((*ringBuffer)[13].index(), 5);
+
+    // The fields of consecutive events are contiguous
+    BOOST_CHECK_EQUAL((*ringBuffer)[2].column< 0 >() + 1, &(*ringBuffer)[3].get< 0 >());
+    BOOST_CHECK_EQUAL(ringBuffer->column< 1 >() + 4, &(*ringBuffer)[4].get< 1 >());
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectInvalidBufferSizes)
+{
+    BOOST_CHECK_THROW(TickRingBuffer::createSingleProducer(6), ArgumentException);
+    BOOST_CHECK_THROW(TickRingBuffer::createMultiProducer(0), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldDeliverSpansOverTheColumns)
+{
+    auto ringBuffer = TickRingBuffer::createSingleProducer(16);
+    auto handler = std::make_shared< PriceSumHandler >(17);
+    auto batchEventProcessor = std::make_shared< BatchEventProcessor< TickEvent > >(ringBuffer, ringBuffer->newBarrier(), handler);
+    ringBuffer->addGatingSequences({ batchEventProcessor->sequence() });
+
+    // Publishes 0..9, then 10..17 which wraps after 15
+    auto publish = [&](std::int32_t count)
+    {
+        auto hi = ringBuffer->next(count);
+        for (auto sequence = hi - count + 1; sequence <= hi; ++sequence)
+            ringBuffer->get< 1 >(sequence) = static_cast< double >(sequence);
+
+        ringBuffer->publish(hi - count + 1, hi);
+    };
+
+    std::thread thread([batchEventProcessor] { batchEventProcessor->run(); });
+
+    publish(10);
+    while (batchEventProcessor->sequence()->value() != 9)
+        std::this_thread::yield();
+
+    publish(8);
+
+    BOOST_CHECK_EQUAL(handler->processed.wait(std::chrono::seconds(1)), true);
+    batchEventProcessor->halt();
+    thread.join();
+
+    BOOST_CHECK_EQUAL(handler->sum, 17 * 18 / 2);
+    BOOST_CHECK((handler->spanSizes == std::vector< std::size_t > { 10, 6, 2 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,198 @@
+#include "stdafx.h"
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/BuildConfig.h"
+#include "Disruptor/CpuTopology.h"
+#include "Disruptor/InvalidOperationException.h"
+#include "Disruptor/ThreadHelper.h"
+#include "Disruptor/TopologyAwareTaskScheduler.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+# include <cstdlib>
+# include <fstream>
+# include <sys/stat.h>
+#endif
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    // Two nodes of two cores with two hyperthreads each, numbered like Linux does
+    CpuTopology twoNodeTopology()
+    {
+        return CpuTopology({ { 0, 0, 0, 0 }, { 1, 1, 0, 0 }, { 2, 0, 1, 1 }, { 3, 1, 1, 1 },
+                             { 4, 0, 0, 0 }, { 5, 1, 0, 0 }, { 6, 0, 1, 1 }, { 7, 1, 1, 1 } });
+    }
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+    class SysfsTree
+    {
+    public:
+        SysfsTree()
+        {
+            char path[] = "/tmp/DisruptorSysfsXXXXXX";
+            m_path = ::mkdtemp(path);
+        }
+
+        ~SysfsTree()
+        {
+            std::system(("rm -rf " + m_path).c_str());
+        }
+
+        void write(const std::string& relativePath, const std::string& content)
+        {
+            std::size_t separator = 0;
+            while ((separator = relativePath.find('/', separator + 1)) != std::string::npos)
+                ::mkdir((m_path + "/" + relativePath.substr(0, separator)).c_str(), 0755);
+
+            std::ofstream(m_path + "/" + relativePath) << content << std::endl;
+        }
+
+        const std::string& path() const
+        {
+            return m_path;
+        }
+
+    private:
+        std::string m_path;
+    };
+
+#endif
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(CpuTopologyTests)
+
+BOOST_AUTO_TEST_CASE(ShouldParseCpuLists)
+{
+    BOOST_CHECK((CpuTopology::parseCpuList("0-3,8,10-11\n") == std::vector< std::int32_t > { 0, 1, 2, 3, 8, 10, 11 }));
+    BOOST_CHECK((CpuTopology::parseCpuList(" 5 , 2 ") == std::vector< std::int32_t > { 5, 2 }));
+    BOOST_CHECK(CpuTopology::parseCpuList("").empty());
+
+    BOOST_CHECK_THROW(CpuTopology::parseCpuList("1-"), ArgumentException);
+    BOOST_CHECK_THROW(CpuTopology::parseCpuList("3-1"), ArgumentException);
+    BOOST_CHECK_THROW(CpuTopology::parseCpuList("a"), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldIdentifyHyperthreadSiblings)
+{
+    auto topology = twoNodeTopology();
+
+    BOOST_CHECK_EQUAL(topology.areSiblings(0, 4), true);
+    BOOST_CHECK_EQUAL(topology.areSiblings(0, 2), false);
+    BOOST_CHECK_EQUAL(topology.areSiblings(0, 0), false);
+    BOOST_CHECK_EQUAL(topology.areSiblings(0, 42), false);
+    BOOST_CHECK(topology.find(42) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldPlaceThreadsOnOneNodeAndDistinctCoresFirst)
+{
+    auto topology = twoNodeTopology();
+    std::vector< std::int32_t > allCpus { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+    // The siblings of the first node are used before the second node
+    BOOST_CHECK((topology.placementOrder(allCpus, true) == std::vector< std::int32_t > { 0, 1, 4, 5, 2, 3, 6, 7 }));
+    BOOST_CHECK((topology.placementOrder(allCpus, false) == std::vector< std::int32_t > { 0, 1, 4, 5, 2, 3, 6, 7 }));
+
+    // The node with the most allowed physical cores comes first
+    BOOST_CHECK((topology.placementOrder({ 1, 2, 3, 6, 7, 42 }, true) == std::vector< std::int32_t > { 2, 3, 6, 7, 1 }));
+}
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+BOOST_AUTO_TEST_CASE(ShouldReadTheTopologyFromSysfs)
+{
+    SysfsTree sysfs;
+    sysfs.write("cpu/online", "0-3");
+    sysfs.write("node/online", "0-1");
+    sysfs.write("node/node0/cpulist", "0,2");
+    sysfs.write("node/node1/cpulist", "1,3");
+
+    for (auto cpu = 0; cpu < 4; ++cpu)
+    {
+        auto topologyPath = "cpu/cpu" + std::to_string(cpu) + "/topology/";
+        sysfs.write(topologyPath + "core_id", std::to_string(cpu / 2));
+        sysfs.write(topologyPath + "physical_package_id", std::to_string(cpu % 2));
+    }
+
+    auto topology = CpuTopology::fromSysfs(sysfs.path());
+
+    BOOST_REQUIRE_EQUAL(topology.cpus().size(), 4u);
+    BOOST_CHECK_EQUAL(topology.find(3)->core, 1);
+    BOOST_CHECK_EQUAL(topology.find(3)->package, 1);
+    BOOST_CHECK_EQUAL(topology.find(3)->node, 1);
+    BOOST_CHECK_EQUAL(topology.areSiblings(0, 2), false);
+
+    BOOST_CHECK((topology.placementOrder({ 0, 1, 2, 3 }, true) == std::vector< std::int32_t > { 0, 2, 1, 3 }));
+}
+
+#endif
+
+BOOST_AUTO_TEST_CASE(ShouldPinThreadsFollowingThePlacement)
+{
+    TopologyAwareTaskScheduler taskScheduler;
+    auto placement = taskScheduler.placement();
+    BOOST_REQUIRE(!placement.empty());
+
+    BOOST_CHECK_THROW(taskScheduler.scheduleAndStart(std::packaged_task< void() >([] {})), InvalidOperationException);
+
+    taskScheduler.start(2);
+
+    auto taskAffinity = taskScheduler.scheduleAndStart(std::packaged_task< void() >([&]
+    {
+        BOOST_CHECK_EQUAL(ThreadHelper::getThreadAffinity().count(), 1u);
+        BOOST_CHECK_EQUAL(ThreadHelper::getThreadAffinity().test(placement[0]), true);
+    }));
+    taskAffinity.wait();
+
+    std::thread producer([&]
+    {
+        auto cpu = taskScheduler.pinCurrentThread();
+        BOOST_CHECK_EQUAL(cpu, placement[2 % placement.size()]);
+        BOOST_CHECK_EQUAL(ThreadHelper::getThreadAffinity().test(cpu), true);
+    });
+    producer.join();
+
+    taskScheduler.stop();
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRunTasksOnTheThreadsOfARestartedScheduler)
+{
+    TopologyAwareTaskScheduler taskScheduler;
+
+    taskScheduler.start(2);
+    taskScheduler.scheduleAndStart(std::packaged_task< void() >([] {})).wait();
+    taskScheduler.stop();
+
+    BOOST_CHECK_THROW(taskScheduler.scheduleAndStart(std::packaged_task< void() >([] {})), InvalidOperationException);
+
+    // Each task would be handed to a stopped thread if the threads of the first start were kept
+    taskScheduler.start(1);
+
+    std::vector< std::future< void > > tasks;
+    for (auto i = 0; i < 3; ++i)
+        tasks.push_back(taskScheduler.scheduleAndStart(std::packaged_task< void() >([] {})));
+
+    for (auto&& task : tasks)
+        BOOST_CHECK(task.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+    taskScheduler.stop();
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectCpuListsOutsideOfTheTopology)
+{
+    BOOST_CHECK_THROW(TopologyAwareTaskScheduler(twoNodeTopology(), { 42 }), ArgumentException);
+
+    TopologyAwareTaskScheduler taskScheduler(twoNodeTopology(), { 6, 1, 5 }, true);
+    BOOST_CHECK((taskScheduler.placement() == std::vector< std::int32_t > { 1, 5, 6 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -85,6 +85,26 @@ BOOST_AUTO_TEST_CASE(ShouldWaitOnAllProducersJoinedByAnd)
     ensureTwoEventsProcessedAccordingToDependencies(countDownLatch, { handler1, handler2 });
 }
 
+BOOST_AUTO_TEST_CASE(ShouldMakeEntriesAvailableToFunctionHandlers)
+{
+    auto countDownLatch = std::make_shared< CountdownEvent >(2);
+
+    m_disruptor->handleEventsWith([countDownLatch](TestEvent&, std::int64_t, bool) { countDownLatch->signal(); });
+
+    ensureTwoEventsProcessedAccordingToDependencies(countDownLatch);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldWaitUntilEventProcessorsProcessEventBeforeMakingItAvailableToDependentFunctionHandlers)
+{
+    auto eventHandler1 = createDelayedEventHandler();
+
+    auto countDownLatch = std::make_shared< CountdownEvent >(2);
+
+    m_disruptor->handleEventsWith(eventHandler1)->then([countDownLatch](TestEvent&, std::int64_t, bool) { countDownLatch->signal(); });
+
+    ensureTwoEventsProcessedAccordingToDependencies(countDownLatch, { eventHandler1 });
+}
+
 BOOST_AUTO_TEST_CASE(ShouldThrowExceptionIfHandlerIsNotAlreadyConsuming)
 {
     BOOST_CHECK_THROW(m_disruptor->after(createDelayedEventHandler())->handleEventsWith(createDelayedEventHandler()), ArgumentException);
@@ -0,0 +1,100 @@
+#include "stdafx.h"
+
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/FetchAndAddMultiProducerSequencer.h"
+#include "Disruptor/Sequence.h"
+
+#include "Disruptor.TestTools/ManualResetEvent.h"
+
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(FetchAndAddMultiProducerSequencerTests)
+
+BOOST_AUTO_TEST_CASE(ShouldClaimSequencesWithoutGating)
+{
+    auto sequencer = std::make_shared< FetchAndAddMultiProducerSequencer< int > >(16, std::make_shared< BlockingWaitStrategy >());
+
+    BOOST_CHECK_EQUAL(sequencer->next(), 0);
+    BOOST_CHECK_EQUAL(sequencer->next(5), 5);
+    BOOST_CHECK_EQUAL(sequencer->tryNext(), 6);
+    BOOST_CHECK_EQUAL(sequencer->cursor(), 6);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldOnlyMakePublishedSequencesAvailable)
+{
+    auto sequencer = std::make_shared< FetchAndAddMultiProducerSequencer< int > >(16, std::make_shared< BlockingWaitStrategy >());
+
+    auto hi = sequencer->next(6);
+    sequencer->publish(hi - 5, hi - 3);
+    sequencer->publish(hi);
+
+    BOOST_CHECK_EQUAL(sequencer->isAvailable(2), true);
+    BOOST_CHECK_EQUAL(sequencer->isAvailable(3), false);
+    BOOST_CHECK_EQUAL(sequencer->isAvailable(5), true);
+    BOOST_CHECK_EQUAL(sequencer->getHighestPublishedSequence(0, hi), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldHoldUpPublisherUntilClaimedSlotIsReleased)
+{
+    auto sequencer = std::make_shared< FetchAndAddMultiProducerSequencer< int > >(16, std::make_shared< BlockingWaitStrategy >());
+    auto gatingSequence = std::make_shared< Sequence >();
+    sequencer->addGatingSequences({ gatingSequence });
+
+    auto sequence = sequencer->next(16);
+    sequencer->publish(sequence - 15, sequence);
+
+    auto doneSignal = std::make_shared< ManualResetEvent >(false);
+    std::int64_t claimed = -1;
+
+    std::thread thread([&]
+    {
+        claimed = sequencer->next();
+        sequencer->publish(claimed);
+
+        doneSignal->set();
+    });
+
+    BOOST_CHECK_EQUAL(doneSignal->wait(std::chrono::milliseconds(50)), false);
+
+    gatingSequence->setValue(0);
+
+    BOOST_CHECK_EQUAL(doneSignal->wait(std::chrono::milliseconds(500)), true);
+    thread.join();
+
+    BOOST_CHECK_EQUAL(claimed, 16);
+    BOOST_CHECK_EQUAL(sequencer->isAvailable(16), true);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldClaimDistinctSequencesFromConcurrentPublishers)
+{
+    auto sequencer = std::make_shared< FetchAndAddMultiProducerSequencer< int > >(1024, std::make_shared< BlockingWaitStrategy >());
+
+    const auto publisherCount = 4;
+    const auto claimsPerPublisher = 200;
+
+    std::vector< std::thread > publishers;
+    for (auto i = 0; i < publisherCount; ++i)
+    {
+        publishers.emplace_back([&]
+        {
+            for (auto j = 0; j < claimsPerPublisher; ++j)
+            {
+                sequencer->publish(sequencer->next());
+            }
+        });
+    }
+
+    for (auto&& publisher : publishers)
+    {
+        publisher.join();
+    }
+
+    auto lastSequence = publisherCount * claimsPerPublisher - 1;
+    BOOST_CHECK_EQUAL(sequencer->cursor(), lastSequence);
+    BOOST_CHECK_EQUAL(sequencer->getHighestPublishedSequence(0, lastSequence), lastSequence);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
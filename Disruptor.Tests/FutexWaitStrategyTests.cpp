@@ -0,0 +1,79 @@
+#include "stdafx.h"
+
+#include "Disruptor/FutexWaitStrategy.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include "Disruptor/AlertException.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "StubEvent.h"
+#include "WaitStrategyTestUtil.h"
+
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(FutexWaitStrategyTests)
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForValue)
+{
+    assertWaitForWithDelayOf(50, std::make_shared< FutexWaitStrategy >());
+}
+
+BOOST_AUTO_TEST_CASE(ShouldWakeParkedConsumerWhenAlerted)
+{
+    auto ringBuffer = RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 16, std::make_shared< FutexWaitStrategy >());
+    auto barrier = ringBuffer->newBarrier();
+
+    std::atomic< bool > alerted { false };
+    std::thread consumer([&]
+    {
+        try
+        {
+            barrier->waitFor(0);
+        }
+        catch (AlertException&)
+        {
+            alerted = true;
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    barrier->alert();
+    consumer.join();
+
+    BOOST_CHECK_EQUAL(alerted, true);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldWakeParkedConsumersWhenPublished)
+{
+    auto ringBuffer = RingBuffer< StubEvent >::createMultiProducer(StubEvent::eventFactory(), 16, std::make_shared< FutexWaitStrategy >());
+
+    std::vector< std::int64_t > availableSequences(3, -1);
+    std::vector< std::thread > consumers;
+    for (auto i = 0u; i < availableSequences.size(); ++i)
+    {
+        auto barrier = ringBuffer->newBarrier();
+        consumers.emplace_back([&availableSequences, barrier, i] { availableSequences[i] = barrier->waitFor(1); });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ringBuffer->publish(ringBuffer->next());
+    ringBuffer->publish(ringBuffer->next());
+
+    for (auto&& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (auto&& availableSequence : availableSequences)
+    {
+        BOOST_CHECK_EQUAL(availableSequence, 1);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
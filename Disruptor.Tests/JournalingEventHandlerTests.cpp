@@ -0,0 +1,210 @@
+#include "stdafx.h"
+
+#include "Disruptor/JournalingEventHandler.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/InvalidOperationException.h"
+#include "Disruptor/JournalReplayer.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "LongEvent.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    struct JournalingEventHandlerFixture
+    {
+        JournalingEventHandlerFixture()
+        {
+            char directory[] = "/tmp/disruptor-tests-journal-XXXXXX";
+            m_directory = mkdtemp(directory);
+        }
+
+        ~JournalingEventHandlerFixture()
+        {
+            for (auto index : JournalSegment::list(m_directory))
+                std::remove(JournalSegment::path(m_directory, index).c_str());
+
+            rmdir(m_directory.c_str());
+        }
+
+        static std::shared_ptr< RingBuffer< LongEvent > > createRingBuffer(std::int32_t bufferSize)
+        {
+            return RingBuffer< LongEvent >::createSingleProducer([] { return LongEvent(); }, bufferSize);
+        }
+
+        static void journalValues(JournalingEventHandler< LongEvent >& handler, std::int64_t firstSequence, std::int64_t count)
+        {
+            for (auto sequence = firstSequence; sequence < firstSequence + count; ++sequence)
+            {
+                LongEvent event;
+                event.value = sequence * 10;
+                handler.onEvent(event, sequence, sequence == firstSequence + count - 1);
+            }
+        }
+
+        // Holds 4 events
+        std::size_t smallSegmentSize() const
+        {
+            return 64 + 4 * (sizeof(JournalSegment::RecordHeader) + sizeof(LongEvent));
+        }
+
+        std::string m_directory;
+    };
+
+    struct LargeJournalledEvent
+    {
+        std::int64_t values[4];
+    };
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_FIXTURE_TEST_SUITE(JournalingEventHandlerTests, JournalingEventHandlerFixture)
+
+BOOST_AUTO_TEST_CASE(ShouldJournalTheEventsOfABatchEventProcessor)
+{
+    auto ringBuffer = createRingBuffer(64);
+    auto handler = std::make_shared< JournalingEventHandler< LongEvent > >(m_directory);
+    auto processor = std::make_shared< BatchEventProcessor< LongEvent > >(ringBuffer, ringBuffer->newBarrier(), handler);
+    ringBuffer->addGatingSequences({ processor->sequence() });
+
+    std::thread processorThread([processor] { processor->run(); });
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        auto sequence = ringBuffer->next();
+        (*ringBuffer)[sequence].value = i;
+        ringBuffer->publish(sequence);
+    }
+
+    // Each batch is synced to the storage device, the processor can lag far behind the publisher
+    auto timeout = ClockConfig::Clock::now() + std::chrono::seconds(30);
+    while (processor->sequence()->value() != 999 && ClockConfig::Clock::now() < timeout)
+    {
+        std::this_thread::yield();
+    }
+    auto journalled = processor->sequence()->value() == 999;
+    processor->halt();
+    processorThread.join();
+
+    BOOST_REQUIRE_EQUAL(journalled, true);
+
+    auto replayRingBuffer = createRingBuffer(1024);
+    JournalReplayer< LongEvent > replayer(m_directory);
+
+    BOOST_CHECK_EQUAL(replayer.replay(*replayRingBuffer), 1000);
+    BOOST_CHECK_EQUAL(replayRingBuffer->cursor(), 999);
+
+    for (auto i = 0; i < 1000; ++i)
+        BOOST_CHECK_EQUAL((*replayRingBuffer)[i].value, i);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRollToANewSegmentWhenFull)
+{
+    JournalingEventHandler< LongEvent > handler(m_directory, smallSegmentSize(), JournalSyncPolicy::Periodic);
+    journalValues(handler, 0, 10);
+    handler.onShutdown();
+
+    BOOST_CHECK_EQUAL(JournalSegment::list(m_directory).size(), 3u);
+
+    auto replayRingBuffer = createRingBuffer(16);
+    JournalReplayer< LongEvent > replayer(m_directory, 3);
+
+    BOOST_CHECK_EQUAL(replayer.replay(*replayRingBuffer), 10);
+    for (auto i = 0; i < 10; ++i)
+        BOOST_CHECK_EQUAL((*replayRingBuffer)[i].value, i * 10);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldAppendToANewSegmentAfterARestart)
+{
+    {
+        JournalingEventHandler< LongEvent > handler(m_directory, smallSegmentSize(), JournalSyncPolicy::None);
+        journalValues(handler, 0, 3);
+    }
+
+    JournalingEventHandler< LongEvent > handler(m_directory, smallSegmentSize());
+    handler.onStart();
+    journalValues(handler, 3, 2);
+    handler.onShutdown();
+
+    auto indexes = JournalSegment::list(m_directory);
+    BOOST_REQUIRE_EQUAL(indexes.size(), 2u);
+    BOOST_CHECK_EQUAL(JournalSegment::open(m_directory, indexes[0], sizeof(LongEvent), alignof(LongEvent))->recordCount(), 3);
+    BOOST_CHECK_EQUAL(JournalSegment::open(m_directory, indexes[1], sizeof(LongEvent), alignof(LongEvent))->recordCount(), 2);
+
+    auto replayRingBuffer = createRingBuffer(16);
+    BOOST_CHECK_EQUAL(JournalReplayer< LongEvent >(m_directory).replay(*replayRingBuffer), 5);
+    BOOST_CHECK_EQUAL((*replayRingBuffer)[4].value, 40);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReplayFromASequence)
+{
+    JournalingEventHandler< LongEvent > handler(m_directory, smallSegmentSize());
+    journalValues(handler, 0, 10);
+
+    auto replayRingBuffer = createRingBuffer(16);
+    BOOST_CHECK_EQUAL(JournalReplayer< LongEvent >(m_directory).replay(*replayRingBuffer, 6), 4);
+    BOOST_CHECK_EQUAL((*replayRingBuffer)[0].value, 60);
+    BOOST_CHECK_EQUAL((*replayRingBuffer)[3].value, 90);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldStopTheReplayAtTheFirstRecordWhichDoesNotVerify)
+{
+    {
+        JournalingEventHandler< LongEvent > handler(m_directory, smallSegmentSize());
+        journalValues(handler, 0, 10);
+        handler.onShutdown();
+    }
+
+    // The event of sequence 5, the second record of the second segment, is torn
+    auto indexes = JournalSegment::list(m_directory);
+    BOOST_REQUIRE_EQUAL(indexes.size(), 3u);
+    {
+        std::fstream file(JournalSegment::path(m_directory, indexes[1]), std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(64 + (sizeof(JournalSegment::RecordHeader) + sizeof(LongEvent)) + sizeof(JournalSegment::RecordHeader));
+        file.put(static_cast< char >(0xff));
+    }
+
+    auto segment = JournalSegment::open(m_directory, indexes[1], sizeof(LongEvent), alignof(LongEvent));
+    BOOST_CHECK_EQUAL(segment->recordCount(), 1);
+    BOOST_CHECK_EQUAL(segment->isCorrupted(), true);
+    BOOST_CHECK_EQUAL(JournalSegment::open(m_directory, indexes[0], sizeof(LongEvent), alignof(LongEvent))->isCorrupted(), false);
+
+    // The events of the third segment are not replayed after the gap
+    auto replayRingBuffer = createRingBuffer(16);
+    BOOST_CHECK_EQUAL(JournalReplayer< LongEvent >(m_directory).replay(*replayRingBuffer), 5);
+    BOOST_CHECK_EQUAL((*replayRingBuffer)[4].value, 40);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectAJournalOfAnotherEventType)
+{
+    JournalingEventHandler< LongEvent > handler(m_directory);
+    journalValues(handler, 0, 1);
+
+    auto replayRingBuffer = RingBuffer< LargeJournalledEvent >::createSingleProducer([] { return LargeJournalledEvent(); }, 16);
+
+    BOOST_CHECK_THROW(JournalReplayer< LargeJournalledEvent >(m_directory).replay(*replayRingBuffer), InvalidOperationException);
+    BOOST_CHECK_THROW(JournalingEventHandler< LongEvent >(m_directory, 32).onStart(), InvalidOperationException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -21,7 +21,7 @@ BOOST_AUTO_TEST_CASE(ShouldTimeoutWaitFor)
     auto cursor = std::make_shared< Sequence >(5);
     const auto& dependent = cursor;
 
-    EXPECT_CALL(*sequenceBarrierMock, checkAlert()).Times(testing::AtLeast(1));
+    EXPECT_CALL(*sequenceBarrierMock, isAlerted()).Times(testing::AtLeast(1));
 
     auto t0 = ClockConfig::Clock::now();
 
@@ -0,0 +1,192 @@
+#include "stdafx.h"
+
+#include <thread>
+
+#include "Disruptor/ArgumentOutOfRangeException.h"
+#include "Disruptor/BuildConfig.h"
+#include "Disruptor/MemoryPlacement.h"
+#include "Disruptor/RingBuffer.h"
+
+#include "Disruptor.Tests/LongEvent.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+# include <fstream>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    void publishAndCheck(RingBuffer< LongEvent >& ringBuffer, std::int64_t count)
+    {
+        for (auto i = 0; i < count; ++i)
+        {
+            auto sequence = ringBuffer.next();
+            ringBuffer[sequence].value = i * 3;
+            ringBuffer.publish(sequence);
+        }
+
+        for (auto i = 0; i < count; ++i)
+        {
+            BOOST_CHECK_EQUAL(ringBuffer[i].value, i * 3);
+        }
+    }
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+    // Size of the mapping holding the address, from /proc/self/maps
+    std::size_t mappingBytes(const void* memory)
+    {
+        auto address = reinterpret_cast< std::uintptr_t >(memory);
+
+        std::ifstream maps("/proc/self/maps");
+        std::string line;
+        while (std::getline(maps, line))
+        {
+            auto separator = line.find('-');
+            auto first = std::stoull(line.substr(0, separator), nullptr, 16);
+            auto last = std::stoull(line.substr(separator + 1), nullptr, 16);
+
+            if (address >= first && address < last)
+                return static_cast< std::size_t >(last - first);
+        }
+
+        return 0;
+    }
+
+#endif
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(MemoryPlacementTests)
+
+BOOST_AUTO_TEST_CASE(ShouldRejectInvalidPlacements)
+{
+    BOOST_CHECK_THROW(MemoryPlacement::bindToNode(-1), ArgumentOutOfRangeException);
+    BOOST_CHECK_THROW(MemoryPlacement::firstTouchFromCpu(-1), ArgumentOutOfRangeException);
+    BOOST_CHECK_THROW(MemoryPlacement::firstTouchFromCpu(64), ArgumentOutOfRangeException);
+
+    BOOST_CHECK(MemoryPlacement().isDefault());
+    BOOST_CHECK(MemoryPlacement::bindToNode(0) != MemoryPlacement());
+    BOOST_CHECK(MemoryPlacement::firstTouchFromCpu(0) == MemoryPlacement::firstTouchFromCpu(0));
+    BOOST_CHECK(MemoryPlacement().withHugePages() != MemoryPlacement());
+    BOOST_CHECK(MemoryPlacement().withHugePages(MemoryPlacement::PageSize::Default).isDefault());
+}
+
+BOOST_AUTO_TEST_CASE(ShouldCreateEntriesFromTheFirstTouchThread)
+{
+    auto callerThreadId = std::this_thread::get_id();
+    std::int32_t eventsCreatedByCaller = 0;
+
+    auto ringBuffer = RingBuffer< LongEvent >::create(ProducerType::Single,
+                                                      [&] { eventsCreatedByCaller += std::this_thread::get_id() == callerThreadId; return LongEvent(); },
+                                                      16,
+                                                      std::make_shared< BlockingWaitStrategy >(),
+                                                      MemoryPlacement::firstTouchFromCpu(0));
+
+    BOOST_CHECK_EQUAL(eventsCreatedByCaller, 0);
+    publishAndCheck(*ringBuffer, 16);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRethrowExceptionsOfTheFirstTouchThread)
+{
+    BOOST_CHECK_THROW(MemoryPlacement::firstTouchFromCpu(0).touch([] { throw std::runtime_error("touch"); }), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldPublishWithPlacedMultiProducerSequencers)
+{
+    for (auto producerType : { ProducerType::Multi, ProducerType::MultiFetchAndAdd })
+    {
+        auto ringBuffer = RingBuffer< LongEvent >::create(producerType,
+                                                          [] { return LongEvent(); },
+                                                          16,
+                                                          std::make_shared< BlockingWaitStrategy >(),
+                                                          MemoryPlacement::firstTouchFromCpu(0));
+
+        publishAndCheck(*ringBuffer, 16);
+        BOOST_CHECK_EQUAL(ringBuffer->isPublished(15), true);
+        BOOST_CHECK_EQUAL(ringBuffer->isPublished(16), false);
+    }
+}
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+BOOST_AUTO_TEST_CASE(ShouldBindEntriesToTheNode)
+{
+    if (!MemoryPlacement::isNodeBindingSupported())
+        return;
+
+    auto ringBuffer = RingBuffer< LongEvent >::create(ProducerType::Multi,
+                                                      [] { return LongEvent(); },
+                                                      1024,
+                                                      std::make_shared< BlockingWaitStrategy >(),
+                                                      MemoryPlacement::bindToNode(0));
+
+    // MPOL_F_ADDR returns the policy of the mapping holding the address, MPOL_BIND is 2
+    int mode = -1;
+    unsigned long nodeMask = 0;
+    BOOST_REQUIRE_EQUAL(::syscall(SYS_get_mempolicy, &mode, &nodeMask, 8 * sizeof(nodeMask), &(*ringBuffer)[0], 2), 0);
+    BOOST_CHECK_EQUAL(mode, 2);
+    BOOST_CHECK_EQUAL(nodeMask, 1UL);
+
+    publishAndCheck(*ringBuffer, 16);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldAlignHugePageAllocationsOnTheHugePageSize)
+{
+    auto placement = MemoryPlacement::firstTouchFromCpu(0).withHugePages();
+    const std::size_t size = 3 * 1024 * 1024;
+
+    placement.touch([&]
+    {
+        auto memory = static_cast< char* >(placement.allocate(size));
+        BOOST_CHECK_EQUAL(reinterpret_cast< std::uintptr_t >(memory) % (2 * 1024 * 1024), 0u);
+
+        memory[0] = 1;
+        memory[size - 1] = 1;
+        placement.deallocate(memory, size);
+    });
+}
+
+BOOST_AUTO_TEST_CASE(ShouldUseDefaultPagesForAllocationsSmallerThanAHugePage)
+{
+    const std::size_t size = 64 * 1024;
+
+    for (auto pageSize : { MemoryPlacement::PageSize::Huge2MB, MemoryPlacement::PageSize::Huge1GB })
+    {
+        auto placement = MemoryPlacement().withHugePages(pageSize);
+
+        auto memory = static_cast< char* >(placement.allocate(size));
+        BOOST_CHECK_LT(mappingBytes(memory), 2u * 1024 * 1024);
+
+        memory[size - 1] = 1;
+        placement.deallocate(memory, size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ShouldPublishWithHugePages)
+{
+    for (auto producerType : { ProducerType::Single, ProducerType::Multi })
+    {
+        auto ringBuffer = RingBuffer< LongEvent >::create(producerType,
+                                                          [] { return LongEvent(); },
+                                                          1024,
+                                                          std::make_shared< BlockingWaitStrategy >(),
+                                                          MemoryPlacement().withHugePages());
+
+        publishAndCheck(*ringBuffer, 1024);
+    }
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,4 +26,61 @@ BOOST_AUTO_TEST_CASE(ShouldOnlyAllowMessagesToBeAvailableIfSpecificallyPublished
     BOOST_CHECK_EQUAL(publisher->isAvailable(6), false);
 }
 
+BOOST_AUTO_TEST_CASE(ShouldReturnHighestPublishedSequenceBeforeFirstGap)
+{
+    auto waitingStrategy = std::make_shared< BlockingWaitStrategy >();
+    auto publisher = std::make_shared< MultiProducerSequencer< int > >(1024, waitingStrategy);
+
+    for (auto sequence = 0; sequence <= 40; ++sequence)
+    {
+        if (sequence != 13 && sequence != 30)
+            publisher->publish(sequence);
+    }
+
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(0, 40), 12);
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(14, 40), 29);
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(31, 40), 40);
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(13, 40), 12);
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(41, 60), 40);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReturnHighestPublishedSequenceAcrossRingWrap)
+{
+    auto waitingStrategy = std::make_shared< BlockingWaitStrategy >();
+    auto publisher = std::make_shared< MultiProducerSequencer< int > >(16, waitingStrategy);
+
+    for (auto sequence = 0; sequence < 16; ++sequence)
+    {
+        publisher->publish(sequence);
+    }
+
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(10, 25), 15);
+
+    for (auto sequence = 16; sequence <= 25; ++sequence)
+    {
+        if (sequence != 22)
+            publisher->publish(sequence);
+    }
+
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(10, 25), 21);
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(23, 25), 25);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldMakeWholeRangeAvailableWhenPublishingBatchAcrossRingWrap)
+{
+    auto waitingStrategy = std::make_shared< BlockingWaitStrategy >();
+    auto publisher = std::make_shared< MultiProducerSequencer< int > >(16, waitingStrategy);
+
+    publisher->publish(0, 11);
+    publisher->publish(12, 19);
+
+    BOOST_CHECK_EQUAL(publisher->isAvailable(3), false);
+    for (auto sequence = 4; sequence <= 19; ++sequence)
+    {
+        BOOST_CHECK_EQUAL(publisher->isAvailable(sequence), true);
+    }
+    BOOST_CHECK_EQUAL(publisher->isAvailable(20), false);
+    BOOST_CHECK_EQUAL(publisher->getHighestPublishedSequence(4, 30), 19);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
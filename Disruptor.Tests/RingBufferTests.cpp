@@ -1,10 +1,39 @@
 #include "stdafx.h"
 
+#include <boost/mpl/vector.hpp>
+
+#include "Disruptor/BusySpinWaitStrategy.h"
+#include "Disruptor/MultiProducerSequencer.h"
+#include "Disruptor/SingleProducerSequencer.h"
+
 #include "Disruptor.TestTools/ManualResetEvent.h"
 
 #include "RingBufferTestsFixture.h"
 
 
+namespace Disruptor
+{
+namespace Tests
+{
+
+    class CountingBusySpinWaitStrategy : public BusySpinWaitStrategy
+    {
+    public:
+        void signalAllWhenBlocking() override
+        {
+            ++signalCount;
+        }
+
+        std::int32_t signalCount = 0;
+    };
+
+    class DerivedSequence : public Sequence
+    {
+    };
+
+} // namespace Tests
+} // namespace Disruptor
+
 using namespace Disruptor;
 using namespace Disruptor::Tests;
 
@@ -96,6 +125,37 @@ BOOST_AUTO_TEST_CASE(ShouldPreventWrapping)
     BOOST_CHECK_EQUAL(ringBuffer->tryPublishEvent(StubEvent::translator(), 3, std::string("3")), false);
 }
 
+BOOST_AUTO_TEST_CASE(ShouldPreventWrappingWithGroupedGatingSequences)
+{
+    for (auto producerType : { ProducerType::Single, ProducerType::Multi })
+    {
+        auto ringBuffer = RingBuffer< StubEvent >::create(producerType, [] { return StubEvent(-1); }, 4, std::make_shared< BlockingWaitStrategy >());
+        ringBuffer->setGatingSequenceGroupSize(2);
+
+        std::vector< std::shared_ptr< ISequence > > sequences;
+        for (auto i = 0; i < 5; ++i)
+            sequences.push_back(std::make_shared< Sequence >());
+        ringBuffer->addGatingSequences(sequences);
+
+        for (auto i = 0; i < 4; ++i)
+            ringBuffer->publish(ringBuffer->next());
+
+        BOOST_CHECK_EQUAL(ringBuffer->hasAvailableCapacity(1), false);
+
+        for (auto i = 0; i < 4; ++i)
+            sequences[i]->setValue(3);
+
+        BOOST_CHECK_EQUAL(ringBuffer->hasAvailableCapacity(1), false);
+        BOOST_CHECK_EQUAL(ringBuffer->getMinimumGatingSequence(), -1);
+
+        sequences[4]->setValue(0);
+
+        BOOST_CHECK_EQUAL(ringBuffer->hasAvailableCapacity(1), true);
+        BOOST_CHECK_EQUAL(ringBuffer->hasAvailableCapacity(2), false);
+        BOOST_CHECK_EQUAL(ringBuffer->getMinimumGatingSequence(), 0);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(ShouldThrowExceptionIfBufferIsFull)
 {
     m_ringBuffer->addGatingSequences({ std::make_shared< Sequence >(m_ringBuffer->bufferSize()) });
@@ -737,4 +797,57 @@ BOOST_AUTO_TEST_CASE(ShouldHandleResetToAndNotWrapUnecessarilyMultiProducer)
     assertHandleResetAndNotWrap(RingBuffer< StubEvent >::createMultiProducer(StubEvent::eventFactory(), 4));
 }
 
+typedef boost::mpl::vector
+<
+    SingleProducerSequencer< StubEvent, BusySpinWaitStrategy >,
+    MultiProducerSequencer< StubEvent, BusySpinWaitStrategy >
+>
+StaticSequencerTypes;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ShouldClaimPublishAndWrapWithStaticSequencer, TSequencer, StaticSequencerTypes)
+{
+    auto ringBuffer = RingBuffer< StubEvent, TSequencer >::create(StubEvent::eventFactory(), 4, std::make_shared< BusySpinWaitStrategy >());
+    auto sequenceBarrier = ringBuffer->newBarrier();
+    auto gatingSequence = std::make_shared< Sequence >();
+    ringBuffer->addGatingSequences({ gatingSequence });
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        auto sequence = ringBuffer->next();
+        (*ringBuffer)[sequence].value(i);
+        ringBuffer->publish(sequence);
+
+        BOOST_CHECK_EQUAL(sequenceBarrier->waitFor(sequence), sequence);
+        BOOST_CHECK_EQUAL((*ringBuffer)[sequence].value(), i);
+
+        gatingSequence->setValue(sequence);
+    }
+
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 9L);
+    BOOST_CHECK_EQUAL(ringBuffer->tryPublishEvent(StubEvent::translator(), 10, std::string()), true);
+    BOOST_CHECK_EQUAL((*ringBuffer)[10].value(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldCallTheOverridesOfStrategiesAndSequencesDerivedFromTheLibrary)
+{
+    auto waitStrategy = std::make_shared< CountingBusySpinWaitStrategy >();
+    auto ringBuffer = RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 4, waitStrategy);
+    auto gatingSequence = std::make_shared< DerivedSequence >();
+    ringBuffer->addGatingSequences({ gatingSequence });
+
+    ringBuffer->publish(ringBuffer->next());
+    gatingSequence->setValue(0);
+
+    BOOST_CHECK_EQUAL(waitStrategy->signalCount, 1);
+    BOOST_CHECK_EQUAL(ringBuffer->getMinimumGatingSequence(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectADerivedWaitStrategyForAStaticSequencer)
+{
+    typedef SingleProducerSequencer< StubEvent, BusySpinWaitStrategy > StaticSequencer;
+
+    BOOST_CHECK_THROW((RingBuffer< StubEvent, StaticSequencer >::create(StubEvent::eventFactory(), 4, std::shared_ptr< BusySpinWaitStrategy >(std::make_shared< CountingBusySpinWaitStrategy >()))),
+                      ArgumentException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,155 @@
+#include "stdafx.h"
+
+#include "Disruptor/AlertException.h"
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/FunctionEventHandler.h"
+#include "Disruptor/RingBuffer.h"
+#include "Disruptor/SelectiveBlockingWaitStrategy.h"
+
+#include "LongEvent.h"
+#include "StubEvent.h"
+#include "WaitStrategyTestUtil.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    struct SelectiveBlockingWaitStrategyFixture
+    {
+        SelectiveBlockingWaitStrategyFixture()
+            : m_waitStrategy(std::make_shared< SelectiveBlockingWaitStrategy >())
+            , m_ringBuffer(RingBuffer< StubEvent >::createSingleProducer(StubEvent::eventFactory(), 16, m_waitStrategy))
+        {
+        }
+
+        static void waitUntilParked(WaitQueue& waitQueue)
+        {
+            while (waitQueue.waiterCount() == 0)
+                std::this_thread::yield();
+        }
+
+        std::shared_ptr< SelectiveBlockingWaitStrategy > m_waitStrategy;
+        std::shared_ptr< RingBuffer< StubEvent > > m_ringBuffer;
+    };
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+using LongEventFunctionHandler = FunctionEventHandler< LongEvent, std::function< void(LongEvent&, std::int64_t, bool) > >;
+
+
+BOOST_FIXTURE_TEST_SUITE(SelectiveBlockingWaitStrategyTests, SelectiveBlockingWaitStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForValue)
+{
+    assertWaitForWithDelayOf(50, std::make_shared< SelectiveBlockingWaitStrategy >());
+}
+
+BOOST_AUTO_TEST_CASE(ShouldParkOnTheSequenceOfTheUpstreamProcessor)
+{
+    auto upstreamSequence = std::make_shared< Sequence >();
+    auto upstreamWaitQueue = m_ringBuffer->newBarrier()->registerDependentSequence(upstreamSequence);
+    BOOST_REQUIRE(upstreamWaitQueue != nullptr);
+
+    auto barrier = m_ringBuffer->newBarrier({ upstreamSequence });
+
+    std::int64_t availableSequence = -1;
+    std::thread consumer([&] { availableSequence = barrier->waitFor(0); });
+
+    waitUntilParked(*upstreamWaitQueue);
+
+    m_ringBuffer->publish(m_ringBuffer->next());
+
+    // The publisher does not wake the barriers gated on processors
+    BOOST_CHECK_EQUAL(upstreamWaitQueue->waiterCount(), 1);
+
+    upstreamSequence->setValue(0);
+    upstreamWaitQueue->wakeAll();
+    consumer.join();
+
+    BOOST_CHECK_EQUAL(availableSequence, 0);
+    BOOST_CHECK_EQUAL(upstreamWaitQueue->waiterCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldWakeBarriersParkedOnUpstreamProcessorsWhenAlerted)
+{
+    auto upstreamSequence = std::make_shared< Sequence >();
+    auto upstreamWaitQueue = m_ringBuffer->newBarrier()->registerDependentSequence(upstreamSequence);
+    auto barrier = m_ringBuffer->newBarrier({ upstreamSequence });
+
+    std::atomic< bool > alerted { false };
+    std::thread consumer([&]
+    {
+        try
+        {
+            barrier->waitFor(0);
+        }
+        catch (AlertException&)
+        {
+            alerted = true;
+        }
+    });
+
+    waitUntilParked(*upstreamWaitQueue);
+    barrier->alert();
+    consumer.join();
+
+    BOOST_CHECK_EQUAL(alerted, true);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldProcessAllEventsThroughAPipeline)
+{
+    const auto iterations = 1000;
+    const auto stageCount = 3;
+
+    auto ringBuffer = RingBuffer< LongEvent >::createSingleProducer([] { return LongEvent(); }, 16, std::make_shared< SelectiveBlockingWaitStrategy >());
+
+    std::vector< std::int64_t > sums(stageCount, 0);
+    std::vector< std::shared_ptr< BatchEventProcessor< LongEvent > > > stages;
+    for (auto stageIndex = 0; stageIndex < stageCount; ++stageIndex)
+    {
+        auto barrier = stages.empty() ? ringBuffer->newBarrier() : ringBuffer->newBarrier({ stages.back()->sequence() });
+        auto handler = std::make_shared< LongEventFunctionHandler >([&sums, stageIndex](LongEvent& evt, std::int64_t, bool) { sums[stageIndex] += evt.value; });
+
+        stages.push_back(std::make_shared< BatchEventProcessor< LongEvent > >(ringBuffer, barrier, handler));
+    }
+    ringBuffer->addGatingSequences({ stages.back()->sequence() });
+
+    std::vector< std::thread > threads;
+    for (auto&& stage : stages)
+    {
+        threads.emplace_back([stage] { stage->run(); });
+    }
+
+    for (auto i = 0; i < iterations; ++i)
+    {
+        auto sequence = ringBuffer->next();
+        (*ringBuffer)[sequence].value = i;
+        ringBuffer->publish(sequence);
+    }
+
+    while (stages.back()->sequence()->value() < iterations - 1)
+        std::this_thread::yield();
+
+    for (auto&& stage : stages)
+    {
+        stage->halt();
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto&& sum : sums)
+    {
+        BOOST_CHECK_EQUAL(sum, iterations * (iterations - 1) / 2);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
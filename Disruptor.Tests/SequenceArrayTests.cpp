@@ -0,0 +1,244 @@
+#include "stdafx.h"
+
+#include <atomic>
+#include <thread>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/AtomicSequenceArray.h"
+#include "Disruptor/FixedSequenceGroup.h"
+#include "Disruptor/ICursored.h"
+#include "Disruptor/ReaderEpochs.h"
+#include "Disruptor/Sequence.h"
+#include "Disruptor/SequenceArray.h"
+#include "Disruptor/SequenceGroups.h"
+
+
+using namespace Disruptor;
+
+
+namespace
+{
+
+    class StubCursored : public ICursored
+    {
+    public:
+        explicit StubCursored(std::int64_t cursor)
+            : m_cursor(cursor)
+        {
+        }
+
+        std::int64_t cursor() const override
+        {
+            return m_cursor;
+        }
+
+    private:
+        std::int64_t m_cursor;
+    };
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE(SequenceArrayTests)
+
+BOOST_AUTO_TEST_CASE(ShouldReturnDefaultMinimumWhenEmpty)
+{
+    SequenceArray sequences;
+
+    BOOST_CHECK_EQUAL(sequences.empty(), true);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(), std::numeric_limits< std::int64_t >::max());
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(12), 12);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReturnMinimumOfSequencesAndSequenceGroups)
+{
+    auto group = std::make_shared< FixedSequenceGroup >(std::vector< std::shared_ptr< ISequence > > { std::make_shared< Sequence >(7), std::make_shared< Sequence >(5) });
+    SequenceArray sequences({ std::make_shared< Sequence >(11), group, std::make_shared< Sequence >(9) });
+
+    BOOST_CHECK_EQUAL(sequences.size(), 3u);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(), 5);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(3), 3);
+    BOOST_CHECK(sequences.sequences()[1] == group);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReturnMinimumOfGroupedSequences)
+{
+    auto group = std::make_shared< FixedSequenceGroup >(std::vector< std::shared_ptr< ISequence > > { std::make_shared< Sequence >(12) });
+    SequenceArray sequences({ std::make_shared< Sequence >(11), std::make_shared< Sequence >(9), group, std::make_shared< Sequence >(10) }, 2);
+
+    BOOST_CHECK_EQUAL(sequences.groupSize(), 2);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(), 9);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(100, 9), 9);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(100, 10), 9);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(8, 0), 8);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReturnCachedMinimumWhileItIsNotBehindRequiredSequence)
+{
+    std::vector< std::shared_ptr< ISequence > > values { std::make_shared< Sequence >(5), std::make_shared< Sequence >(6), std::make_shared< Sequence >(7), std::make_shared< Sequence >(8) };
+    SequenceArray sequences(values, 2);
+
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(100, 4), 5);
+
+    for (auto&& value : values)
+        value->setValue(20);
+
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(100, 4), 5);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(100, 10), 20);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldOnlyReadGroupsUntilOneIsBehindRequiredSequence)
+{
+    std::vector< std::shared_ptr< ISequence > > values { std::make_shared< Sequence >(5), std::make_shared< Sequence >(6), std::make_shared< Sequence >(7), std::make_shared< Sequence >(8) };
+    SequenceArray sequences(values, 2);
+
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(100, 4), 5);
+
+    values[0]->setValue(9);
+    values[1]->setValue(30);
+    values[2]->setValue(30);
+    values[3]->setValue(30);
+
+    // The second group keeps its cached minimum, which is still a lower bound
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(100, 10), 7);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(), 9);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldOnlyReplaceTheExpectedArray)
+{
+    AtomicSequenceArray sequences;
+    auto initial = sequences.sequences();
+
+    BOOST_CHECK_EQUAL(sequences.compareAndSet(initial, { std::make_shared< Sequence >(4) }), true);
+    BOOST_CHECK_EQUAL(sequences.compareAndSet(initial, { std::make_shared< Sequence >(2) }), false);
+
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(10), 4);
+    BOOST_CHECK_EQUAL(initial.empty(), true);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldAddAndRemoveSequencesOfAtomicArray)
+{
+    AtomicSequenceArray sequences;
+    auto first = std::make_shared< Sequence >();
+    auto second = std::make_shared< Sequence >();
+
+    SequenceGroups::addSequences(sequences, StubCursored(6), { first, second });
+
+    BOOST_CHECK_EQUAL(sequences.sequences().size(), 2u);
+    BOOST_CHECK_EQUAL(first->value(), 6);
+
+    first->setValue(8);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(10), 6);
+
+    BOOST_CHECK_EQUAL(SequenceGroups::removeSequence(sequences, second), true);
+    BOOST_CHECK_EQUAL(SequenceGroups::removeSequence(sequences, second), false);
+    BOOST_CHECK_EQUAL(sequences.sequences().size(), 1u);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(10), 8);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldKeepSequencesWhenChangingGroupSize)
+{
+    AtomicSequenceArray sequences;
+    SequenceGroups::addSequences(sequences, StubCursored(3), { std::make_shared< Sequence >(), std::make_shared< Sequence >() });
+
+    sequences.setGroupSize(4);
+
+    BOOST_CHECK_EQUAL(sequences.groupSize(), 4);
+    BOOST_CHECK_EQUAL(sequences.sequences().size(), 2u);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(10, 3), 3);
+
+    SequenceGroups::addSequences(sequences, StubCursored(5), { std::make_shared< Sequence >() });
+
+    BOOST_CHECK_EQUAL(sequences.groupSize(), 4);
+    BOOST_CHECK_THROW(sequences.setGroupSize(-1), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReleaseTheSequencesOfReplacedArrays)
+{
+    AtomicSequenceArray sequences;
+    auto removed = std::make_shared< Sequence >();
+    std::weak_ptr< Sequence > weakRemoved = removed;
+
+    SequenceGroups::addSequences(sequences, StubCursored(2), { removed, std::make_shared< Sequence >() });
+    sequences.setGroupSize(4);
+    SequenceGroups::removeSequence(sequences, removed);
+    removed.reset();
+
+    BOOST_CHECK_EQUAL(weakRemoved.expired(), true);
+    BOOST_CHECK_EQUAL(sequences.minimumSequence(10), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReadTheSequencesWhileTheyAreReplaced)
+{
+    AtomicSequenceArray sequences;
+    auto gating = std::make_shared< Sequence >(5);
+    SequenceGroups::addSequences(sequences, StubCursored(5), { gating });
+
+    std::atomic< bool > running { true };
+    std::atomic< bool > consistent { true };
+    std::thread reader([&]
+    {
+        while (running)
+        {
+            if (sequences.minimumSequence(10) != 5)
+                consistent = false;
+        }
+    });
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        auto added = std::make_shared< Sequence >();
+        SequenceGroups::addSequences(sequences, StubCursored(5), { added });
+        SequenceGroups::removeSequence(sequences, added);
+    }
+
+    running = false;
+    reader.join();
+
+    BOOST_CHECK_EQUAL(consistent, true);
+    BOOST_CHECK_EQUAL(sequences.sequences().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForTheThreadsInAReadSection)
+{
+    std::atomic< bool > isReading { false };
+    std::atomic< bool > hasLeft { false };
+
+    std::thread reader([&]
+    {
+        auto& epoch = ReaderEpochs::currentReader();
+        epoch.enter();
+        isReading = true;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        hasLeft = true;
+        epoch.exit();
+    });
+
+    while (!isReading)
+        std::this_thread::yield();
+
+    ReaderEpochs::synchronize();
+    auto hasLeftWhenSynchronized = hasLeft.load();
+    reader.join();
+
+    BOOST_CHECK_EQUAL(hasLeftWhenSynchronized, true);
+
+    // The reader thread is unregistered once it has exited
+    ReaderEpochs::synchronize();
+}
+
+BOOST_AUTO_TEST_CASE(ShouldShrinkVectorWhenRemovingSequence)
+{
+    auto first = std::make_shared< Sequence >();
+    auto second = std::make_shared< Sequence >();
+    std::vector< std::shared_ptr< ISequence > > sequences { first, second, first };
+
+    BOOST_CHECK_EQUAL(SequenceGroups::removeSequence(sequences, first), true);
+
+    BOOST_CHECK_EQUAL(sequences.size(), 1u);
+    BOOST_CHECK(sequences[0] == second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
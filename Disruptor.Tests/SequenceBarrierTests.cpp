@@ -140,4 +140,33 @@ BOOST_AUTO_TEST_CASE(ShouldSetAndClearAlertStatus)
     BOOST_CHECK_EQUAL(sequenceBarrier->isAlerted(), false);
 }
 
+BOOST_AUTO_TEST_CASE(ShouldReportAvailableSequenceAndAlertAsStatus)
+{
+    const std::int32_t expectedNumberMessages = 10;
+    fillRingBuffer(expectedNumberMessages);
+
+    auto sequenceBarrier = m_ringBuffer->newBarrier();
+
+    auto result = sequenceBarrier->tryWaitFor(5);
+    BOOST_CHECK(result.status == SequenceWaitStatus::Available);
+    BOOST_CHECK_EQUAL(result.sequence, expectedNumberMessages - 1);
+
+    sequenceBarrier->alert();
+
+    BOOST_CHECK(sequenceBarrier->tryWaitFor(5).status == SequenceWaitStatus::Alerted);
+    BOOST_CHECK_THROW(sequenceBarrier->waitFor(5), AlertException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReportAlertRaisedDuringWaitAsStatus)
+{
+    auto sequenceBarrier = m_ringBuffer->newBarrier();
+
+    auto future = std::async(std::launch::async, [=] { return sequenceBarrier->tryWaitFor(0); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    sequenceBarrier->alert();
+
+    BOOST_CHECK(future.get().status == SequenceWaitStatus::Alerted);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
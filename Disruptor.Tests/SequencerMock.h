@@ -21,6 +21,7 @@ namespace Tests
         
         MOCK_METHOD1(addGatingSequences, void(const std::vector< std::shared_ptr< ISequence > >& gatingSequences));
         MOCK_METHOD1(removeGatingSequence, bool(const std::shared_ptr< ISequence >& sequence));
+        MOCK_METHOD1(setGatingSequenceGroupSize, void(std::int32_t groupSize));
 
         MOCK_METHOD1(newBarrier, std::shared_ptr< ISequenceBarrier >(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack));
         MOCK_METHOD0(getMinimumSequence, std::int64_t());
@@ -0,0 +1,193 @@
+#include "stdafx.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/FunctionEventHandler.h"
+#include "Disruptor/ShardedDisruptor.h"
+#include "Disruptor/ShardedEventProcessor.h"
+#include "Disruptor/ShardedRingBuffer.h"
+
+#include "LongEvent.h"
+#include "StubExecutor.h"
+
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+using LongEventFunctionHandler = FunctionEventHandler< LongEvent, std::function< void(LongEvent&, std::int64_t, bool) > >;
+
+
+namespace
+{
+
+    bool waitUntil(const std::function< bool() >& condition)
+    {
+        auto timeout = ClockConfig::Clock::now() + std::chrono::seconds(10);
+        while (!condition() && ClockConfig::Clock::now() < timeout)
+        {
+            std::this_thread::yield();
+        }
+        return condition();
+    }
+
+} // namespace
+
+
+BOOST_AUTO_TEST_SUITE(ShardedRingBufferTests)
+
+BOOST_AUTO_TEST_CASE(ShouldCreateOneSingleProducerShardPerPublisher)
+{
+    auto ringBuffer = ShardedRingBuffer< LongEvent >::create([] { return LongEvent(); }, 3, 16);
+
+    BOOST_CHECK_EQUAL(ringBuffer->shardCount(), 3);
+    BOOST_CHECK_EQUAL(ringBuffer->shardBufferSize(), 16);
+    BOOST_CHECK(ringBuffer->shard(0) != ringBuffer->shard(2));
+
+    BOOST_CHECK_THROW(ringBuffer->shard(3), ArgumentOutOfRangeException);
+    BOOST_CHECK_THROW(ShardedRingBuffer< LongEvent >::create([] { return LongEvent(); }, 0, 16), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldGateEachShardOnItsOwnSequence)
+{
+    auto ringBuffer = ShardedRingBuffer< LongEvent >::create([] { return LongEvent(); }, 2, 4);
+    auto processor = std::make_shared< ShardedEventProcessor< LongEvent > >(ringBuffer, std::make_shared< LongEventFunctionHandler >([](LongEvent&, std::int64_t, bool) {}));
+    ringBuffer->addGatingSequences(processor->shardSequences());
+
+    auto& shard = *ringBuffer->shard(0);
+    shard.publish(shard.next(4));
+
+    BOOST_CHECK_EQUAL(shard.hasAvailableCapacity(1), false);
+    BOOST_CHECK_EQUAL(ringBuffer->shard(1)->hasAvailableCapacity(4), true);
+
+    BOOST_CHECK_EQUAL(ringBuffer->removeGatingSequences(processor->shardSequences()), true);
+    BOOST_CHECK_EQUAL(ringBuffer->removeGatingSequences(processor->shardSequences()), false);
+    BOOST_CHECK_THROW(ringBuffer->addGatingSequences({ processor->sequence() }), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldDeliverEventsOfAllShardsWithMergedSequences)
+{
+    auto ringBuffer = ShardedRingBuffer< LongEvent >::create([] { return LongEvent(); }, 3, 8);
+
+    std::vector< std::int64_t > values;
+    std::vector< std::int64_t > sequences;
+    auto processor = std::make_shared< ShardedEventProcessor< LongEvent > >(ringBuffer, std::make_shared< LongEventFunctionHandler >([&](LongEvent& evt, std::int64_t sequence, bool)
+    {
+        values.push_back(evt.value);
+        sequences.push_back(sequence);
+    }));
+    ringBuffer->addGatingSequences(processor->shardSequences());
+
+    for (auto shardIndex = 0; shardIndex < 3; ++shardIndex)
+    {
+        auto& shard = *ringBuffer->shard(shardIndex);
+        for (auto i = 0; i < 2; ++i)
+        {
+            auto sequence = shard.next();
+            shard[sequence].value = shardIndex * 10 + i;
+            shard.publish(sequence);
+        }
+    }
+
+    std::thread thread([&] { processor->run(); });
+    while (processor->sequence()->value() < 5)
+        std::this_thread::yield();
+
+    processor->halt();
+    thread.join();
+
+    BOOST_CHECK((values == std::vector< std::int64_t > { 0, 1, 10, 11, 20, 21 }));
+    BOOST_CHECK((sequences == std::vector< std::int64_t > { 0, 1, 2, 3, 4, 5 }));
+    for (auto&& shardSequence : processor->shardSequences())
+    {
+        BOOST_CHECK_EQUAL(shardSequence->value(), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ShouldParkWhenNoShardHasEventsUntilAnEventIsPublished)
+{
+    auto ringBuffer = ShardedRingBuffer< LongEvent >::create([] { return LongEvent(); }, 2, 8);
+
+    std::atomic< std::int64_t > lastValue { -1 };
+    auto processor = std::make_shared< ShardedEventProcessor< LongEvent > >(ringBuffer, std::make_shared< LongEventFunctionHandler >([&](LongEvent& evt, std::int64_t, bool)
+    {
+        lastValue = evt.value;
+    }));
+    ringBuffer->addGatingSequences(processor->shardSequences());
+
+    std::thread thread([&] { processor->run(); });
+    auto parked = waitUntil([&] { return ringBuffer->publicationQueue().waiterCount() == 1; });
+
+    auto& shard = *ringBuffer->shard(1);
+    auto sequence = shard.next();
+    shard[sequence].value = 42;
+    shard.publish(sequence);
+
+    auto delivered = waitUntil([&] { return lastValue == 42; });
+    auto parkedAgain = waitUntil([&] { return ringBuffer->publicationQueue().waiterCount() == 1; });
+
+    processor->halt();
+    thread.join();
+
+    BOOST_CHECK_EQUAL(parked, true);
+    BOOST_CHECK_EQUAL(delivered, true);
+    BOOST_CHECK_EQUAL(parkedAgain, true);
+    BOOST_CHECK_EQUAL(ringBuffer->publicationQueue().waiterCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldProcessEventsFromConcurrentPublishersThroughTheDsl)
+{
+    const auto publisherCount = 3;
+    const auto iterations = 1000;
+
+    auto executor = std::make_shared< StubExecutor >();
+    auto disruptor = std::make_shared< shardedDisruptor< LongEvent > >([] { return LongEvent(); }, publisherCount, 16, executor);
+
+    std::vector< std::int64_t > sums(publisherCount, 0);
+    std::int64_t count = 0;
+    disruptor->handleEventsWith([&](LongEvent& evt, std::int64_t, bool)
+    {
+        sums[evt.value % publisherCount] += evt.value;
+        ++count;
+    });
+
+    auto ringBuffer = disruptor->start();
+
+    std::vector< std::thread > publishers;
+    for (auto publisherIndex = 0; publisherIndex < publisherCount; ++publisherIndex)
+    {
+        publishers.emplace_back([&, publisherIndex]
+        {
+            auto& shard = *ringBuffer->shard(publisherIndex);
+            for (auto i = 0; i < iterations; ++i)
+            {
+                auto sequence = shard.next();
+                shard[sequence].value = i * publisherCount + publisherIndex;
+                shard.publish(sequence);
+            }
+        });
+    }
+
+    for (auto&& publisher : publishers)
+    {
+        publisher.join();
+    }
+
+    disruptor->shutdown();
+    executor->joinAllThreads();
+
+    BOOST_CHECK_EQUAL(count, publisherCount * iterations);
+    for (auto publisherIndex = 0; publisherIndex < publisherCount; ++publisherIndex)
+    {
+        std::int64_t expected = 0;
+        for (auto i = 0; i < iterations; ++i)
+            expected += i * publisherCount + publisherIndex;
+
+        BOOST_CHECK_EQUAL(sums[publisherIndex], expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
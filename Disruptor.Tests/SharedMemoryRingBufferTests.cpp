@@ -0,0 +1,314 @@
+#include "stdafx.h"
+
+#include "Disruptor/SharedMemoryRingBuffer.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Disruptor/BatchEventProcessor.h"
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/InvalidOperationException.h"
+
+#include "Disruptor.TestTools/CountdownEvent.h"
+
+#include "LongEvent.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    std::string sharedMemoryName(const std::string& testName)
+    {
+        std::ostringstream stream;
+        stream << "/disruptor-tests-" << getpid() << "-" << testName;
+        return stream.str();
+    }
+
+    struct LargeEvent
+    {
+        std::int64_t values[4];
+    };
+
+    class SummingEventHandler : public IEventHandler< LongEvent >
+    {
+    public:
+        explicit SummingEventHandler(std::int64_t expectedCount)
+            : m_expectedCount(expectedCount)
+        {
+        }
+
+        void onEvent(LongEvent& event, std::int64_t /*sequence*/, bool /*endOfBatch*/) override
+        {
+            sum += event.value;
+
+            if (++count == m_expectedCount)
+                allReceived.signal();
+        }
+
+        std::int64_t sum = 0;
+        std::int64_t count = 0;
+        CountdownEvent allReceived { 1 };
+
+    private:
+        std::int64_t m_expectedCount;
+    };
+
+    void publishValues(SharedMemoryRingBuffer< LongEvent >& ringBuffer, std::int64_t firstValue, std::int64_t count)
+    {
+        for (auto value = firstValue; value < firstValue + count; ++value)
+        {
+            auto sequence = ringBuffer.next();
+            ringBuffer[sequence].value = value;
+            ringBuffer.publish(sequence);
+        }
+    }
+
+    // Run function in a child process, function ends it with _exit() so that, like a crashed process, it does not release what it holds
+    template <class TFunction>
+    pid_t runInChildProcess(TFunction function)
+    {
+        auto processId = fork();
+        if (processId == 0)
+        {
+            try
+            {
+                function();
+            }
+            catch (...)
+            {
+            }
+
+            _exit(2);
+        }
+
+        return processId;
+    }
+
+    std::int32_t waitForChildProcess(pid_t processId)
+    {
+        std::int32_t status = 0;
+        waitpid(processId, &status, 0);
+
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(SharedMemoryRingBufferTests)
+
+BOOST_AUTO_TEST_CASE(ShouldDeliverEventsToAnAttachedBatchEventProcessor)
+{
+    auto name = sharedMemoryName("batch");
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 16);
+
+    // A second mapping of the region, as in a consumer process
+    auto consumerRingBuffer = SharedMemoryRingBuffer< LongEvent >::attach(name);
+    BOOST_CHECK_EQUAL(consumerRingBuffer->isProducer(), false);
+    BOOST_CHECK_EQUAL(consumerRingBuffer->isProducerAlive(), true);
+
+    auto handler = std::make_shared< SummingEventHandler >(1000);
+    auto processor = std::make_shared< BatchEventProcessor< LongEvent > >(consumerRingBuffer, consumerRingBuffer->newBarrier(), handler);
+    BOOST_CHECK_EQUAL(ringBuffer->consumerCount(), 1);
+
+    std::thread processorThread([processor] { processor->run(); });
+
+    publishValues(*ringBuffer, 0, 1000);
+
+    BOOST_CHECK_EQUAL(handler->allReceived.wait(std::chrono::seconds(5)), true);
+    BOOST_CHECK_EQUAL(handler->sum, 999 * 1000 / 2);
+
+    // The processor parks on the futex word of the region once idle
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    processor->halt();
+    processorThread.join();
+
+    BOOST_CHECK_EQUAL(processor->sequence()->value(), 999);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldDeliverEventsFromMultipleProducerThreads)
+{
+    auto name = sharedMemoryName("multi");
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Multi, 16);
+    auto consumerRingBuffer = SharedMemoryRingBuffer< LongEvent >::attach(name);
+
+    auto handler = std::make_shared< SummingEventHandler >(2000);
+    auto processor = std::make_shared< BatchEventProcessor< LongEvent > >(consumerRingBuffer, consumerRingBuffer->newBarrier(), handler);
+
+    std::thread processorThread([processor] { processor->run(); });
+
+    std::thread firstProducer([ringBuffer] { publishValues(*ringBuffer, 0, 1000); });
+    std::thread secondProducer([ringBuffer] { publishValues(*ringBuffer, 1000, 1000); });
+    firstProducer.join();
+    secondProducer.join();
+
+    BOOST_CHECK_EQUAL(handler->allReceived.wait(std::chrono::seconds(5)), true);
+    BOOST_CHECK_EQUAL(handler->sum, 1999 * 2000 / 2);
+
+    processor->halt();
+    processorThread.join();
+}
+
+BOOST_AUTO_TEST_CASE(ShouldDeliverEventsToAnotherProcess)
+{
+    const std::int64_t eventCount = 10000;
+
+    auto name = sharedMemoryName("process");
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 64);
+
+    auto consumerProcessId = runInChildProcess([&]
+    {
+        auto consumerRingBuffer = SharedMemoryRingBuffer< LongEvent >::attach(name);
+        auto poller = consumerRingBuffer->newPoller();
+
+        std::int64_t sum = 0;
+        std::int64_t count = 0;
+        while (count < eventCount && consumerRingBuffer->isProducerAlive())
+        {
+            poller->poll([&](LongEvent& event, std::int64_t, bool)
+            {
+                sum += event.value;
+                ++count;
+                return true;
+            });
+        }
+
+        _exit(sum == (eventCount - 1) * eventCount / 2 ? 0 : 1);
+    });
+
+    auto timeout = ClockConfig::Clock::now() + std::chrono::seconds(10);
+    while (ringBuffer->consumerCount() != 1 && ClockConfig::Clock::now() < timeout)
+    {
+        std::this_thread::yield();
+    }
+    BOOST_REQUIRE_EQUAL(ringBuffer->consumerCount(), 1);
+
+    // The producer gates on the sequence of the poller of the child process
+    publishValues(*ringBuffer, 0, eventCount);
+
+    BOOST_CHECK_EQUAL(waitForChildProcess(consumerProcessId), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReleaseTheSlotOfACrashedConsumer)
+{
+    auto name = sharedMemoryName("consumer-crash");
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 4, 8, std::chrono::milliseconds(10));
+
+    // The child process exits without releasing its slot
+    auto consumerProcessId = runInChildProcess([&]
+    {
+        auto poller = SharedMemoryRingBuffer< LongEvent >::attach(name)->newPoller();
+        _exit(poller != nullptr ? 0 : 1);
+    });
+
+    BOOST_CHECK_EQUAL(waitForChildProcess(consumerProcessId), 0);
+    BOOST_CHECK_EQUAL(ringBuffer->consumerCount(), 1);
+
+    // The ring is full after 4 events, the slot is released while waiting for the consumer
+    publishValues(*ringBuffer, 0, 8);
+
+    BOOST_CHECK_EQUAL(ringBuffer->consumerCount(), 0);
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldReportTimeoutOnceTheProducerHasCrashed)
+{
+    auto name = sharedMemoryName("producer-crash");
+
+    // The child process exits without destroying its ring buffer
+    auto producerProcessId = runInChildProcess([&]
+    {
+        auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 16);
+        publishValues(*ringBuffer, 0, 2);
+        _exit(0);
+    });
+
+    BOOST_REQUIRE_EQUAL(waitForChildProcess(producerProcessId), 0);
+
+    {
+        auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::attach(name, std::chrono::milliseconds(10));
+        BOOST_CHECK_EQUAL(ringBuffer->isProducerAlive(), false);
+        BOOST_CHECK_EQUAL(ringBuffer->cursor(), 1);
+        BOOST_CHECK_EQUAL((*ringBuffer)[1].value, 1);
+
+        auto barrier = ringBuffer->newBarrier();
+        BOOST_CHECK(barrier->tryWaitFor(2).status == SequenceWaitStatus::TimedOut);
+    }
+
+    // A new producer replaces the region of the crashed one
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 16);
+    BOOST_CHECK_EQUAL(ringBuffer->cursor(), -1);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldNotReplaceTheRingBufferOfARunningProducer)
+{
+    auto name = sharedMemoryName("running");
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 16);
+
+    BOOST_CHECK_THROW(SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 16), InvalidOperationException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectAttachingWithAnotherEntryType)
+{
+    auto name = sharedMemoryName("layout");
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 16);
+
+    BOOST_CHECK_THROW(SharedMemoryRingBuffer< LargeEvent >::attach(name), InvalidOperationException);
+    BOOST_CHECK_THROW(SharedMemoryRingBuffer< LongEvent >::attach(sharedMemoryName("missing")), InvalidOperationException);
+    BOOST_CHECK_THROW(SharedMemoryRingBuffer< LongEvent >::attach(name)->next(), InvalidOperationException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForTheProducerToInitializeTheRingBuffer)
+{
+    auto name = sharedMemoryName("initializing");
+    auto layout = SharedMemoryLayout::create(name, ProducerType::Single, 16, 8, sizeof(LongEvent), alignof(LongEvent));
+
+    BOOST_CHECK_THROW(SharedMemoryRingBuffer< LongEvent >::attach(name, std::chrono::milliseconds(100), std::chrono::milliseconds(20)), InvalidOperationException);
+
+    std::shared_ptr< SharedMemoryRingBuffer< LongEvent > > consumerRingBuffer;
+    std::thread consumerThread([&]
+    {
+        try
+        {
+            consumerRingBuffer = SharedMemoryRingBuffer< LongEvent >::attach(name);
+        }
+        catch (InvalidOperationException&)
+        {
+        }
+    });
+
+    // Longer than the spins and the yields of a SpinWait
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    layout->markReady();
+    consumerThread.join();
+
+    BOOST_CHECK(consumerRingBuffer != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldUnlinkTheRegionWhenTheProducerIsDestroyed)
+{
+    auto name = sharedMemoryName("unlink");
+    auto ringBuffer = SharedMemoryRingBuffer< LongEvent >::create(name, ProducerType::Single, 16);
+    auto consumerRingBuffer = SharedMemoryRingBuffer< LongEvent >::attach(name);
+
+    ringBuffer.reset();
+
+    BOOST_CHECK_EQUAL(consumerRingBuffer->isProducerAlive(), false);
+    BOOST_CHECK_EQUAL(SharedMemoryRegion::unlink(name), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -21,7 +21,7 @@ BOOST_AUTO_TEST_CASE(ShouldTimeoutWaitFor)
     auto cursor = std::make_shared< Sequence >(5);
     const auto& dependent = cursor;
 
-    EXPECT_CALL(*sequenceBarrierMock, checkAlert()).Times(testing::AtLeast(1));
+    EXPECT_CALL(*sequenceBarrierMock, isAlerted()).Times(testing::AtLeast(1));
 
     auto t0 = ClockConfig::Clock::now();
 
@@ -41,4 +41,20 @@ BOOST_AUTO_TEST_CASE(ShouldTimeoutWaitFor)
     BOOST_CHECK(timeWaiting >= theTimeout);
 }
 
+BOOST_AUTO_TEST_CASE(ShouldReportTimeoutAsStatus)
+{
+    auto sequenceBarrierMock = std::make_shared< testing::NiceMock< Tests::SequenceBarrierMock > >();
+
+    auto waitStrategy = std::make_shared< TimeoutBlockingWaitStrategy >(std::chrono::milliseconds(50));
+    auto cursor = std::make_shared< Sequence >(5);
+    const auto& dependent = cursor;
+
+    auto result = waitStrategy->tryWaitFor(6, *cursor, *dependent, *sequenceBarrierMock);
+    BOOST_CHECK(result.status == SequenceWaitStatus::TimedOut);
+
+    result = waitStrategy->tryWaitFor(5, *cursor, *dependent, *sequenceBarrierMock);
+    BOOST_CHECK(result.status == SequenceWaitStatus::Available);
+    BOOST_CHECK_EQUAL(result.sequence, 5);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,47 @@
+#include "stdafx.h"
+
+#include "Disruptor/TimeoutFutexWaitStrategy.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include "Disruptor/Sequence.h"
+#include "Disruptor/TimeoutException.h"
+
+#include "SequenceBarrierMock.h"
+#include "WaitStrategyTestUtil.h"
+
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(TimeoutFutexWaitStrategyTests)
+
+BOOST_AUTO_TEST_CASE(ShouldWaitForValue)
+{
+    assertWaitForWithDelayOf(50, std::make_shared< TimeoutFutexWaitStrategy >(std::chrono::seconds(5)));
+}
+
+BOOST_AUTO_TEST_CASE(ShouldTimeoutWaitFor)
+{
+    auto sequenceBarrierMock = std::make_shared< testing::NiceMock< SequenceBarrierMock > >();
+
+    auto theTimeout = std::chrono::milliseconds(500);
+    auto waitStrategy = std::make_shared< TimeoutFutexWaitStrategy >(theTimeout);
+    auto cursor = std::make_shared< Sequence >(5);
+    const auto& dependent = cursor;
+
+    EXPECT_CALL(*sequenceBarrierMock, isAlerted()).Times(testing::AtLeast(1));
+
+    auto t0 = ClockConfig::Clock::now();
+
+    BOOST_CHECK_THROW(waitStrategy->waitFor(6, *cursor, *dependent, *sequenceBarrierMock), TimeoutException);
+
+    auto t1 = ClockConfig::Clock::now();
+
+    BOOST_CHECK(t1 - t0 >= theTimeout);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,104 @@
+#include "stdafx.h"
+
+#include "Disruptor/WorkStealingDeque.h"
+
+
+using namespace Disruptor;
+
+
+BOOST_AUTO_TEST_SUITE(WorkStealingDequeTests)
+
+BOOST_AUTO_TEST_CASE(ShouldPopTheMostRecentItemAndStealTheOldest)
+{
+    WorkStealingDeque< int > deque(4);
+    int items[] = { 0, 1, 2 };
+
+    BOOST_CHECK(deque.pop() == nullptr);
+    BOOST_CHECK(deque.steal() == nullptr);
+
+    for (auto&& item : items)
+        deque.push(&item);
+
+    BOOST_CHECK_EQUAL(deque.size(), 3);
+    BOOST_CHECK_EQUAL(deque.pop(), &items[2]);
+    BOOST_CHECK_EQUAL(deque.steal(), &items[0]);
+    BOOST_CHECK_EQUAL(deque.pop(), &items[1]);
+    BOOST_CHECK(deque.pop() == nullptr);
+    BOOST_CHECK(deque.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ShouldGrowWhenFull)
+{
+    WorkStealingDeque< int > deque(2);
+    std::vector< int > items(10);
+
+    deque.push(&items[0]);
+    BOOST_CHECK_EQUAL(deque.steal(), &items[0]);
+
+    for (auto&& item : items)
+        deque.push(&item);
+
+    BOOST_CHECK_EQUAL(deque.capacity(), 16);
+    for (auto&& item : items)
+        BOOST_CHECK_EQUAL(deque.steal(), &item);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRejectInvalidCapacity)
+{
+    BOOST_CHECK_THROW(WorkStealingDeque< int >(0), ArgumentException);
+    BOOST_CHECK_THROW(WorkStealingDeque< int >(12), ArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldHandEachItemToASingleThread)
+{
+    const auto itemCount = 100000;
+    const auto thiefCount = 2;
+
+    WorkStealingDeque< int > deque(8);
+    std::vector< int > items(itemCount);
+    std::vector< std::atomic< std::int32_t > > takenCounts(itemCount);
+    std::atomic< bool > pushing { true };
+
+    auto take = [&](int* item) { takenCounts[item - items.data()].fetch_add(1); };
+
+    std::vector< std::thread > thieves;
+    for (auto i = 0; i < thiefCount; ++i)
+    {
+        thieves.emplace_back([&]
+        {
+            while (pushing || !deque.empty())
+            {
+                auto item = deque.steal();
+                if (item != nullptr)
+                    take(item);
+            }
+        });
+    }
+
+    for (auto i = 0; i < itemCount; ++i)
+    {
+        deque.push(&items[i]);
+
+        if (i % 3 == 0)
+        {
+            auto item = deque.pop();
+            if (item != nullptr)
+                take(item);
+        }
+    }
+
+    pushing = false;
+    for (auto&& thief : thieves)
+        thief.join();
+
+    while (auto item = deque.pop())
+        take(item);
+
+    auto allTakenOnce = true;
+    for (auto&& takenCount : takenCounts)
+        allTakenOnce &= takenCount == 1;
+
+    BOOST_CHECK(allTakenOnce);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
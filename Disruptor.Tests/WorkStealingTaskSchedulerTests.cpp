@@ -0,0 +1,157 @@
+#include "stdafx.h"
+
+#include "Disruptor/BasicExecutor.h"
+#include "Disruptor/FatalExceptionHandler.h"
+#include "Disruptor/WorkerPool.h"
+#include "Disruptor/WorkStealingTaskScheduler.h"
+
+#include "LongEvent.h"
+
+
+namespace Disruptor
+{
+namespace Tests
+{
+
+    class FanOutWorkHandler : public IWorkHandler< LongEvent >
+    {
+    public:
+        FanOutWorkHandler(const std::shared_ptr< WorkStealingTaskScheduler >& taskScheduler, std::atomic< std::int64_t >& sum)
+            : m_taskScheduler(taskScheduler)
+            , m_sum(sum)
+        {
+        }
+
+        void onEvent(LongEvent& evt) override
+        {
+            BOOST_CHECK(m_taskScheduler->isWorkerThread());
+
+            auto value = evt.value;
+            m_taskScheduler->scheduleAndStart(std::packaged_task< void() >([this, value] { m_sum += value; }));
+        }
+
+    private:
+        std::shared_ptr< WorkStealingTaskScheduler > m_taskScheduler;
+        std::atomic< std::int64_t >& m_sum;
+    };
+
+    /**
+     * Run a WorkerPool of 2 FanOutWorkHandlers on the scheduler, and return the sum of the values of 1 to 100 added by their jobs
+     */
+    std::int64_t sumOfFanOutJobs(const std::shared_ptr< WorkStealingTaskScheduler >& taskScheduler)
+    {
+        std::atomic< std::int64_t > sum { 0 };
+        WorkerPool< LongEvent > pool
+        (
+            [] { return LongEvent(); },
+            std::make_shared< FatalExceptionHandler< LongEvent > >(),
+            { std::make_shared< FanOutWorkHandler >(taskScheduler, sum), std::make_shared< FanOutWorkHandler >(taskScheduler, sum) }
+        );
+
+        auto ringBuffer = pool.start(std::make_shared< BasicExecutor >(taskScheduler));
+
+        for (auto i = 1; i <= 100; ++i)
+        {
+            auto sequence = ringBuffer->next();
+            (*ringBuffer)[sequence].value = i;
+            ringBuffer->publish(sequence);
+        }
+
+        auto timeout = ClockConfig::Clock::now() + std::chrono::seconds(10);
+        while (sum < 5050 && ClockConfig::Clock::now() < timeout)
+            std::this_thread::yield();
+
+        pool.drainAndHalt();
+
+        return sum;
+    }
+
+} // namespace Tests
+} // namespace Disruptor
+
+using namespace Disruptor;
+using namespace Disruptor::Tests;
+
+
+BOOST_AUTO_TEST_SUITE(WorkStealingTaskSchedulerTests)
+
+BOOST_AUTO_TEST_CASE(ShouldRunScheduledTasks)
+{
+    auto taskScheduler = std::make_shared< WorkStealingTaskScheduler >();
+    BOOST_CHECK_THROW(taskScheduler->start(0), ArgumentOutOfRangeException);
+
+    taskScheduler->start(2);
+    BOOST_CHECK_EQUAL(taskScheduler->isWorkerThread(), false);
+
+    std::atomic< std::int32_t > count { 0 };
+    std::vector< std::future< void > > futures;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        futures.push_back(taskScheduler->scheduleAndStart(std::packaged_task< void() >([&] { ++count; })));
+    }
+
+    for (auto&& future : futures)
+        future.wait();
+
+    BOOST_CHECK_EQUAL(count, 1000);
+
+    taskScheduler->stop();
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRunTasksScheduledBeforeStart)
+{
+    auto taskScheduler = std::make_shared< WorkStealingTaskScheduler >();
+
+    auto future = taskScheduler->scheduleAndStart(std::packaged_task< void() >([] { throw std::runtime_error("failed"); }));
+    taskScheduler->start(1);
+
+    BOOST_CHECK_THROW(future.get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRunTasksScheduledFromWorkerThreads)
+{
+    auto taskScheduler = std::make_shared< WorkStealingTaskScheduler >();
+    taskScheduler->start(2);
+
+    std::atomic< std::int32_t > count { 0 };
+    taskScheduler->scheduleAndStart(std::packaged_task< void() >([&]
+    {
+        for (auto i = 0; i < 100; ++i)
+        {
+            taskScheduler->scheduleAndStart(std::packaged_task< void() >([&] { ++count; }));
+        }
+    }));
+
+    auto timeout = ClockConfig::Clock::now() + std::chrono::seconds(10);
+    while (count < 100 && ClockConfig::Clock::now() < timeout)
+        std::this_thread::yield();
+
+    BOOST_CHECK_EQUAL(count, 100);
+
+    taskScheduler->stop();
+}
+
+BOOST_AUTO_TEST_CASE(ShouldRunJobsScheduledFromWorkHandlers)
+{
+    auto taskScheduler = std::make_shared< WorkStealingTaskScheduler >();
+    taskScheduler->start(3);
+
+    BOOST_CHECK_EQUAL(sumOfFanOutJobs(taskScheduler), 5050);
+
+    taskScheduler->stop();
+}
+
+BOOST_AUTO_TEST_CASE(ShouldStartASpareThreadWhenEachThreadRunsAWorkHandler)
+{
+    auto taskScheduler = std::make_shared< WorkStealingTaskScheduler >();
+    taskScheduler->start(2);
+
+    // Both threads run a WorkProcessor which never returns, the fan-out jobs can only run on a spare thread
+    BOOST_CHECK_EQUAL(sumOfFanOutJobs(taskScheduler), 5050);
+    BOOST_CHECK_GT(taskScheduler->threadCount(), 2);
+    BOOST_CHECK_LE(taskScheduler->threadCount(), 4);
+
+    taskScheduler->stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
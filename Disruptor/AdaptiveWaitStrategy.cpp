@@ -0,0 +1,289 @@
+#include "stdafx.h"
+#include "AdaptiveWaitStrategy.h"
+
+#include <algorithm>
+#include <ostream>
+
+#include "ArgumentException.h"
+#include "ArgumentNullException.h"
+#include "BlockingWaitStrategy.h"
+#include "BuildConfig.h"
+#include "FutexWaitStrategy.h"
+#include "ISequence.h"
+#include "ISequenceBarrier.h"
+#include "LiteBlockingWaitStrategy.h"
+#include "SpinPolicy.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    std::atomic< std::uint64_t > nextStrategyId { 1 };
+
+    IWaitStrategy& requireParkingStrategy(const std::shared_ptr< IWaitStrategy >& parkingStrategy)
+    {
+        if (parkingStrategy == nullptr)
+            DISRUPTOR_THROW_ARGUMENT_NULL_EXCEPTION(parkingStrategy);
+
+        return *parkingStrategy;
+    }
+
+} // namespace
+
+
+    AdaptiveWaitStrategy::AdaptiveWaitStrategy(const std::shared_ptr< IWaitStrategy >& parkingStrategy, std::int32_t minSpinTries, std::int32_t maxSpinTries)
+        : m_parkingStrategy(parkingStrategy)
+        , m_parkingStrategyRef(requireParkingStrategy(parkingStrategy))
+        , m_minSpinTries(minSpinTries)
+        , m_maxSpinTries(maxSpinTries)
+        , m_initialSpinTries(std::min(std::max(10000, minSpinTries), maxSpinTries))
+        , m_id(nextStrategyId.fetch_add(1))
+    {
+        if (minSpinTries < 1)
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("minSpinTries must be greater than 0");
+
+        if (maxSpinTries < minSpinTries)
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("maxSpinTries must not be less than minSpinTries (" << maxSpinTries << " < " << minSpinTries << ")");
+    }
+
+    std::shared_ptr< AdaptiveWaitStrategy > AdaptiveWaitStrategy::withLock()
+    {
+        return std::make_shared< AdaptiveWaitStrategy >(std::make_shared< BlockingWaitStrategy >());
+    }
+
+    std::shared_ptr< AdaptiveWaitStrategy > AdaptiveWaitStrategy::withLiteLock()
+    {
+        return std::make_shared< AdaptiveWaitStrategy >(std::make_shared< LiteBlockingWaitStrategy >());
+    }
+
+    std::shared_ptr< AdaptiveWaitStrategy > AdaptiveWaitStrategy::withFutex()
+    {
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        return std::make_shared< AdaptiveWaitStrategy >(std::make_shared< FutexWaitStrategy >());
+#else
+        return withLiteLock();
+#endif
+    }
+
+    std::int64_t AdaptiveWaitStrategy::waitFor(std::int64_t sequence,
+                                               Sequence& cursor,
+                                               ISequence& dependentSequence,
+                                               ISequenceBarrier& barrier)
+    {
+        std::int64_t availableSequence;
+        auto& state = barrierState(barrier);
+
+        if ((availableSequence = dependentSequence.value()) >= sequence)
+        {
+            increment(state.immediateCount);
+            return availableSequence;
+        }
+
+        auto spinStart = ClockConfig::Clock::now();
+
+        if ((availableSequence = spin(state, sequence, dependentSequence, barrier)) >= sequence)
+            return availableSequence;
+
+        barrier.checkAlert();
+
+        auto parkStart = ClockConfig::Clock::now();
+        availableSequence = m_parkingStrategyRef.waitFor(sequence, cursor, dependentSequence, barrier);
+
+        onSatisfiedWhileParked(state, parkStart - spinStart, ClockConfig::Clock::now() - parkStart);
+        return availableSequence;
+    }
+
+    SequenceWaitResult AdaptiveWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                        Sequence& cursor,
+                                                        ISequence& dependentSequence,
+                                                        ISequenceBarrier& barrier)
+    {
+        std::int64_t availableSequence;
+        auto& state = barrierState(barrier);
+
+        if ((availableSequence = dependentSequence.value()) >= sequence)
+        {
+            increment(state.immediateCount);
+            return SequenceWaitResult::available(availableSequence);
+        }
+
+        auto spinStart = ClockConfig::Clock::now();
+
+        if ((availableSequence = spin(state, sequence, dependentSequence, barrier)) >= sequence)
+            return SequenceWaitResult::available(availableSequence);
+
+        if (barrier.isAlerted())
+            return SequenceWaitResult::alerted();
+
+        auto parkStart = ClockConfig::Clock::now();
+        auto result = m_parkingStrategyRef.tryWaitFor(sequence, cursor, dependentSequence, barrier);
+
+        // An alert or a timeout says nothing about the arrival of the events
+        if (result.isAvailable())
+            onSatisfiedWhileParked(state, parkStart - spinStart, ClockConfig::Clock::now() - parkStart);
+
+        return result;
+    }
+
+    void AdaptiveWaitStrategy::signalAllWhenBlocking()
+    {
+        m_parkingStrategyRef.signalAllWhenBlocking();
+    }
+
+    void AdaptiveWaitStrategy::signalAllWhenAlerted()
+    {
+        m_parkingStrategyRef.signalAllWhenAlerted();
+    }
+
+    WaitQueue* AdaptiveWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return m_parkingStrategyRef.registerDependentSequence(sequence);
+    }
+
+    void AdaptiveWaitStrategy::unregisterBarrier(const ISequenceBarrier& barrier)
+    {
+        {
+            std::lock_guard< std::mutex > lock(m_mutex);
+
+            auto it = m_barrierStates.find(&barrier);
+            if (it != m_barrierStates.end())
+            {
+                auto& state = *it->second;
+                m_unregisteredBarrierCounts.immediate += state.immediateCount.load(std::memory_order_relaxed);
+                m_unregisteredBarrierCounts.spin += state.spinCount.load(std::memory_order_relaxed);
+                m_unregisteredBarrierCounts.park += state.parkCount.load(std::memory_order_relaxed);
+
+                m_barrierStates.erase(it);
+
+                // Invalidates the per-thread caches, a barrier constructed later at the same address must not find the released state
+                m_unregisteredBarrierCount.fetch_add(1, std::memory_order_release);
+            }
+        }
+
+        m_parkingStrategyRef.unregisterBarrier(barrier);
+    }
+
+    void AdaptiveWaitStrategy::writeDescriptionTo(std::ostream& stream) const
+    {
+        auto counts = phaseCounts();
+
+        stream << "AdaptiveWaitStrategy (immediate: " << counts.immediate
+               << ", spin: " << counts.spin
+               << ", park: " << counts.park
+               << ", parking: ";
+        m_parkingStrategy->writeDescriptionTo(stream);
+        stream << ")";
+    }
+
+    std::int32_t AdaptiveWaitStrategy::spinTries(const ISequenceBarrier& barrier) const
+    {
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        auto it = m_barrierStates.find(&barrier);
+        if (it == m_barrierStates.end())
+            return m_initialSpinTries;
+
+        return it->second->spinTries.load(std::memory_order_relaxed);
+    }
+
+    AdaptiveWaitStrategy::PhaseCounts AdaptiveWaitStrategy::phaseCounts() const
+    {
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        auto counts = m_unregisteredBarrierCounts;
+        for (auto&& barrierState : m_barrierStates)
+        {
+            auto& state = *barrierState.second;
+            counts.immediate += state.immediateCount.load(std::memory_order_relaxed);
+            counts.spin += state.spinCount.load(std::memory_order_relaxed);
+            counts.park += state.parkCount.load(std::memory_order_relaxed);
+        }
+        return counts;
+    }
+
+    AdaptiveWaitStrategy::BarrierState& AdaptiveWaitStrategy::barrierState(const ISequenceBarrier& barrier)
+    {
+        // The last state used by the thread, a thread usually waits on a single barrier. Strategies are told apart by an identifier which,
+        // unlike their address, is never reused. The address of a barrier may be reused once it is destroyed, the cached state is only valid
+        // while no barrier was unregistered since
+        struct CachedState
+        {
+            std::uint64_t strategyId;
+            std::uint64_t unregisteredBarrierCount;
+            const ISequenceBarrier* barrier;
+            BarrierState* state;
+        };
+        thread_local CachedState cachedState { 0, 0, nullptr, nullptr };
+
+        auto unregisteredBarrierCount = m_unregisteredBarrierCount.load(std::memory_order_acquire);
+
+        if (cachedState.strategyId == m_id && cachedState.barrier == &barrier && cachedState.unregisteredBarrierCount == unregisteredBarrierCount)
+            return *cachedState.state;
+
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        auto& state = m_barrierStates[&barrier];
+        if (state == nullptr)
+            state = std::make_unique< BarrierState >(m_initialSpinTries);
+
+        cachedState = { m_id, m_unregisteredBarrierCount.load(std::memory_order_relaxed), &barrier, state.get() };
+        return *state;
+    }
+
+    std::int64_t AdaptiveWaitStrategy::spin(BarrierState& state, std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier)
+    {
+        std::int64_t availableSequence = -1;
+        SpinPolicy spinPolicy;
+
+        auto spinTries = state.spinTries.load(std::memory_order_relaxed);
+
+        for (auto tries = 1; tries <= spinTries && !barrier.isAlerted(); ++tries)
+        {
+            if ((availableSequence = dependentSequence.value()) >= sequence)
+            {
+                onSatisfiedWhileSpinning(state, tries);
+                return availableSequence;
+            }
+
+            spinPolicy.spinOnce();
+        }
+
+        return availableSequence;
+    }
+
+    void AdaptiveWaitStrategy::increment(std::atomic< std::int64_t >& count)
+    {
+        // Several threads may wait on the same barrier, e.g. the WorkProcessors of a WorkerPool
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AdaptiveWaitStrategy::onSatisfiedWhileSpinning(BarrierState& state, std::int32_t tries)
+    {
+        increment(state.spinCount);
+
+        // Moves the budget an eighth of the way towards twice the observed wait
+        auto spinTries = state.spinTries.load(std::memory_order_relaxed);
+        auto target = static_cast< std::int32_t >(std::min< std::int64_t >(2LL * tries, m_maxSpinTries));
+
+        spinTries += (target - spinTries) / 8;
+        state.spinTries.store(std::min(std::max(spinTries, m_minSpinTries), m_maxSpinTries), std::memory_order_relaxed);
+    }
+
+    void AdaptiveWaitStrategy::onSatisfiedWhileParked(BarrierState& state, ClockConfig::Duration spinDuration, ClockConfig::Duration parkDuration)
+    {
+        increment(state.parkCount);
+
+        auto spinTries = state.spinTries.load(std::memory_order_relaxed);
+
+        // The event arrived shortly after we gave up spinning: a longer spin would have avoided the park and the wake-up
+        if (parkDuration <= spinDuration)
+            spinTries = static_cast< std::int32_t >(std::min< std::int64_t >(2LL * spinTries, m_maxSpinTries));
+        else
+            spinTries = std::max(spinTries / 2, m_minSpinTries);
+
+        state.spinTries.store(spinTries, std::memory_order_relaxed);
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/IWaitStrategy.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Spin-then-park wait strategy which tunes its spin budget from the waits it observes.
+     *
+     * A wait that cannot be satisfied immediately busy spins for up to spinTries(barrier) iterations, then parks on the configured parking IWaitStrategy.
+     * The budget follows twice the number of iterations of the waits satisfied while spinning. A wait which had to park doubles the budget
+     * if the event arrived within the time already spent spinning, and halves it otherwise. The budget stays between minSpinTries and maxSpinTries.
+     *
+     * A spin iteration is a SpinPolicy::spinOnce(), which issues PAUSE instructions with an exponential backoff.
+     *
+     * The clock is only read on waits which were not satisfied immediately, outside of the spin loop. Each barrier waiting on the strategy has
+     * its own budget and phase counts, found through a per-thread cache, so that the barriers do not write the same cache line. The state of a
+     * barrier is released when the barrier is destroyed, its counts are then kept in the totals of the strategy. When several threads wait on
+     * the same barrier, e.g. the WorkProcessors of a WorkerPool, concurrent updates of its budget may be lost.
+     */
+    class AdaptiveWaitStrategy : public IWaitStrategy
+    {
+    public:
+        /**
+         * Number of waits that completed in each phase
+         */
+        struct PhaseCounts
+        {
+            std::int64_t immediate;
+            std::int64_t spin;
+            std::int64_t park;
+        };
+
+        /**
+         * \param parkingStrategy the blocking IWaitStrategy used once the spin budget is exhausted
+         * \param minSpinTries the lower bound of the spin budget, must be greater than 0
+         * \param maxSpinTries the upper bound of the spin budget, must not be less than minSpinTries
+         */
+        explicit AdaptiveWaitStrategy(const std::shared_ptr< IWaitStrategy >& parkingStrategy,
+                                      std::int32_t minSpinTries = 100,
+                                      std::int32_t maxSpinTries = 1000 * 1000);
+
+        /**
+         * Construct AdaptiveWaitStrategy parking on a BlockingWaitStrategy.
+         */
+        static std::shared_ptr< AdaptiveWaitStrategy > withLock();
+
+        /**
+         * Construct AdaptiveWaitStrategy parking on a LiteBlockingWaitStrategy.
+         */
+        static std::shared_ptr< AdaptiveWaitStrategy > withLiteLock();
+
+        /**
+         * Construct AdaptiveWaitStrategy parking on a FutexWaitStrategy on Linux, on a LiteBlockingWaitStrategy otherwise.
+         */
+        static std::shared_ptr< AdaptiveWaitStrategy > withFutex();
+
+        /**
+         * \see IWaitStrategy::waitFor
+         */
+        std::int64_t waitFor(std::int64_t sequence,
+                             Sequence& cursor,
+                             ISequence& dependentSequence,
+                             ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenBlocking
+         */
+        void signalAllWhenBlocking() override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
+        /**
+         * \see IWaitStrategy::unregisterBarrier
+         */
+        void unregisterBarrier(const ISequenceBarrier& barrier) override;
+
+        void writeDescriptionTo(std::ostream& stream) const override;
+
+        /**
+         * The current spin budget of a barrier, in iterations
+         *
+         * \param barrier a barrier waiting on this strategy, the initial budget is returned if it has not waited yet
+         */
+        std::int32_t spinTries(const ISequenceBarrier& barrier) const;
+
+        /**
+         * Snapshot of the number of waits completed in each phase, summed over all the barriers, since the construction of the strategy
+         */
+        PhaseCounts phaseCounts() const;
+
+    private:
+        struct BarrierState
+        {
+            explicit BarrierState(std::int32_t initialSpinTries)
+                : spinTries(initialSpinTries)
+            {
+            }
+
+            char padding0[56] = {};
+            std::atomic< std::int32_t > spinTries;
+            std::atomic< std::int64_t > immediateCount { 0 };
+            std::atomic< std::int64_t > spinCount { 0 };
+            std::atomic< std::int64_t > parkCount { 0 };
+            char padding1[36] = {};
+        };
+
+        BarrierState& barrierState(const ISequenceBarrier& barrier);
+
+        std::int64_t spin(BarrierState& state, std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier);
+
+        static void increment(std::atomic< std::int64_t >& count);
+
+        void onSatisfiedWhileSpinning(BarrierState& state, std::int32_t tries);
+        void onSatisfiedWhileParked(BarrierState& state, ClockConfig::Duration spinDuration, ClockConfig::Duration parkDuration);
+
+        std::shared_ptr< IWaitStrategy > m_parkingStrategy;
+        IWaitStrategy& m_parkingStrategyRef;
+        std::int32_t m_minSpinTries;
+        std::int32_t m_maxSpinTries;
+        std::int32_t m_initialSpinTries;
+        std::uint64_t m_id;
+        std::atomic< std::uint64_t > m_unregisteredBarrierCount { 0 };
+
+        mutable std::mutex m_mutex;
+        std::unordered_map< const ISequenceBarrier*, std::unique_ptr< BarrierState > > m_barrierStates;
+        PhaseCounts m_unregisteredBarrierCounts { 0, 0, 0 };
+    };
+
+} // namespace Disruptor
@@ -0,0 +1,59 @@
+#include "stdafx.h"
+#include "AtomicSequenceArray.h"
+
+
+namespace Disruptor
+{
+
+    AtomicSequenceArray::AtomicSequenceArray()
+        : m_array(std::make_unique< SequenceArray >())
+    {
+        m_current.store(m_array.get());
+    }
+
+    AtomicSequenceArray::~AtomicSequenceArray() = default;
+
+    std::vector< std::shared_ptr< ISequence > > AtomicSequenceArray::sequences() const
+    {
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        return m_array->sequences();
+    }
+
+    std::int32_t AtomicSequenceArray::groupSize() const
+    {
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        return m_groupSize;
+    }
+
+    bool AtomicSequenceArray::compareAndSet(const std::vector< std::shared_ptr< ISequence > >& expected, const std::vector< std::shared_ptr< ISequence > >& sequences)
+    {
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        if (m_array->sequences() != expected)
+            return false;
+
+        replace(std::make_unique< SequenceArray >(sequences, m_groupSize));
+        return true;
+    }
+
+    void AtomicSequenceArray::setGroupSize(std::int32_t groupSize)
+    {
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        replace(std::make_unique< SequenceArray >(m_array->sequences(), groupSize));
+        m_groupSize = groupSize;
+    }
+
+    void AtomicSequenceArray::replace(std::unique_ptr< SequenceArray > array)
+    {
+        m_current.store(array.get());
+
+        // The readers which may have loaded the previous array are all in a read section started before the store
+        ReaderEpochs::synchronize();
+
+        m_array = std::move(array);
+    }
+
+} // namespace Disruptor
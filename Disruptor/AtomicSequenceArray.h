@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Disruptor/ReaderEpochs.h"
+#include "Disruptor/SequenceArray.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Reference to a SequenceArray replaced as a whole on update (copy-on-write), see SequenceGroups.
+     *
+     * Readers load a raw pointer to the current array within a read section of their thread, see ReaderEpochs: the producers computing the
+     * minimum gating sequence only write to their own epoch. Updates are serialized by a mutex and free the array they replace once the threads
+     * which could still see it have left their read section. Updates are expected to be rare (adding or removing gating sequences), a replaced
+     * array releases its sequences before the update returns.
+     */
+    class AtomicSequenceArray
+    {
+    public:
+        AtomicSequenceArray();
+        ~AtomicSequenceArray();
+
+        AtomicSequenceArray(const AtomicSequenceArray&) = delete;
+        AtomicSequenceArray& operator=(const AtomicSequenceArray&) = delete;
+
+        /**
+         * Get the minimum value of the sequences of the current array.
+         *
+         * \param minimum an initial default minimum, returned if the array is empty
+         */
+        std::int64_t minimumSequence(std::int64_t minimum) const
+        {
+            ReadGuard guard(*this);
+            return guard.array().minimumSequence(minimum);
+        }
+
+        /**
+         * Get a lower bound of the minimum value of the sequences of the current array, see SequenceArray::minimumSequence(std::int64_t, std::int64_t).
+         *
+         * \param minimum an initial default minimum, returned if the array is empty
+         * \param requiredSequence sequence that all the sequences must have reached
+         */
+        std::int64_t minimumSequence(std::int64_t minimum, std::int64_t requiredSequence) const
+        {
+            ReadGuard guard(*this);
+            return guard.array().minimumSequence(minimum, requiredSequence);
+        }
+
+        /**
+         * The sequences of the current array, in the order they were supplied
+         */
+        std::vector< std::shared_ptr< ISequence > > sequences() const;
+
+        /**
+         * The group size of the current array, see SequenceArray.
+         */
+        std::int32_t groupSize() const;
+
+        /**
+         * Replace the current array by a new array holding the given sequences, if the current array still holds the expected sequences.
+         *
+         * \param expected the sequences from which the new sequences were computed
+         * \param sequences the sequences of the new array
+         * \returns true if successful. False return indicates that the sequences of the current array were not the expected ones.
+         */
+        bool compareAndSet(const std::vector< std::shared_ptr< ISequence > >& expected, const std::vector< std::shared_ptr< ISequence > >& sequences);
+
+        /**
+         * Set the group size of the current and future arrays, see SequenceArray.
+         *
+         * \param groupSize number of sequences per group with a cached minimum, 0 to always read all the sequences
+         */
+        void setGroupSize(std::int32_t groupSize);
+
+    private:
+        class ReadGuard
+        {
+        public:
+            explicit ReadGuard(const AtomicSequenceArray& owner)
+                : m_reader(ReaderEpochs::currentReader())
+            {
+                m_reader.enter();
+                m_array = owner.m_current.load(std::memory_order_acquire);
+            }
+
+            ~ReadGuard()
+            {
+                m_reader.exit();
+            }
+
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+            const SequenceArray& array() const
+            {
+                return *m_array;
+            }
+
+        private:
+            ReaderEpochs::Reader& m_reader;
+            const SequenceArray* m_array;
+        };
+
+        void replace(std::unique_ptr< SequenceArray > array);
+
+        char m_padding0[56] = {};
+        std::atomic< const SequenceArray* > m_current;
+        char m_padding1[56] = {};
+
+        mutable std::mutex m_mutex;
+        std::int32_t m_groupSize = 0;
+        std::unique_ptr< SequenceArray > m_array;
+    };
+
+} // namespace Disruptor
@@ -0,0 +1,20 @@
+#include "stdafx.h"
+#include "BackoffSpinWaitStrategy.h"
+
+#include <ostream>
+
+
+namespace Disruptor
+{
+
+    BackoffSpinWaitStrategy::BackoffSpinWaitStrategy(std::int32_t maxPauses, bool useWaitPkg)
+        : m_spinPolicy(maxPauses, useWaitPkg)
+    {
+    }
+
+    void BackoffSpinWaitStrategy::writeDescriptionTo(std::ostream& stream) const
+    {
+        stream << "BackoffSpinWaitStrategy (waitpkg: " << std::boolalpha << m_spinPolicy.usesWaitPkg() << ")";
+    }
+
+} // namespace Disruptor
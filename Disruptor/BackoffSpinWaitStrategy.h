@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Disruptor/ISequence.h"
+#include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/Sequence.h"
+#include "Disruptor/SpinPolicy.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Busy spin strategy which spins through a SpinPolicy: PAUSE instructions with an exponential backoff, and UMONITOR/UMWAIT on the cursor
+     * cache line while the cursor is behind the requested sequence, when the CPU supports WAITPKG.
+     * Like the BusySpinWaitStrategy it avoids syscalls, while being friendlier to the sibling hyper-thread and to the power budget.
+     */
+    class BackoffSpinWaitStrategy : public IWaitStrategy
+    {
+    public:
+        /**
+         * \param maxPauses the upper bound of the backoff, in PAUSE instructions per spin
+         * \param useWaitPkg whether to use UMONITOR/UMWAIT when the CPU supports them
+         */
+        explicit BackoffSpinWaitStrategy(std::int32_t maxPauses = SpinPolicy::DefaultMaxPauses, bool useWaitPkg = true);
+
+        /**
+         * \see IWaitStrategy::waitFor
+         */
+        std::int64_t waitFor(std::int64_t sequence,
+                             Sequence& cursor,
+                             ISequence& dependentSequence,
+                             ISequenceBarrier& barrier) override
+        {
+            std::int64_t availableSequence;
+            SpinPolicy spinPolicy(m_spinPolicy);
+
+            while ((availableSequence = dependentSequence.value()) < sequence)
+            {
+                barrier.checkAlert();
+
+                auto cursorValue = cursor.value();
+                if (cursorValue < sequence)
+                    spinPolicy.waitForChange(cursor, cursorValue);
+                else
+                    spinPolicy.spinOnce();
+            }
+
+            return availableSequence;
+        }
+
+        /**
+         * \see IWaitStrategy::signalAllWhenBlocking
+         */
+        void signalAllWhenBlocking() override
+        {
+        }
+
+        void writeDescriptionTo(std::ostream& stream) const override;
+
+    private:
+        SpinPolicy m_spinPolicy;
+    };
+
+} // namespace Disruptor
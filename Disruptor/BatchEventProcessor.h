@@ -1,7 +1,11 @@
 #pragma once
 
-#include "Disruptor/AlertException.h"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
 #include "Disruptor/ArgumentNullException.h"
+#include "Disruptor/IBatchEventHandler.h"
 #include "Disruptor/IDataProvider.h"
 #include "Disruptor/IEventHandler.h"
 #include "Disruptor/IEventProcessor.h"
@@ -10,9 +14,12 @@
 #include "Disruptor/ILifecycleAware.h"
 #include "Disruptor/InvalidOperationException.h"
 #include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/ISequenced.h"
 #include "Disruptor/ITimeoutHandler.h"
 #include "Disruptor/Sequence.h"
-#include "Disruptor/TimeoutException.h"
+#include "Disruptor/SequenceWaitResult.h"
+#include "Disruptor/StaticDispatch.h"
+#include "Disruptor/WaitQueue.h"
 
 
 namespace Disruptor
@@ -22,10 +29,17 @@ namespace Disruptor
      * Convenience class for handling the batching semantics of consuming events from a RingBuffer<T>
      * and delegating the available events to an IEventHandler<T>. If the BatchEventProcessor<T>
      * also implements ILifecycleAware it will be notified just after the thread is started and just before the thread is shutdown.
+     * If the IEventHandler<T> implements IBatchEventHandler<T>, the available events are delivered as contiguous spans through IBatchEventHandler<T>::onBatch.
+     * 
+     * The event handler and data provider types default to the IEventHandler<T> and IDataProvider<T> interfaces. When concrete types are supplied
+     * instead, e.g. BatchEventProcessor<T, MyHandler, RingBuffer<T>>, the per-event calls made by run() are qualified calls, resolved at compile time
+     * and inlinable. The handler and the data provider must then be exactly of these types, see requireExactType().
      * 
      * \tparam T Event implementation storing the data for sharing during exchange or parallel coordination of an event.
+     * \tparam TEventHandler type of the event handler, must derive from IEventHandler<T>
+     * \tparam TDataProvider type of the data provider the events are read from
      */
-    template <class T>
+    template <class T, class TEventHandler = IEventHandler< T >, class TDataProvider = IDataProvider< T >>
     class BatchEventProcessor : public IEventProcessor
     {
     public:
@@ -37,9 +51,9 @@ namespace Disruptor
          * \param sequenceBarrier SequenceBarrier on which it is waiting.
          * \param eventHandler eventHandler is the delegate to which events are dispatched.
          */
-        BatchEventProcessor(const std::shared_ptr< IDataProvider< T > >& dataProvider,
+        BatchEventProcessor(const std::shared_ptr< TDataProvider >& dataProvider,
                             const std::shared_ptr< ISequenceBarrier >& sequenceBarrier,
-                            const std::shared_ptr< IEventHandler< T > >& eventHandler)
+                            const std::shared_ptr< TEventHandler >& eventHandler)
             : m_running(false)
             , m_dataProvider(dataProvider)
             , m_dataProviderRef(*m_dataProvider)
@@ -50,11 +64,25 @@ namespace Disruptor
             , m_sequence(std::make_shared< Sequence >())
             , m_sequenceRef(*m_sequence)
         {
+            requireExactType(m_dataProviderRef);
+            requireExactType(m_eventHandlerRef);
+
             auto processorSequenceAware = std::dynamic_pointer_cast< IEventProcessorSequenceAware >(eventHandler);
             if (processorSequenceAware != nullptr)
                 processorSequenceAware->setSequenceCallback(m_sequence);
 
             m_timeoutHandler = std::dynamic_pointer_cast< ITimeoutHandler >(eventHandler);
+
+            // Barriers gated on this processor may park on its sequence
+            m_sequenceWaitQueue = m_sequenceBarrierRef.registerDependentSequence(m_sequence);
+
+            m_batchEventHandler = std::dynamic_pointer_cast< IBatchEventHandler< T > >(eventHandler);
+            if (m_batchEventHandler != nullptr)
+            {
+                // Events are only known to be stored contiguously when reading from a ring buffer
+                auto sequenced = std::dynamic_pointer_cast< ISequenced >(dataProvider);
+                m_spanCapacity = sequenced != nullptr ? sequenced->bufferSize() : 1;
+            }
         }
 
         /**
@@ -115,38 +143,64 @@ namespace Disruptor
             auto nextSequence = m_sequenceRef.value() + 1;
 
             T* evt = nullptr;
+            auto lastSequence = nextSequence;
 
             while (true)
             {
-                try
-                {
-                    auto availableSequence = m_sequenceBarrierRef.waitFor(nextSequence);
+                // Alerts and timeouts are reported as a status, the exceptions are only used to report the failures of the handler
+                auto result = m_sequenceBarrierRef.tryWaitFor(nextSequence);
 
-                    while (nextSequence <= availableSequence)
-                    {
-                        evt = &m_dataProviderRef[nextSequence];
-                        m_eventHandlerRef.onEvent(*evt, nextSequence, nextSequence == availableSequence);
-                        nextSequence++;
-                    }
+                if (result.status == SequenceWaitStatus::Alerted)
+                {
+                    if (m_running == false)
+                        break;
 
-                    m_sequenceRef.setValue(availableSequence);
+                    continue;
                 }
-                catch (const TimeoutException&)
+
+                if (result.status == SequenceWaitStatus::TimedOut)
                 {
                     notifyTimeout(m_sequenceRef.value());
+                    continue;
                 }
-                catch (const AlertException&)
+
+                auto availableSequence = result.sequence;
+
+                try
                 {
-                    if (m_running == false)
+                    if (m_batchEventHandler != nullptr)
                     {
-                        break;
+                        while (nextSequence <= availableSequence)
+                        {
+                            auto count = std::min(availableSequence - nextSequence + 1, m_spanCapacity - (nextSequence & (m_spanCapacity - 1)));
+                            lastSequence = nextSequence + count - 1;
+
+                            evt = &DataProviderDispatch< TDataProvider >::get(m_dataProviderRef, nextSequence);
+                            m_batchEventHandler->onBatch(evt, static_cast< std::size_t >(count), nextSequence);
+                            nextSequence = lastSequence + 1;
+                        }
                     }
+                    else
+                    {
+                        while (nextSequence <= availableSequence)
+                        {
+                            evt = &DataProviderDispatch< TDataProvider >::get(m_dataProviderRef, nextSequence);
+                            lastSequence = nextSequence;
+                            EventHandlerDispatch< TEventHandler >::onEvent(m_eventHandlerRef, *evt, nextSequence, nextSequence == availableSequence);
+                            nextSequence++;
+                        }
+                    }
+
+                    m_sequenceRef.setValue(availableSequence);
+                    signalSequenceWaiters();
                 }
                 catch (const std::exception& ex)
                 {
+                    // A failing span is skipped as a whole
                     m_exceptionHandler->handleEventException(ex, nextSequence, *evt);
-                    m_sequenceRef.setValue(nextSequence);
-                    nextSequence++;
+                    m_sequenceRef.setValue(lastSequence);
+                    signalSequenceWaiters();
+                    nextSequence = lastSequence + 1;
                 }
             }
 
@@ -155,6 +209,14 @@ namespace Disruptor
         }
 
     private:
+        static_assert(std::is_base_of< IEventHandler< T >, TEventHandler >::value, "TEventHandler must derive from IEventHandler<T>");
+
+        void signalSequenceWaiters()
+        {
+            if (m_sequenceWaitQueue != nullptr)
+                m_sequenceWaitQueue->wakeAll();
+        }
+
         void notifyTimeout(std::int64_t availableSequence) const
         {
             try
@@ -205,15 +267,18 @@ namespace Disruptor
 
     private:
         std::atomic<bool> m_running;
-        std::shared_ptr< IDataProvider< T > > m_dataProvider;
-        IDataProvider< T >& m_dataProviderRef;
+        std::shared_ptr< TDataProvider > m_dataProvider;
+        TDataProvider& m_dataProviderRef;
         std::shared_ptr< ISequenceBarrier > m_sequenceBarrier;
         ISequenceBarrier& m_sequenceBarrierRef;
-        std::shared_ptr< IEventHandler< T > > m_eventHandler;
-        IEventHandler< T >& m_eventHandlerRef;
+        std::shared_ptr< TEventHandler > m_eventHandler;
+        TEventHandler& m_eventHandlerRef;
         std::shared_ptr< Sequence > m_sequence;
         Sequence& m_sequenceRef;
+        WaitQueue* m_sequenceWaitQueue = nullptr;
         std::shared_ptr< ITimeoutHandler > m_timeoutHandler;
+        std::shared_ptr< IBatchEventHandler< T > > m_batchEventHandler;
+        std::int64_t m_spanCapacity = 1;
         std::shared_ptr< IExceptionHandler< T > > m_exceptionHandler;
     };
 
@@ -14,6 +14,18 @@ namespace Disruptor
                                                Sequence& cursor,
                                                ISequence& dependentSequence,
                                                ISequenceBarrier& barrier)
+    {
+        auto result = tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+
+        return result.sequence;
+    }
+
+    SequenceWaitResult BlockingWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                        Sequence& cursor,
+                                                        ISequence& dependentSequence,
+                                                        ISequenceBarrier& barrier)
     {
         if (cursor.value() < sequence)
         {
@@ -21,19 +33,14 @@ namespace Disruptor
 
             while (cursor.value() < sequence)
             {
-                barrier.checkAlert();
+                if (barrier.isAlerted())
+                    return SequenceWaitResult::alerted();
 
                 m_conditionVariable.wait(uniqueLock);
             }
         }
 
-        std::int64_t availableSequence;
-        while ((availableSequence = dependentSequence.value()) < sequence)
-        {
-            barrier.checkAlert();
-        }
-
-        return availableSequence;
+        return m_waiterRegistry.tryWaitFor(sequence, dependentSequence, barrier);
     }
 
     void BlockingWaitStrategy::signalAllWhenBlocking()
@@ -43,6 +50,17 @@ namespace Disruptor
         m_conditionVariable.notify_all();
     }
 
+    void BlockingWaitStrategy::signalAllWhenAlerted()
+    {
+        signalAllWhenBlocking();
+        m_waiterRegistry.wakeAll();
+    }
+
+    WaitQueue* BlockingWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return &m_waiterRegistry.registerSequence(sequence);
+    }
+
     void BlockingWaitStrategy::writeDescriptionTo(std::ostream& stream) const
     {
         stream << "BlockingWaitStrategy";
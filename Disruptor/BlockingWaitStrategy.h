@@ -3,6 +3,7 @@
 #include <boost/thread.hpp>
 
 #include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaiterRegistry.h"
 
 
 namespace Disruptor
@@ -23,16 +24,35 @@ namespace Disruptor
                              ISequence& dependentSequence,
                              ISequenceBarrier& barrier) override;
 
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
         /**
          * \see IWaitStrategy::signalAllWhenBlocking
          */ 
         void signalAllWhenBlocking() override;
 
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
         void writeDescriptionTo(std::ostream& stream) const override;
 
     private:
         boost::recursive_mutex m_gate;
         boost::condition_variable_any m_conditionVariable;
+        WaiterRegistry m_waiterRegistry;
     };
 
 } // namespace Disruptor
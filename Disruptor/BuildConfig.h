@@ -46,6 +46,11 @@
 
 #endif
 
+// x86 family, where the PAUSE and WAITPKG instructions are available
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+# define DISRUPTOR_CPU_X86
+#endif
+
 // calling conventions
 #ifdef DISRUPTOR_VC_COMPILER
 # define DISRUPTOR_STDCALL        __stdcall
@@ -1,8 +1,9 @@
 #pragma once
 
-#include <mutex>
-
+#include "Disruptor/ISequence.h"
+#include "Disruptor/ISequenceBarrier.h"
 #include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/Sequence.h"
 
 
 namespace Disruptor
@@ -19,14 +20,26 @@ namespace Disruptor
          * \see IWaitStrategy::waitFor
          */ 
         std::int64_t waitFor(std::int64_t sequence,
-                             Sequence& cursor,
+                             Sequence& /*cursor*/,
                              ISequence& dependentSequence,
-                             ISequenceBarrier& barrier) override;
+                             ISequenceBarrier& barrier) override
+        {
+            std::int64_t availableSequence;
+
+            while ((availableSequence = dependentSequence.value()) < sequence)
+            {
+                barrier.checkAlert();
+            }
+
+            return availableSequence;
+        }
 
         /**
          * \see IWaitStrategy::signalAllWhenBlocking
          */ 
-        void signalAllWhenBlocking() override;
+        void signalAllWhenBlocking() override
+        {
+        }
 
         void writeDescriptionTo(std::ostream& stream) const override;
     };
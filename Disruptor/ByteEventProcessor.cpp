@@ -0,0 +1,205 @@
+#include "stdafx.h"
+#include "ByteEventProcessor.h"
+
+#include <algorithm>
+
+#include "ArgumentNullException.h"
+#include "FatalExceptionHandler.h"
+#include "ILifecycleAware.h"
+#include "InvalidOperationException.h"
+#include "SequenceWaitResult.h"
+#include "WaitQueue.h"
+
+
+namespace Disruptor
+{
+
+    ByteEventProcessor::ByteEventProcessor(const std::shared_ptr< ByteRingBuffer >& ringBuffer,
+                                           const std::shared_ptr< ISequenceBarrier >& sequenceBarrier,
+                                           const std::shared_ptr< IEventHandler< ByteRecord > >& eventHandler)
+        : m_running(false)
+        , m_ringBuffer(ringBuffer)
+        , m_ringBufferRef(*m_ringBuffer)
+        , m_sequenceBarrier(sequenceBarrier)
+        , m_sequenceBarrierRef(*m_sequenceBarrier)
+        , m_eventHandler(eventHandler)
+        , m_eventHandlerRef(*m_eventHandler)
+        , m_sequence(std::make_shared< Sequence >())
+        , m_sequenceRef(*m_sequence)
+        , m_exceptionHandler(std::make_shared< FatalExceptionHandler< ByteRecord > >())
+    {
+        m_timeoutHandler = std::dynamic_pointer_cast< ITimeoutHandler >(eventHandler);
+
+        // Barriers gated on this processor may park on its sequence
+        m_sequenceWaitQueue = m_sequenceBarrierRef.registerDependentSequence(m_sequence);
+    }
+
+    std::shared_ptr< ISequence > ByteEventProcessor::sequence() const
+    {
+        return m_sequence;
+    }
+
+    void ByteEventProcessor::halt()
+    {
+        m_running = false;
+        m_sequenceBarrier->alert();
+    }
+
+    bool ByteEventProcessor::isRunning() const
+    {
+        return m_running;
+    }
+
+    void ByteEventProcessor::setExceptionHandler(const std::shared_ptr< IExceptionHandler< ByteRecord > >& exceptionHandler)
+    {
+        if (exceptionHandler == nullptr)
+            DISRUPTOR_THROW_ARGUMENT_NULL_EXCEPTION(exceptionHandler);
+
+        m_exceptionHandler = exceptionHandler;
+    }
+
+    void ByteEventProcessor::run()
+    {
+        if (m_running.exchange(true) != false)
+        {
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Thread is already running");
+        }
+
+        m_sequenceBarrierRef.clearAlert();
+
+        notifyStart();
+
+        auto nextSequence = m_sequenceRef.value() + 1;
+
+        // Last chunk of a record whose first chunks are published before the others, with a multi-producer sequencer
+        auto waitSequence = nextSequence;
+
+        // A record is delivered once the next one is read, so that the last record of a batch gets endOfBatch even when the batch ends with
+        // padding or with the first chunks of an incomplete record
+        ByteRecord pending;
+        std::int64_t pendingSequence = -1;
+
+        while (true)
+        {
+            auto result = m_sequenceBarrierRef.tryWaitFor(std::max(nextSequence, waitSequence));
+
+            if (result.status == SequenceWaitStatus::Alerted)
+            {
+                if (m_running == false)
+                    break;
+
+                continue;
+            }
+
+            if (result.status == SequenceWaitStatus::TimedOut)
+            {
+                notifyTimeout(m_sequenceRef.value());
+                continue;
+            }
+
+            auto availableSequence = result.sequence;
+            pendingSequence = -1;
+
+            try
+            {
+                while (nextSequence <= availableSequence)
+                {
+                    auto record = m_ringBufferRef.record(nextSequence);
+
+                    auto recordLastSequence = nextSequence + record.chunkCount - 1;
+                    if (recordLastSequence > availableSequence)
+                    {
+                        waitSequence = recordLastSequence;
+                        break;
+                    }
+
+                    if (!record.isPadding)
+                    {
+                        if (pendingSequence != -1)
+                            m_eventHandlerRef.onEvent(pending, pendingSequence, false);
+
+                        pending = record;
+                        pendingSequence = nextSequence;
+                    }
+
+                    nextSequence = recordLastSequence + 1;
+                }
+
+                if (pendingSequence != -1)
+                    m_eventHandlerRef.onEvent(pending, pendingSequence, true);
+
+                if (nextSequence - 1 > m_sequenceRef.value())
+                {
+                    m_sequenceRef.setValue(nextSequence - 1);
+                    signalSequenceWaiters();
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                // The failing record is skipped, the records read after it are read again
+                m_exceptionHandler->handleEventException(ex, pendingSequence, pending);
+                nextSequence = pendingSequence + pending.chunkCount;
+                m_sequenceRef.setValue(nextSequence - 1);
+                signalSequenceWaiters();
+            }
+        }
+
+        notifyShutdown();
+        m_running = false;
+    }
+
+    void ByteEventProcessor::signalSequenceWaiters()
+    {
+        if (m_sequenceWaitQueue != nullptr)
+            m_sequenceWaitQueue->wakeAll();
+    }
+
+    void ByteEventProcessor::notifyTimeout(std::int64_t availableSequence) const
+    {
+        try
+        {
+            if (m_timeoutHandler)
+                m_timeoutHandler->onTimeout(availableSequence);
+        }
+        catch (std::exception& ex)
+        {
+            if (m_exceptionHandler)
+                m_exceptionHandler->handleOnTimeoutException(ex, availableSequence);
+        }
+    }
+
+    void ByteEventProcessor::notifyStart()
+    {
+        auto lifecycleAware = std::dynamic_pointer_cast< ILifecycleAware >(m_eventHandler);
+        if (lifecycleAware != nullptr)
+        {
+            try
+            {
+                lifecycleAware->onStart();
+            }
+            catch (std::exception& ex)
+            {
+                if (m_exceptionHandler)
+                    m_exceptionHandler->handleOnStartException(ex);
+            }
+        }
+    }
+
+    void ByteEventProcessor::notifyShutdown()
+    {
+        auto lifecycleAware = std::dynamic_pointer_cast< ILifecycleAware >(m_eventHandler);
+        if (lifecycleAware != nullptr)
+        {
+            try
+            {
+                lifecycleAware->onShutdown();
+            }
+            catch (std::exception& ex)
+            {
+                if (m_exceptionHandler)
+                    m_exceptionHandler->handleOnShutdownException(ex);
+            }
+        }
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "Disruptor/ByteRecord.h"
+#include "Disruptor/ByteRingBuffer.h"
+#include "Disruptor/IEventHandler.h"
+#include "Disruptor/IEventProcessor.h"
+#include "Disruptor/IExceptionHandler.h"
+#include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/ITimeoutHandler.h"
+#include "Disruptor/Sequence.h"
+
+
+namespace Disruptor
+{
+
+    class WaitQueue;
+
+    /**
+     * Event processor reading the records of a ByteRingBuffer and delivering them to an IEventHandler<ByteRecord>, with the batching semantics
+     * of BatchEventProcessor<T>. Padding records are skipped, and a record is only delivered once all its chunks are published.
+     * If the handler implements ILifecycleAware or ITimeoutHandler, it is notified like with a BatchEventProcessor<T>.
+     */
+    class ByteEventProcessor : public IEventProcessor
+    {
+    public:
+        /**
+         * \param ringBuffer ring buffer to which records are published
+         * \param sequenceBarrier SequenceBarrier on which it is waiting.
+         * \param eventHandler eventHandler is the delegate to which records are dispatched.
+         */
+        ByteEventProcessor(const std::shared_ptr< ByteRingBuffer >& ringBuffer,
+                           const std::shared_ptr< ISequenceBarrier >& sequenceBarrier,
+                           const std::shared_ptr< IEventHandler< ByteRecord > >& eventHandler);
+
+        /**
+         * The sequence of the last chunk processed.
+         */
+        std::shared_ptr< ISequence > sequence() const override;
+
+        void halt() override;
+
+        bool isRunning() const override;
+
+        /**
+         * Set a new IExceptionHandler<ByteRecord> for handling exceptions propagated out of the handler, FatalExceptionHandler<ByteRecord> by default.
+         *
+         * \param exceptionHandler exceptionHandler to replace the existing exceptionHandler.
+         */
+        void setExceptionHandler(const std::shared_ptr< IExceptionHandler< ByteRecord > >& exceptionHandler);
+
+        /**
+         * It is ok to have another thread rerun this method after a halt().
+         */
+        void run() override;
+
+    private:
+        void signalSequenceWaiters();
+        void notifyTimeout(std::int64_t availableSequence) const;
+        void notifyStart();
+        void notifyShutdown();
+
+        std::atomic< bool > m_running;
+        std::shared_ptr< ByteRingBuffer > m_ringBuffer;
+        ByteRingBuffer& m_ringBufferRef;
+        std::shared_ptr< ISequenceBarrier > m_sequenceBarrier;
+        ISequenceBarrier& m_sequenceBarrierRef;
+        std::shared_ptr< IEventHandler< ByteRecord > > m_eventHandler;
+        IEventHandler< ByteRecord >& m_eventHandlerRef;
+        std::shared_ptr< Sequence > m_sequence;
+        Sequence& m_sequenceRef;
+        WaitQueue* m_sequenceWaitQueue = nullptr;
+        std::shared_ptr< ITimeoutHandler > m_timeoutHandler;
+        std::shared_ptr< IExceptionHandler< ByteRecord > > m_exceptionHandler;
+    };
+
+} // namespace Disruptor
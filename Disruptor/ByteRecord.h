@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Disruptor
+{
+
+    /**
+     * View of a length-prefixed record of a ByteRingBuffer, as received by the IEventHandler<ByteRecord> of a ByteEventProcessor.
+     * The bytes belong to the ring buffer: they are only valid until the handler returns.
+     */
+    struct ByteRecord
+    {
+        /**
+         * The payload of the record
+         */
+        const std::uint8_t* data = nullptr;
+
+        /**
+         * The length of the payload in bytes
+         */
+        std::size_t length = 0;
+
+        /**
+         * The number of chunks of the ring buffer taken by the record, header included
+         */
+        std::int32_t chunkCount = 0;
+
+        /**
+         * True for the records filling the end of the ring buffer when a record would straddle the wrap point. They are not delivered to the handlers.
+         */
+        bool isPadding = false;
+    };
+
+} // namespace Disruptor
@@ -0,0 +1,237 @@
+#include "stdafx.h"
+#include "ByteRingBuffer.h"
+
+#include <cstring>
+#include <limits>
+
+#include "ArgumentException.h"
+#include "ArgumentOutOfRangeException.h"
+#include "FetchAndAddMultiProducerSequencer.h"
+#include "InsufficientCapacityException.h"
+#include "MultiProducerSequencer.h"
+#include "SingleProducerSequencer.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    // Length stored in the header of the padding records
+    const std::uint32_t paddingLength = std::numeric_limits< std::uint32_t >::max();
+
+    struct RecordHeader
+    {
+        std::uint32_t length;
+        std::uint32_t chunkCount;
+    };
+
+    static_assert(sizeof(RecordHeader) == ByteRingBuffer::headerSize, "The record header should fill headerSize bytes");
+
+} // namespace
+
+
+    ByteRingBuffer::ByteRingBuffer(const std::shared_ptr< ISequencer< ByteRecord > >& sequencer, const MemoryPlacement& placement)
+        : m_sequencer(sequencer)
+        , m_sequencerRef(*m_sequencer)
+        , m_chunkCount(sequencer->bufferSize())
+        , m_indexMask(m_chunkCount - 1)
+        , m_storage(nullptr, PlacementDeleter< std::uint8_t >(placement, static_cast< std::size_t >(m_chunkCount + 1) * chunkSize))
+        , m_chunks(nullptr)
+    {
+        if (m_chunkCount < 2)
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("chunkCount must not be less than 2");
+
+        // One more chunk to align the chunks on cache lines
+        const auto storageSize = static_cast< std::size_t >(m_chunkCount + 1) * chunkSize;
+
+        placement.touch([&]
+        {
+            m_storage.reset(static_cast< std::uint8_t* >(placement.allocate(storageSize)));
+            std::memset(m_storage.get(), 0, storageSize);
+        });
+
+        auto address = reinterpret_cast< std::uintptr_t >(m_storage.get());
+        m_chunks = m_storage.get() + (chunkSize - address % chunkSize) % chunkSize;
+    }
+
+    std::shared_ptr< ByteRingBuffer > ByteRingBuffer::create(ProducerType producerType,
+                                                             std::int32_t chunkCount,
+                                                             const std::shared_ptr< IWaitStrategy >& waitStrategy,
+                                                             const MemoryPlacement& placement)
+    {
+        switch (producerType)
+        {
+            case ProducerType::Single:
+                return std::make_shared< ByteRingBuffer >(std::make_shared< SingleProducerSequencer< ByteRecord > >(chunkCount, waitStrategy), placement);
+            case ProducerType::Multi:
+                return std::make_shared< ByteRingBuffer >(std::make_shared< MultiProducerSequencer< ByteRecord > >(chunkCount, waitStrategy, placement), placement);
+            case ProducerType::MultiFetchAndAdd:
+                return std::make_shared< ByteRingBuffer >(std::make_shared< FetchAndAddMultiProducerSequencer< ByteRecord > >(chunkCount, waitStrategy, placement), placement);
+            default:
+                DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(producerType);
+        }
+    }
+
+    std::int32_t ByteRingBuffer::chunkCount() const
+    {
+        return m_chunkCount;
+    }
+
+    std::size_t ByteRingBuffer::maxRecordLength() const
+    {
+        return static_cast< std::size_t >(m_chunkCount / 2) * chunkSize - headerSize;
+    }
+
+    std::int32_t ByteRingBuffer::chunksFor(std::size_t length)
+    {
+        return static_cast< std::int32_t >((length + headerSize + chunkSize - 1) / chunkSize);
+    }
+
+    ByteRingBuffer::Claim ByteRingBuffer::claim(std::size_t length)
+    {
+        auto chunks = checkedChunksFor(length);
+
+        while (true)
+        {
+            auto lastSequence = m_sequencerRef.next(chunks);
+            if (!straddlesWrapPoint(lastSequence, chunks))
+                return newClaim(lastSequence, chunks, length);
+
+            publishPadding(lastSequence, chunks);
+        }
+    }
+
+    bool ByteRingBuffer::tryClaim(std::size_t length, Claim& claim)
+    {
+        auto chunks = checkedChunksFor(length);
+
+        while (true)
+        {
+            std::int64_t lastSequence;
+            try
+            {
+                lastSequence = m_sequencerRef.tryNext(chunks);
+            }
+            catch (InsufficientCapacityException&)
+            {
+                return false;
+            }
+
+            if (!straddlesWrapPoint(lastSequence, chunks))
+            {
+                claim = newClaim(lastSequence, chunks, length);
+                return true;
+            }
+
+            publishPadding(lastSequence, chunks);
+        }
+    }
+
+    void ByteRingBuffer::publish(const Claim& claim)
+    {
+        RecordHeader header { static_cast< std::uint32_t >(claim.length()), static_cast< std::uint32_t >(claim.lastSequence() - claim.firstSequence() + 1) };
+        std::memcpy(chunk(claim.firstSequence()), &header, sizeof(header));
+
+        m_sequencerRef.publish(claim.firstSequence(), claim.lastSequence());
+    }
+
+    void ByteRingBuffer::publish(const std::uint8_t* data, std::size_t length)
+    {
+        auto record = claim(length);
+        std::memcpy(record.data(), data, length);
+        publish(record);
+    }
+
+    bool ByteRingBuffer::tryPublish(const std::uint8_t* data, std::size_t length)
+    {
+        Claim record;
+        if (!tryClaim(length, record))
+            return false;
+
+        std::memcpy(record.data(), data, length);
+        publish(record);
+        return true;
+    }
+
+    ByteRecord ByteRingBuffer::record(std::int64_t sequence) const
+    {
+        auto first = chunk(sequence);
+
+        RecordHeader header;
+        std::memcpy(&header, first, sizeof(header));
+
+        ByteRecord result;
+        result.chunkCount = static_cast< std::int32_t >(header.chunkCount);
+        result.isPadding = header.length == paddingLength;
+        if (!result.isPadding)
+        {
+            result.data = first + headerSize;
+            result.length = header.length;
+        }
+
+        return result;
+    }
+
+    std::int64_t ByteRingBuffer::cursor() const
+    {
+        return m_sequencerRef.cursor();
+    }
+
+    std::int64_t ByteRingBuffer::getRemainingCapacity()
+    {
+        return m_sequencerRef.getRemainingCapacity();
+    }
+
+    void ByteRingBuffer::addGatingSequences(const std::vector< std::shared_ptr< ISequence > >& gatingSequences)
+    {
+        m_sequencerRef.addGatingSequences(gatingSequences);
+    }
+
+    bool ByteRingBuffer::removeGatingSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return m_sequencerRef.removeGatingSequence(sequence);
+    }
+
+    std::shared_ptr< ISequenceBarrier > ByteRingBuffer::newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack)
+    {
+        return m_sequencerRef.newBarrier(sequencesToTrack);
+    }
+
+    std::uint8_t* ByteRingBuffer::chunk(std::int64_t sequence) const
+    {
+        return m_chunks + static_cast< std::size_t >(sequence & m_indexMask) * chunkSize;
+    }
+
+    std::int32_t ByteRingBuffer::checkedChunksFor(std::size_t length) const
+    {
+        if (length > maxRecordLength())
+            DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(length);
+
+        return chunksFor(length);
+    }
+
+    bool ByteRingBuffer::straddlesWrapPoint(std::int64_t lastSequence, std::int32_t chunks) const
+    {
+        auto firstIndex = (lastSequence - chunks + 1) & m_indexMask;
+        return firstIndex + chunks > m_chunkCount;
+    }
+
+    void ByteRingBuffer::publishPadding(std::int64_t lastSequence, std::int32_t chunks)
+    {
+        auto firstSequence = lastSequence - chunks + 1;
+
+        // Only the header is read by the consumers, the chunks following the wrap point are skipped with it
+        RecordHeader header { paddingLength, static_cast< std::uint32_t >(chunks) };
+        std::memcpy(chunk(firstSequence), &header, sizeof(header));
+
+        m_sequencerRef.publish(firstSequence, lastSequence);
+    }
+
+    ByteRingBuffer::Claim ByteRingBuffer::newClaim(std::int64_t lastSequence, std::int32_t chunks, std::size_t length) const
+    {
+        auto firstSequence = lastSequence - chunks + 1;
+        return Claim(chunk(firstSequence) + headerSize, length, firstSequence, lastSequence);
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Disruptor/ByteRecord.h"
+#include "Disruptor/ICursored.h"
+#include "Disruptor/ISequencer.h"
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/MemoryPlacement.h"
+#include "Disruptor/PlacementAllocator.h"
+#include "Disruptor/ProducerType.h"
+
+
+namespace Disruptor
+{
+
+    class ISequence;
+    class ISequenceBarrier;
+
+    /**
+     * Ring buffer of variable-length records, for serialized messages of mixed sizes.
+     *
+     * The ring is made of chunks of chunkSize bytes, each chunk being a sequence of the sequencer: a record of N bytes claims the chunks holding
+     * its header (headerSize bytes) and its payload, with the same claim and gating machinery as RingBuffer<T>. A record is never split at the
+     * wrap point: a claim which would straddle it is published as a padding record, skipped by the consumers, and the record is claimed again.
+     *
+     * Records are published with claim()/publish() or publish(), and consumed by a ByteEventProcessor.
+     */
+    class ByteRingBuffer : public ICursored
+    {
+    public:
+        static const std::int32_t chunkSize = 64;
+        static const std::int32_t headerSize = 8;
+
+        /**
+         * Chunks claimed for a record, written between ByteRingBuffer::claim() and ByteRingBuffer::publish().
+         */
+        class Claim
+        {
+        public:
+            Claim() = default;
+
+            Claim(std::uint8_t* data, std::size_t length, std::int64_t firstSequence, std::int64_t lastSequence)
+                : m_data(data)
+                , m_length(length)
+                , m_firstSequence(firstSequence)
+                , m_lastSequence(lastSequence)
+            {
+            }
+
+            /**
+             * The payload of the record, length() bytes
+             */
+            std::uint8_t* data() const
+            {
+                return m_data;
+            }
+
+            std::size_t length() const
+            {
+                return m_length;
+            }
+
+            std::int64_t firstSequence() const
+            {
+                return m_firstSequence;
+            }
+
+            std::int64_t lastSequence() const
+            {
+                return m_lastSequence;
+            }
+
+        private:
+            std::uint8_t* m_data = nullptr;
+            std::size_t m_length = 0;
+            std::int64_t m_firstSequence = -1;
+            std::int64_t m_lastSequence = -1;
+        };
+
+        /**
+         * \param sequencer sequencer of the chunks, its buffer size is the number of chunks of the ring
+         * \param placement placement of the chunks, see MemoryPlacement
+         */
+        explicit ByteRingBuffer(const std::shared_ptr< ISequencer< ByteRecord > >& sequencer, const MemoryPlacement& placement = MemoryPlacement());
+
+        /**
+         * Create a new ByteRingBuffer with the specified producer type.
+         *
+         * \param producerType producer type to use
+         * \param chunkCount number of chunks of the ring, must be a power of 2. The capacity in bytes is chunkCount * chunkSize.
+         * \param waitStrategy used to determine how to wait for new records to become available.
+         * \param placement placement of the chunks, see MemoryPlacement
+         */
+        static std::shared_ptr< ByteRingBuffer > create(ProducerType producerType,
+                                                        std::int32_t chunkCount,
+                                                        const std::shared_ptr< IWaitStrategy >& waitStrategy,
+                                                        const MemoryPlacement& placement = MemoryPlacement());
+
+        /**
+         * Number of chunks of the ring.
+         */
+        std::int32_t chunkCount() const;
+
+        /**
+         * The largest payload a record can hold: a record takes at most half of the ring, so that a claim following a padding record always fits.
+         */
+        std::size_t maxRecordLength() const;
+
+        /**
+         * Number of chunks taken by a record, header included.
+         *
+         * \param length length of the payload in bytes
+         */
+        static std::int32_t chunksFor(std::size_t length);
+
+        /**
+         * Claim the chunks of a record, waiting for the consumers if the ring is full. The record must be published with publish(const Claim&).
+         *
+         * \param length length of the payload in bytes, at most maxRecordLength()
+         */
+        Claim claim(std::size_t length);
+
+        /**
+         * Claim the chunks of a record if the ring has the capacity to hold it.
+         *
+         * \param length length of the payload in bytes, at most maxRecordLength()
+         * \param claim the claimed chunks
+         * \returns false if the ring does not have the capacity
+         */
+        bool tryClaim(std::size_t length, Claim& claim);
+
+        /**
+         * Write the header of a claimed record and make it available to the consumers.
+         */
+        void publish(const Claim& claim);
+
+        /**
+         * Copy a payload in a new record and publish it, waiting for the consumers if the ring is full.
+         */
+        void publish(const std::uint8_t* data, std::size_t length);
+
+        /**
+         * Copy a payload in a new record and publish it if the ring has the capacity to hold it.
+         *
+         * \returns false if the ring does not have the capacity
+         */
+        bool tryPublish(const std::uint8_t* data, std::size_t length);
+
+        /**
+         * Read the header of the record starting at a sequence. The sequence must be the first chunk of a published record.
+         */
+        ByteRecord record(std::int64_t sequence) const;
+
+        std::int64_t cursor() const override;
+
+        /**
+         * Number of free chunks.
+         */
+        std::int64_t getRemainingCapacity();
+
+        void addGatingSequences(const std::vector< std::shared_ptr< ISequence > >& gatingSequences);
+
+        bool removeGatingSequence(const std::shared_ptr< ISequence >& sequence);
+
+        /**
+         * Create a new SequenceBarrier to be used by a ByteEventProcessor to track the published chunks.
+         *
+         * \param sequencesToTrack the additional sequences to track
+         */
+        std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack = {});
+
+    private:
+        std::uint8_t* chunk(std::int64_t sequence) const;
+        std::int32_t checkedChunksFor(std::size_t length) const;
+        bool straddlesWrapPoint(std::int64_t lastSequence, std::int32_t chunks) const;
+        void publishPadding(std::int64_t lastSequence, std::int32_t chunks);
+        Claim newClaim(std::int64_t lastSequence, std::int32_t chunks, std::size_t length) const;
+
+        std::shared_ptr< ISequencer< ByteRecord > > m_sequencer;
+        ISequencer< ByteRecord >& m_sequencerRef;
+        std::int32_t m_chunkCount;
+        std::int32_t m_indexMask;
+        std::unique_ptr< std::uint8_t[], PlacementDeleter< std::uint8_t > > m_storage;
+        std::uint8_t* m_chunks;
+    };
+
+} // namespace Disruptor
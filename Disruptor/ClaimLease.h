@@ -0,0 +1,211 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/ArgumentNullException.h"
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/IEventTranslator.h"
+#include "Disruptor/ISequencer.h"
+
+
+namespace Disruptor
+{
+
+    template <class T, class TSequencer>
+    class RingBuffer;
+
+
+    /**
+     * Producer handle that claims sequences from a RingBuffer<T> by blocks of leaseSize and hands them out one by one, so that a publisher
+     * only touches the shared cursor once per block. Each sequence obtained from next() is published individually.
+     *
+     * The sequences of a lease that have not been handed out yet are published as filler events, written by the filler translator, when flush()
+     * is called, when the lease is destroyed, or once the lease has expired:
+     *  - when a flush timeout is set, next() flushes the current lease if it was claimed more than flushTimeout ago, before claiming a new one.
+     *  - a publisher that goes idle does not call next(), reclaimIfExpired() lets another thread, e.g. the ITimeoutHandler of a consumer, flush its
+     *    expired lease. This is only valid with a multi-producer sequencer: a single-producer sequencer would make the sequences handed out but not
+     *    yet published by the publisher visible as well.
+     * Until then consumers of a multi-producer ring buffer cannot read past the unused part of the lease.
+     *
+     * A ClaimLease should be used by a single publisher thread, only reclaimIfExpired() can be called concurrently. If the filler translator throws
+     * when the lease is destroyed, the exception is discarded and the unused sequences of the lease are not published.
+     *
+     * \tparam T implementation storing the data for sharing during exchange or parallel coordination of an event.
+     * \tparam TSequencer type of the sequencer of the ring buffer
+     */
+    template <class T, class TSequencer = ISequencer< T >>
+    class ClaimLease
+    {
+        // Stored in m_nextSequence while a new lease is installed, so that reclaimIfExpired() never sees a sequence with the end of another lease
+        static const std::int64_t installingLease = std::numeric_limits< std::int64_t >::max();
+
+    public:
+        /**
+         * \param ringBuffer ring buffer from which the sequences are claimed
+         * \param leaseSize number of sequences claimed at once, must be between 1 and the size of the ring buffer
+         * \param fillerTranslator translator writing the events published for the unused sequences of a lease
+         * \param flushTimeout time after which the unused sequences of a lease are flushed, zero to only flush explicitly
+         */
+        ClaimLease(const std::shared_ptr< RingBuffer< T, TSequencer > >& ringBuffer,
+                   std::int32_t leaseSize,
+                   const std::shared_ptr< IEventTranslator< T > >& fillerTranslator,
+                   ClockConfig::Duration flushTimeout = ClockConfig::Duration::zero())
+            : m_ringBuffer(ringBuffer)
+            , m_ringBufferRef(*m_ringBuffer)
+            , m_fillerTranslator(fillerTranslator)
+            , m_leaseSize(leaseSize)
+            , m_flushTimeout(flushTimeout)
+        {
+            if (fillerTranslator == nullptr)
+                DISRUPTOR_THROW_ARGUMENT_NULL_EXCEPTION(fillerTranslator);
+
+            if (leaseSize < 1 || leaseSize > m_ringBufferRef.bufferSize())
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("leaseSize must be > 0 and <= bufferSize");
+
+            if (flushTimeout < ClockConfig::Duration::zero())
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("flushTimeout must be >= 0");
+        }
+
+        ClaimLease(const ClaimLease&) = delete;
+        ClaimLease& operator=(const ClaimLease&) = delete;
+
+        ~ClaimLease()
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+        }
+
+        /**
+         * Get the next sequence of the current lease, claiming a new lease from the ring buffer when the current one is exhausted or has expired.
+         *
+         * \returns the claimed sequence value
+         */
+        std::int64_t next()
+        {
+            if (m_flushTimeout != ClockConfig::Duration::zero() && ClockConfig::Clock::now().time_since_epoch().count() >= m_leaseDeadline.load(std::memory_order_relaxed))
+                flush();
+
+            auto sequence = m_nextSequence.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                if (sequence > m_leaseEnd.load(std::memory_order_relaxed))
+                {
+                    return nextLease();
+                }
+
+                // Fails only if the rest of the lease has been reclaimed
+                if (m_nextSequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_relaxed))
+                    return sequence;
+            }
+        }
+
+        /**
+         * Get the event for a given sequence in the RingBuffer.
+         *
+         * \param sequence sequence for the event
+         */
+        T& operator[](std::int64_t sequence) const
+        {
+            return m_ringBufferRef[sequence];
+        }
+
+        /**
+         * Publish the specified sequence, obtained from next().
+         *
+         * \param sequence the sequence to publish.
+         */
+        void publish(std::int64_t sequence)
+        {
+            m_ringBufferRef.publish(sequence);
+        }
+
+        /**
+         * Publish the sequences of the current lease that have not been handed out, as filler events, and release the lease.
+         */
+        void flush()
+        {
+            auto sequence = m_nextSequence.load(std::memory_order_relaxed);
+            releaseRemaining(sequence, m_leaseEnd.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * Flush the current lease if it was claimed more than flushTimeout ago. Can be called from any thread, see the class description.
+         *
+         * \returns true if unused sequences of the lease were published
+         */
+        bool reclaimIfExpired()
+        {
+            if (m_flushTimeout == ClockConfig::Duration::zero())
+                return false;
+
+            // The acquire load of m_nextSequence makes the end and the deadline of its lease visible
+            auto sequence = m_nextSequence.load(std::memory_order_acquire);
+            auto leaseEnd = m_leaseEnd.load(std::memory_order_relaxed);
+            if (sequence > leaseEnd || ClockConfig::Clock::now().time_since_epoch().count() < m_leaseDeadline.load(std::memory_order_relaxed))
+                return false;
+
+            return releaseRemaining(sequence, leaseEnd);
+        }
+
+        /**
+         * Number of sequences of the current lease that have not been handed out yet.
+         */
+        std::int32_t remaining() const
+        {
+            auto sequence = m_nextSequence.load(std::memory_order_acquire);
+            if (sequence == installingLease)
+                return 0;
+
+            return static_cast< std::int32_t >(m_leaseEnd.load(std::memory_order_acquire) - sequence + 1);
+        }
+
+    private:
+        std::int64_t nextLease()
+        {
+            auto leaseEnd = m_ringBufferRef.next(m_leaseSize);
+            auto first = leaseEnd - (m_leaseSize - 1);
+
+            m_nextSequence.store(installingLease, std::memory_order_relaxed);
+            m_leaseDeadline.store((ClockConfig::Clock::now() + m_flushTimeout).time_since_epoch().count(), std::memory_order_relaxed);
+            m_leaseEnd.store(leaseEnd, std::memory_order_release);
+            m_nextSequence.store(first + 1, std::memory_order_release);
+
+            return first;
+        }
+
+        bool releaseRemaining(std::int64_t sequence, std::int64_t leaseEnd)
+        {
+            // Fails if the rest of the lease has been taken first, by the publisher or by another thread
+            if (sequence > leaseEnd || !m_nextSequence.compare_exchange_strong(sequence, leaseEnd + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return false;
+
+            for (auto i = sequence; i <= leaseEnd; ++i)
+            {
+                m_fillerTranslator->translateTo(m_ringBufferRef[i], i);
+            }
+
+            m_ringBufferRef.publish(sequence, leaseEnd);
+            return true;
+        }
+
+        std::shared_ptr< RingBuffer< T, TSequencer > > m_ringBuffer;
+        RingBuffer< T, TSequencer >& m_ringBufferRef;
+        std::shared_ptr< IEventTranslator< T > > m_fillerTranslator;
+        std::int32_t m_leaseSize;
+        ClockConfig::Duration m_flushTimeout;
+        std::atomic< std::int64_t > m_nextSequence { 0 };
+        std::atomic< std::int64_t > m_leaseEnd { -1 };
+        std::atomic< ClockConfig::Duration::rep > m_leaseDeadline { 0 };
+    };
+
+} // namespace Disruptor
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+
+namespace Disruptor
+{
+
+    /**
+     * Proxy to an event of a ColumnarRingBuffer: the fields of the event are stored in one array per field, at the index of the event.
+     *
+     * The proxies of a ColumnarRingBuffer are stored in index order, so that a span of events received through IBatchEventHandler<T>::onBatch
+     * maps to a contiguous range of each column, see column().
+     *
+     * \tparam TFields types of the fields of the event
+     */
+    template <class... TFields>
+    class ColumnarEvent
+    {
+    public:
+        using Columns = std::tuple< TFields*... >;
+
+        template <std::size_t I>
+        using FieldType = typename std::tuple_element< I, std::tuple< TFields... > >::type;
+
+        ColumnarEvent(const Columns* columns, std::int32_t index)
+            : m_columns(columns)
+            , m_index(index)
+        {
+        }
+
+        /**
+         * The field I of the event.
+         */
+        template <std::size_t I>
+        FieldType< I >& get() const
+        {
+            return std::get< I >(*m_columns)[m_index];
+        }
+
+        /**
+         * The field I of the event, followed in memory by the field I of the next events of the ring buffer up to the point where the ring wraps.
+         * Use it to process the field I of a whole span at once.
+         */
+        template <std::size_t I>
+        FieldType< I >* column() const
+        {
+            return std::get< I >(*m_columns) + m_index;
+        }
+
+        /**
+         * Index of the event in the ring buffer.
+         */
+        std::int32_t index() const
+        {
+            return m_index;
+        }
+
+    private:
+        const Columns* m_columns;
+        std::int32_t m_index;
+    };
+
+} // namespace Disruptor
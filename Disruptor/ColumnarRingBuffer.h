@@ -0,0 +1,292 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/ArgumentOutOfRangeException.h"
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/ColumnarEvent.h"
+#include "Disruptor/FetchAndAddMultiProducerSequencer.h"
+#include "Disruptor/ICursored.h"
+#include "Disruptor/IEventSequencer.h"
+#include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/ISequencer.h"
+#include "Disruptor/MultiProducerSequencer.h"
+#include "Disruptor/ProducerType.h"
+#include "Disruptor/SingleProducerSequencer.h"
+#include "Disruptor/Util.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Ring based store of events declared as a set of fields, each field being stored in its own array indexed by the sequence (struct of arrays).
+     * A consumer reading a single field only brings the cache lines of this field, and can process the field of a whole span of events at once.
+     *
+     * operator[] returns a ColumnarEvent<TFields...> proxy. When the BatchEventProcessor<T> of a ColumnarEvent<TFields...> is given an IBatchEventHandler<T>,
+     * each span maps to a contiguous range of every column, see ColumnarEvent::column().
+     *
+     * \tparam TFields types of the fields of the events, value initialized when the ring buffer is created
+     */
+    template <class... TFields>
+    class ColumnarRingBuffer : public IEventSequencer< ColumnarEvent< TFields... > >, public ICursored
+    {
+    public:
+        using EventType = ColumnarEvent< TFields... >;
+
+    private:
+        template <std::size_t I>
+        using FieldType = typename EventType::template FieldType< I >;
+
+        // Padding of each column, in elements, on both sides of the column
+        template <std::size_t I>
+        static constexpr std::int32_t columnPad()
+        {
+            return static_cast< std::int32_t >((128 + sizeof(FieldType< I >) - 1) / sizeof(FieldType< I >));
+        }
+
+    public:
+        /**
+         * Construct a ColumnarRingBuffer with the full option set.
+         *
+         * \param sequencer sequencer to handle the ordering of events moving through the ColumnarRingBuffer.
+         */
+        explicit ColumnarRingBuffer(const std::shared_ptr< ISequencer< EventType > >& sequencer)
+            : m_sequencer(sequencer)
+            , m_sequencerRef(*m_sequencer)
+        {
+            m_bufferSize = sequencer->bufferSize();
+
+            if (m_bufferSize < 1)
+            {
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("bufferSize must not be less than 1");
+            }
+
+            if (Util::ceilingNextPowerOfTwo(m_bufferSize) != m_bufferSize)
+            {
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("bufferSize must be a power of 2");
+            }
+
+            m_indexMask = m_bufferSize - 1;
+
+            initializeColumns(std::index_sequence_for< TFields... >());
+
+            m_events.reserve(m_bufferSize);
+            for (std::int32_t i = 0; i < m_bufferSize; ++i)
+            {
+                m_events.emplace_back(&m_columns, i);
+            }
+        }
+
+        ColumnarRingBuffer(const ColumnarRingBuffer&) = delete;
+        ColumnarRingBuffer& operator=(const ColumnarRingBuffer&) = delete;
+
+        /**
+         * Create a new ColumnarRingBuffer with the specified producer type.
+         *
+         * \param producerType producer type to use
+         * \param bufferSize number of events of the ring buffer, must be a power of 2
+         * \param waitStrategy used to determine how to wait for new elements to become available.
+         */
+        static std::shared_ptr< ColumnarRingBuffer< TFields... > > create(ProducerType producerType,
+                                                                          std::int32_t bufferSize,
+                                                                          const std::shared_ptr< IWaitStrategy >& waitStrategy)
+        {
+            switch (producerType)
+            {
+                case ProducerType::Single:
+                    return std::make_shared< ColumnarRingBuffer< TFields... > >(std::make_shared< SingleProducerSequencer< EventType > >(bufferSize, waitStrategy));
+                case ProducerType::Multi:
+                    return std::make_shared< ColumnarRingBuffer< TFields... > >(std::make_shared< MultiProducerSequencer< EventType > >(bufferSize, waitStrategy));
+                case ProducerType::MultiFetchAndAdd:
+                    return std::make_shared< ColumnarRingBuffer< TFields... > >(std::make_shared< FetchAndAddMultiProducerSequencer< EventType > >(bufferSize, waitStrategy));
+                default:
+                    DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(producerType);
+            }
+        }
+
+        /**
+         * Create a new single producer ColumnarRingBuffer using the default wait strategy BlockingWaitStrategy.
+         *
+         * \param bufferSize number of events of the ring buffer, must be a power of 2
+         */
+        static std::shared_ptr< ColumnarRingBuffer< TFields... > > createSingleProducer(std::int32_t bufferSize)
+        {
+            return create(ProducerType::Single, bufferSize, std::make_shared< BlockingWaitStrategy >());
+        }
+
+        /**
+         * Create a new multiple producer ColumnarRingBuffer using the default wait strategy BlockingWaitStrategy.
+         *
+         * \param bufferSize number of events of the ring buffer, must be a power of 2
+         */
+        static std::shared_ptr< ColumnarRingBuffer< TFields... > > createMultiProducer(std::int32_t bufferSize)
+        {
+            return create(ProducerType::Multi, bufferSize, std::make_shared< BlockingWaitStrategy >());
+        }
+
+        /**
+         * Get the proxy of the event for a given sequence in the ColumnarRingBuffer.
+         *
+         * \param sequence sequence for the event
+         */
+        EventType& operator[](std::int64_t sequence) const override
+        {
+            return m_events[static_cast< std::int32_t >(sequence) & m_indexMask];
+        }
+
+        /**
+         * The field I of the event for a given sequence.
+         *
+         * \param sequence sequence for the event
+         */
+        template <std::size_t I>
+        FieldType< I >& get(std::int64_t sequence) const
+        {
+            return std::get< I >(m_columns)[static_cast< std::int32_t >(sequence) & m_indexMask];
+        }
+
+        /**
+         * The array holding the field I of all the events, indexed by sequence & (bufferSize() - 1).
+         */
+        template <std::size_t I>
+        FieldType< I >* column() const
+        {
+            return std::get< I >(m_columns);
+        }
+
+        std::int32_t bufferSize() override
+        {
+            return m_bufferSize;
+        }
+
+        bool hasAvailableCapacity(std::int32_t requiredCapacity) override
+        {
+            return m_sequencerRef.hasAvailableCapacity(requiredCapacity);
+        }
+
+        std::int64_t next() override
+        {
+            return m_sequencerRef.next();
+        }
+
+        std::int64_t next(std::int32_t n) override
+        {
+            return m_sequencerRef.next(n);
+        }
+
+        std::int64_t tryNext() override
+        {
+            return m_sequencerRef.tryNext();
+        }
+
+        std::int64_t tryNext(std::int32_t n) override
+        {
+            return m_sequencerRef.tryNext(n);
+        }
+
+        /**
+         * Get the current cursor value for the ring buffer.  The actual value received will depend on the type of ISequencer that is being used.
+         */
+        std::int64_t cursor() const override
+        {
+            return m_sequencerRef.cursor();
+        }
+
+        /**
+         * Get the remaining capacity for this ring buffer.
+         *
+         * \returns The number of slots remaining.
+         */
+        std::int64_t getRemainingCapacity() override
+        {
+            return m_sequencerRef.getRemainingCapacity();
+        }
+
+        void publish(std::int64_t sequence) override
+        {
+            m_sequencerRef.publish(sequence);
+        }
+
+        /**
+         * Publish the specified sequences.  This action marks these particular messages as being available to be read.
+         *
+         * \param lo the lowest sequence number to be published
+         * \param hi the highest sequence number to be published
+         */
+        void publish(std::int64_t lo, std::int64_t hi) override
+        {
+            m_sequencerRef.publish(lo, hi);
+        }
+
+        bool isPublished(std::int64_t sequence)
+        {
+            return m_sequencerRef.isAvailable(sequence);
+        }
+
+        void addGatingSequences(const std::vector< std::shared_ptr< ISequence > >& gatingSequences)
+        {
+            m_sequencerRef.addGatingSequences(gatingSequences);
+        }
+
+        std::int64_t getMinimumGatingSequence()
+        {
+            return m_sequencerRef.getMinimumSequence();
+        }
+
+        /**
+         * Remove the specified sequence from this ring buffer.
+         *
+         * \param sequence sequence to be removed.
+         * \returns true if this sequence was found, false otherwise.
+         */
+        bool removeGatingSequence(const std::shared_ptr< ISequence >& sequence)
+        {
+            return m_sequencerRef.removeGatingSequence(sequence);
+        }
+
+        /**
+         * Create a new SequenceBarrier to be used by an EventProcessor to track which messages are available to be read from the ring buffer given a list of sequences to track.
+         *
+         * \param sequencesToTrack the additional sequences to track
+         * \returns A sequence barrier that will track the specified sequences.
+         */
+        std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack = {})
+        {
+            return m_sequencerRef.newBarrier(sequencesToTrack);
+        }
+
+    private:
+        template <std::size_t... I>
+        void initializeColumns(std::index_sequence< I... >)
+        {
+            using Expand = int[];
+            (void)Expand { 0, (initializeColumn< I >(), 0)... };
+        }
+
+        template <std::size_t I>
+        void initializeColumn()
+        {
+            auto& storage = std::get< I >(m_storage);
+            storage.resize(m_bufferSize + 2 * columnPad< I >());
+
+            std::get< I >(m_columns) = storage.data() + columnPad< I >();
+        }
+
+        char padding0[56];
+        typename EventType::Columns m_columns;
+        mutable std::vector< EventType > m_events;
+        std::int32_t m_indexMask;
+        std::int32_t m_bufferSize;
+        std::shared_ptr< ISequencer< EventType > > m_sequencer;
+        ISequencer< EventType >& m_sequencerRef;
+        std::tuple< std::vector< TFields >... > m_storage;
+        char padding1[32];
+    };
+
+} // namespace Disruptor
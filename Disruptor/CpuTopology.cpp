@@ -0,0 +1,233 @@
+#include "stdafx.h"
+#include "CpuTopology.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <tuple>
+
+#include "ArgumentException.h"
+#include "BuildConfig.h"
+#include "ThreadHelper.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    bool readFirstLine(const std::string& path, std::string& line)
+    {
+        std::ifstream stream(path);
+        return stream && std::getline(stream, line);
+    }
+
+    std::int32_t readInt32(const std::string& path, std::int32_t defaultValue)
+    {
+        std::string line;
+        if (!readFirstLine(path, line))
+            return defaultValue;
+
+        try
+        {
+            return std::stoi(line);
+        }
+        catch (std::exception&)
+        {
+            return defaultValue;
+        }
+    }
+
+    std::int32_t parseCpuId(const std::string& value, const std::string& cpuList)
+    {
+        std::size_t parsed = 0;
+        std::int32_t id = -1;
+
+        try
+        {
+            id = std::stoi(value, &parsed);
+        }
+        catch (std::exception&)
+        {
+        }
+
+        if (id < 0 || parsed != value.size())
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("Invalid CPU list: '" << cpuList << "'");
+
+        return id;
+    }
+
+    std::string trim(const std::string& value)
+    {
+        auto first = value.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos)
+            return std::string();
+
+        return value.substr(first, value.find_last_not_of(" \t\r\n") - first + 1);
+    }
+
+} // namespace
+
+
+    CpuTopology::CpuTopology(const std::vector< Cpu >& cpus)
+        : m_cpus(cpus)
+    {
+        std::sort(m_cpus.begin(), m_cpus.end(), [](const Cpu& lhs, const Cpu& rhs) { return lhs.id < rhs.id; });
+    }
+
+    CpuTopology CpuTopology::detect()
+    {
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        return fromSysfs("/sys/devices/system");
+#else
+        std::vector< Cpu > cpus;
+        for (auto i = 0; i < static_cast< std::int32_t >(ThreadHelper::getProcessorCount()); ++i)
+        {
+            cpus.push_back({ i, i, 0, 0 });
+        }
+        return CpuTopology(cpus);
+#endif
+    }
+
+    CpuTopology CpuTopology::fromSysfs(const std::string& systemPath)
+    {
+        std::string line;
+        std::vector< std::int32_t > cpuIds;
+        if (readFirstLine(systemPath + "/cpu/online", line))
+            cpuIds = parseCpuList(line);
+        else
+        {
+            for (auto i = 0; i < static_cast< std::int32_t >(ThreadHelper::getProcessorCount()); ++i)
+                cpuIds.push_back(i);
+        }
+
+        std::map< std::int32_t, std::int32_t > nodeByCpu;
+        if (readFirstLine(systemPath + "/node/online", line))
+        {
+            for (auto node : parseCpuList(line))
+            {
+                std::string cpuList;
+                if (!readFirstLine(systemPath + "/node/node" + std::to_string(node) + "/cpulist", cpuList))
+                    continue;
+
+                for (auto cpuId : parseCpuList(cpuList))
+                    nodeByCpu[cpuId] = node;
+            }
+        }
+
+        std::vector< Cpu > cpus;
+        for (auto cpuId : cpuIds)
+        {
+            auto topologyPath = systemPath + "/cpu/cpu" + std::to_string(cpuId) + "/topology/";
+            auto node = nodeByCpu.find(cpuId);
+
+            cpus.push_back({ cpuId,
+                             readInt32(topologyPath + "core_id", cpuId),
+                             readInt32(topologyPath + "physical_package_id", 0),
+                             node != nodeByCpu.end() ? node->second : 0 });
+        }
+
+        return CpuTopology(cpus);
+    }
+
+    std::vector< std::int32_t > CpuTopology::parseCpuList(const std::string& cpuList)
+    {
+        std::vector< std::int32_t > cpuIds;
+
+        std::istringstream stream(cpuList);
+        std::string range;
+        while (std::getline(stream, range, ','))
+        {
+            range = trim(range);
+            if (range.empty())
+                continue;
+
+            auto separator = range.find('-');
+            if (separator == std::string::npos)
+            {
+                cpuIds.push_back(parseCpuId(range, cpuList));
+                continue;
+            }
+
+            auto first = parseCpuId(trim(range.substr(0, separator)), cpuList);
+            auto last = parseCpuId(trim(range.substr(separator + 1)), cpuList);
+            if (last < first)
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("Invalid CPU list: '" << cpuList << "'");
+
+            for (auto id = first; id <= last; ++id)
+                cpuIds.push_back(id);
+        }
+
+        return cpuIds;
+    }
+
+    const std::vector< CpuTopology::Cpu >& CpuTopology::cpus() const
+    {
+        return m_cpus;
+    }
+
+    const CpuTopology::Cpu* CpuTopology::find(std::int32_t id) const
+    {
+        auto it = std::lower_bound(m_cpus.begin(), m_cpus.end(), id, [](const Cpu& cpu, std::int32_t cpuId) { return cpu.id < cpuId; });
+        if (it == m_cpus.end() || it->id != id)
+            return nullptr;
+
+        return &*it;
+    }
+
+    bool CpuTopology::areSiblings(std::int32_t cpuId, std::int32_t otherCpuId) const
+    {
+        auto cpu = find(cpuId);
+        auto otherCpu = find(otherCpuId);
+
+        return cpu != nullptr && otherCpu != nullptr && cpuId != otherCpuId && cpu->package == otherCpu->package && cpu->core == otherCpu->core;
+    }
+
+    std::vector< std::int32_t > CpuTopology::placementOrder(const std::vector< std::int32_t >& allowedCpus, bool avoidSiblings) const
+    {
+        std::set< std::int32_t > allowed(allowedCpus.begin(), allowedCpus.end());
+
+        // Per node, the first allowed CPU of each physical core, then its siblings
+        std::map< std::int32_t, std::vector< std::int32_t > > primariesByNode;
+        std::map< std::int32_t, std::vector< std::int32_t > > siblingsByNode;
+        std::set< std::tuple< std::int32_t, std::int32_t > > usedCores;
+
+        for (auto&& cpu : m_cpus)
+        {
+            if (allowed.count(cpu.id) == 0)
+                continue;
+
+            if (usedCores.insert(std::make_tuple(cpu.package, cpu.core)).second)
+                primariesByNode[cpu.node].push_back(cpu.id);
+            else
+                siblingsByNode[cpu.node].push_back(cpu.id);
+        }
+
+        std::vector< std::int32_t > nodes;
+        for (auto&& primaries : primariesByNode)
+            nodes.push_back(primaries.first);
+
+        // The node with the most physical cores hosts the first threads, ties go to the lowest node
+        std::stable_sort(nodes.begin(), nodes.end(), [&](std::int32_t lhs, std::int32_t rhs)
+        {
+            return primariesByNode[lhs].size() > primariesByNode[rhs].size();
+        });
+
+        // A node is filled, siblings included, before the threads spill to the next one: a pipeline rather shares a core than crosses the interconnect
+        std::vector< std::int32_t > order;
+        for (auto node : nodes)
+        {
+            auto first = order.size();
+            order.insert(order.end(), primariesByNode[node].begin(), primariesByNode[node].end());
+            order.insert(order.end(), siblingsByNode[node].begin(), siblingsByNode[node].end());
+
+            if (!avoidSiblings)
+                std::sort(order.begin() + first, order.end());
+        }
+
+        return order;
+    }
+
+} // namespace Disruptor
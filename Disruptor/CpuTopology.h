@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace Disruptor
+{
+
+    /**
+     * Layout of the logical CPUs of the machine: the physical core, the package (socket) and the NUMA node of each of them.
+     * Used to place threads exchanging events through a ring buffer on the same node, on distinct physical cores.
+     */
+    class CpuTopology
+    {
+    public:
+        struct Cpu
+        {
+            std::int32_t id;
+            std::int32_t core;
+            std::int32_t package;
+            std::int32_t node;
+        };
+
+        explicit CpuTopology(const std::vector< Cpu >& cpus);
+
+        /**
+         * Topology of the machine, read from /sys/devices/system on Linux. Elsewhere, each processor is reported as a core of a single node.
+         */
+        static CpuTopology detect();
+
+        /**
+         * Read the topology from a sysfs tree: the online CPUs from cpu/online, their core and package from cpu/cpuN/topology,
+         * and the CPUs of each online node from node/nodeN/cpulist. Missing entries default to one core per CPU on node 0.
+         *
+         * \param systemPath path of the sysfs system directory, usually /sys/devices/system
+         */
+        static CpuTopology fromSysfs(const std::string& systemPath);
+
+        /**
+         * Parse a CPU list in the kernel format, e.g. "0-3,8,10-11", as used by isolcpus, taskset or the sysfs cpulist files.
+         *
+         * \param cpuList the CPU list
+         * \returns the CPU ids, in the order of the list
+         */
+        static std::vector< std::int32_t > parseCpuList(const std::string& cpuList);
+
+        const std::vector< Cpu >& cpus() const;
+
+        /**
+         * \returns the CPU with the given id, nullptr if it is not part of the topology
+         */
+        const Cpu* find(std::int32_t id) const;
+
+        /**
+         * Returns true if the two CPUs are hyperthreads of the same physical core.
+         */
+        bool areSiblings(std::int32_t cpuId, std::int32_t otherCpuId) const;
+
+        /**
+         * Order the allowed CPUs for placing the threads of a pipeline, so that threads placed one after the other share a NUMA node.
+         * The CPUs of the node with the most allowed physical cores come first, then the CPUs of the other nodes. All the CPUs of a node, hyperthread
+         * siblings included, are used before the next node. When avoiding siblings, one CPU per physical core of the node is taken before its siblings.
+         *
+         * \param allowedCpus the CPUs threads may be placed on, CPUs which are not part of the topology are ignored
+         * \param avoidSiblings true to place threads on distinct physical cores of a node before using their siblings
+         * \returns the CPU ids in placement order
+         */
+        std::vector< std::int32_t > placementOrder(const std::vector< std::int32_t >& allowedCpus, bool avoidSiblings) const;
+
+    private:
+        std::vector< Cpu > m_cpus;
+    };
+
+} // namespace Disruptor
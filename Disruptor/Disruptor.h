@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <type_traits>
 
 #include "Disruptor/BasicExecutor.h"
 #include "Disruptor/BatchEventProcessor.h"
@@ -11,6 +12,7 @@
 #include "Disruptor/EventHandlerGroup.h"
 #include "Disruptor/ExceptionHandlerSetting.h"
 #include "Disruptor/ExceptionHandlerWrapper.h"
+#include "Disruptor/FunctionEventHandler.h"
 #include "Disruptor/IEventHandler.h"
 #include "Disruptor/IEventProcessorFactory.h"
 #include "Disruptor/InvalidOperationException.h"
@@ -114,6 +116,22 @@ namespace Disruptor
             return handleEventsWith(std::vector< std::shared_ptr< IEventHandler< T > > > { handler });
         }
 
+        /**
+         * Set up a callable to handle events from the ring buffer. The callable is invoked as function(T& data, std::int64_t sequence, bool endOfBatch).
+         * The BatchEventProcessor<T> created for it is bound to the concrete callable type, so the call is not dispatched through IEventHandler<T>.
+         * <code>
+         *  dw.handleEventsWith([](MyEvent& evt, std::int64_t sequence, bool endOfBatch) { ... });
+         * </code>
+         *
+         * \param function the callable that will process events
+         * \returns EventHandlerGroupType that can be used to chain dependencies.
+         */
+        template <class TFunction, typename std::enable_if< IsEventHandlerFunction< T, TFunction >::value, int >::type = 0>
+        std::shared_ptr< EventHandlerGroupType > handleEventsWith(const TFunction& function)
+        {
+            return createEventProcessor({ }, std::make_shared< FunctionEventHandler< T, TFunction > >(function));
+        }
+
         /**
          * Set up custom event processors to handle events from the ring buffer. The Disruptor will automatically start these processors when Start is called.
          * This method can be used as the start of a chain. For example if the handler A must process events before handler B: dw.handleEventsWith(A).Then(B);
@@ -435,6 +453,24 @@ namespace Disruptor
             return std::make_shared< EventHandlerGroupType >(this->shared_from_this(), m_consumerRepository, processorSequences);
         }
 
+        template <class TEventHandler>
+        std::shared_ptr< EventHandlerGroupType > createEventProcessor(const std::vector< std::shared_ptr< ISequence > >& barrierSequences,
+                                                                      const std::shared_ptr< TEventHandler >& eventHandler)
+        {
+            checkNotStarted();
+
+            auto barrier = m_ringBuffer->newBarrier(barrierSequences);
+
+            auto batchEventProcessor = std::make_shared< BatchEventProcessor< T, TEventHandler, RingBuffer< T > > >(m_ringBuffer, barrier, eventHandler);
+            if (m_exceptionHandler != nullptr)
+                batchEventProcessor->setExceptionHandler(m_exceptionHandler);
+
+            m_consumerRepository->add(batchEventProcessor, eventHandler, barrier);
+            m_consumerRepository->unMarkEventProcessorsAsEndOfChain(barrierSequences);
+
+            return std::make_shared< EventHandlerGroupType >(this->shared_from_this(), m_consumerRepository, std::vector< std::shared_ptr< ISequence > > { batchEventProcessor->sequence() });
+        }
+
         std::shared_ptr< EventHandlerGroupType > createWorkerPool(const std::vector< std::shared_ptr< ISequence > >& barrierSequences,
                                                                   const std::vector< std::shared_ptr< IWorkHandler< T > > >& workHandlers)
         {
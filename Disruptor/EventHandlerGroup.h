@@ -1,9 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "Disruptor/ConsumerRepository.h"
+#include "Disruptor/FunctionEventHandler.h"
 #include "Disruptor/IEventHandler.h"
 #include "Disruptor/IEventProcessorFactory.h"
 #include "Disruptor/ISequence.h"
@@ -106,6 +108,19 @@ namespace Disruptor
             return then(std::vector< std::shared_ptr< IEventHandler< T > > > { handler });
         }
 
+        /**
+         * Set up a callable to consume events from the ring buffer. The callable will only process events after every IEventProcessor in this group has processed the event.
+         * This method is generally used as part of a chain. For example if the handler A must process events before handler B: dw.handleEventsWith(A).then(B)
+         *
+         * \param function the callable that will process events, invoked as function(T& data, std::int64_t sequence, bool endOfBatch)
+         * \returns EventHandlerGroupType that can be used to chain dependencies.
+         */
+        template <class TFunction, typename std::enable_if< IsEventHandlerFunction< T, TFunction >::value, int >::type = 0>
+        std::shared_ptr< EventHandlerGroupType > then(const TFunction& function)
+        {
+            return handleEventsWith(function);
+        }
+
         /**
          * Set up custom event processors to handle events from the ring buffer. The Disruptor will automatically start these processors when Disruptor<T>::start() is called. 
          * This method is generally used as part of a chain. For example if the handler A must process events before handler B: dw.handleEventsWith(A).then(B)
@@ -167,6 +182,19 @@ namespace Disruptor
             return handleEventsWith(std::vector< std::shared_ptr< IEventHandler< T > > > { handler });
         }
 
+        /**
+         * Set up a callable to handle events from the ring buffer. The callable will only process events after every IEventProcessor in this group has processed the event.
+         * This method is generally used as part of a chain. For example if A must process events before B: dw.after(A).handleEventsWith(B)
+         *
+         * \param function the callable that will process events, invoked as function(T& data, std::int64_t sequence, bool endOfBatch)
+         * \returns EventHandlerGroupType that can be used to set up a event processor barrier over the created event processors.
+         */
+        template <class TFunction, typename std::enable_if< IsEventHandlerFunction< T, TFunction >::value, int >::type = 0>
+        std::shared_ptr< EventHandlerGroupType > handleEventsWith(const TFunction& function)
+        {
+            return m_disruptor->createEventProcessor(m_sequences, std::make_shared< FunctionEventHandler< T, TFunction > >(function));
+        }
+
         /**
          * Set up custom event processors to handle events from the ring buffer. The Disruptor will automatically start these processors when Disruptor<T>::start() is called.
          * This method is generally used as part of a chain. For example if A must process events before B: dw.after(A).handleEventsWith(B)
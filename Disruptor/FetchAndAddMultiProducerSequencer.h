@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+
+#include "Disruptor/MultiProducerSequencerBase.h"
+#include "Disruptor/SpinWait.h"
+#include "Disruptor/Util.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Coordinator for claiming sequences for access to a data structure while tracking dependent Sequences. Suitable for use for sequencing across many publisher threads.
+     *
+     * Unlike MultiProducerSequencer, next() claims its sequences with a single atomic fetch-and-add on the cursor instead of a compare-and-set loop,
+     * so concurrent publishers never have to retry their claim. The wrap point is checked after the claim: a publisher that has claimed a slot
+     * not yet released by the slowest consumer waits for it to move on.
+     */ 
+    template <class T, class TWaitStrategy = IWaitStrategy>
+    class FetchAndAddMultiProducerSequencer : public MultiProducerSequencerBase< T, TWaitStrategy >
+    {
+    public:
+        FetchAndAddMultiProducerSequencer(std::int32_t bufferSize, const std::shared_ptr< TWaitStrategy >& waitStrategy, const MemoryPlacement& placement = MemoryPlacement())
+            : MultiProducerSequencerBase< T, TWaitStrategy >(bufferSize, waitStrategy, placement)
+        {
+        }
+
+        /**
+         * Claim the next event in sequence for publishing.
+         */ 
+        std::int64_t next() override
+        {
+            return next(1);
+        }
+
+        /**
+         * Claim the next n events in sequence for publishing. The claim itself always succeeds, the call then waits until the claimed slots
+         * have been released by the gating sequences.
+         * 
+         * \param n the number of sequences to claim
+         * \returns the highest claimed sequence value
+         */ 
+        std::int64_t next(std::int32_t n) override
+        {
+            if (n < 1 || n > this->m_bufferSize)
+            {
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("n must be > 0 and < bufferSize");
+            }
+
+            auto next = this->m_cursorRef.Sequence::addAndGet(n);
+            auto current = next - n;
+
+            auto wrapPoint = next - this->m_bufferSize;
+            auto cachedGatingSequence = this->m_gatingSequenceCache->value();
+
+            if (wrapPoint > cachedGatingSequence || cachedGatingSequence > current)
+            {
+                SpinWait spinWait;
+                std::int64_t gatingSequence;
+
+                while (wrapPoint > (gatingSequence = this->m_gatingSequences.minimumSequence(current, wrapPoint)))
+                {
+                    WaitStrategyDispatch< TWaitStrategy >::signalAllWhenBlocking(this->m_waitStrategyRef);
+                    spinWait.spinOnce();
+                }
+
+                this->m_gatingSequenceCache->setValue(gatingSequence);
+            }
+
+            return next;
+        }
+
+        /**
+         * Create a ISequenceBarrier that gates on the the cursor and a list of Sequences.
+         * The barrier is bound to the concrete sequencer and wait strategy types so its waitFor() does not go through virtual calls.
+         *
+         * \param sequencesToTrack
+         */
+        std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack) override
+        {
+            return std::make_shared< ProcessingSequenceBarrier< FetchAndAddMultiProducerSequencer, TWaitStrategy > >(std::static_pointer_cast< FetchAndAddMultiProducerSequencer >(this->shared_from_this()),
+                                                                                                                      this->m_waitStrategy,
+                                                                                                                      this->m_cursor,
+                                                                                                                      sequencesToTrack);
+        }
+    };
+
+} // namespace Disruptor
@@ -4,7 +4,6 @@
 #include <ostream>
 
 #include "NotSupportedException.h"
-#include "Util.h"
 
 
 namespace Disruptor
@@ -17,7 +16,7 @@ namespace Disruptor
 
     std::int64_t FixedSequenceGroup::value() const
     {
-        return Util::getMinimumSequence(m_sequences);
+        return m_sequences.minimumSequence();
     }
 
     void FixedSequenceGroup::setValue(std::int64_t /*value*/)
@@ -43,7 +42,7 @@ namespace Disruptor
     void FixedSequenceGroup::writeDescriptionTo(std::ostream& stream) const
     {
         auto firstItem = true;
-        for (auto&& sequence : m_sequences)
+        for (auto&& sequence : m_sequences.sequences())
         {
             if (firstItem)
                 firstItem = false;
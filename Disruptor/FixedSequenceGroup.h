@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Disruptor/ISequence.h"
+#include "Disruptor/SequenceArray.h"
 
 
 namespace Disruptor
@@ -48,8 +49,16 @@ namespace Disruptor
 
         void writeDescriptionTo(std::ostream& stream) const override;
 
+        /**
+         * The sequences tracked under this sequence group
+         */
+        const std::vector< std::shared_ptr< ISequence > >& sequences() const
+        {
+            return m_sequences.sequences();
+        }
+
     private:
-        std::vector< std::shared_ptr< ISequence > > m_sequences;
+        SequenceArray m_sequences;
     };
 
 } // namespace Disruptor
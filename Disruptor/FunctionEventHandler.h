@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "Disruptor/IEventHandler.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * IEventHandler<T> adapter over a callable with the signature void(T& data, std::int64_t sequence, bool endOfBatch).
+     *
+     * The class is final and stores the callable by value, so a BatchEventProcessor<T, FunctionEventHandler<T, TFunction>> calls the callable directly
+     * and a lambda body can be inlined in the processing loop.
+     *
+     * \tparam T Type of events for sharing during exchange or parallel coordination of an event
+     * \tparam TFunction type of the callable invoked for each event
+     */
+    template <class T, class TFunction>
+    class FunctionEventHandler final : public IEventHandler< T >
+    {
+    public:
+        explicit FunctionEventHandler(const TFunction& function)
+            : m_function(function)
+        {
+        }
+
+        void onEvent(T& data, std::int64_t sequence, bool endOfBatch) override
+        {
+            m_function(data, sequence, endOfBatch);
+        }
+
+    private:
+        TFunction m_function;
+    };
+
+
+    /**
+     * Detects whether TFunction can be used as the callable of a FunctionEventHandler<T, TFunction>
+     */
+    template <class T, class TFunction, class = void>
+    struct IsEventHandlerFunction : std::false_type
+    {
+    };
+
+    template <class T, class TFunction>
+    struct IsEventHandlerFunction< T, TFunction, decltype(void(std::declval< TFunction& >()(std::declval< T& >(), std::declval< std::int64_t >(), std::declval< bool >()))) > : std::true_type
+    {
+    };
+
+} // namespace Disruptor
@@ -0,0 +1,46 @@
+#include "stdafx.h"
+#include "Futex.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <cerrno>
+#include <climits>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+namespace Disruptor
+{
+namespace Futex
+{
+
+    bool wait(std::atomic< std::int32_t >& futexWord, std::int32_t expectedValue, const timespec* timeout)
+    {
+        auto result = syscall(SYS_futex, reinterpret_cast< std::int32_t* >(&futexWord), FUTEX_WAIT_PRIVATE, expectedValue, timeout, nullptr, 0);
+
+        return result == 0 || errno != ETIMEDOUT;
+    }
+
+    void wakeAll(std::atomic< std::int32_t >& futexWord)
+    {
+        syscall(SYS_futex, reinterpret_cast< std::int32_t* >(&futexWord), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+    bool waitShared(std::atomic< std::int32_t >& futexWord, std::int32_t expectedValue, const timespec* timeout)
+    {
+        auto result = syscall(SYS_futex, reinterpret_cast< std::int32_t* >(&futexWord), FUTEX_WAIT, expectedValue, timeout, nullptr, 0);
+
+        return result == 0 || errno != ETIMEDOUT;
+    }
+
+    void wakeAllShared(std::atomic< std::int32_t >& futexWord)
+    {
+        syscall(SYS_futex, reinterpret_cast< std::int32_t* >(&futexWord), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+} // namespace Futex
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+
+
+namespace Disruptor
+{
+namespace Futex
+{
+
+    /**
+     * Park the calling thread while futexWord holds expectedValue, until woken up, interrupted or timed out.
+     * Returns immediately if the word no longer holds expectedValue. Spurious wake-ups must be handled by the caller.
+     *
+     * \param futexWord the futex word, private to the process
+     * \param expectedValue the value read from the word before re-checking the wait condition
+     * \param timeout the maximum time to park, nullptr to park without timeout
+     * \returns false if the timeout elapsed, true otherwise
+     */
+    bool wait(std::atomic< std::int32_t >& futexWord, std::int32_t expectedValue, const timespec* timeout = nullptr);
+
+    /**
+     * Wake all the threads parked on futexWord.
+     */
+    void wakeAll(std::atomic< std::int32_t >& futexWord);
+
+    /**
+     * Same as wait(), for a futex word in memory shared between processes, e.g. in a SharedMemoryRegion.
+     */
+    bool waitShared(std::atomic< std::int32_t >& futexWord, std::int32_t expectedValue, const timespec* timeout = nullptr);
+
+    /**
+     * Wake all the threads parked on a futex word shared between processes, in any of these processes.
+     */
+    void wakeAllShared(std::atomic< std::int32_t >& futexWord);
+
+} // namespace Futex
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,94 @@
+#include "stdafx.h"
+#include "FutexWaitStrategy.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <ostream>
+
+#include "Futex.h"
+#include "ISequenceBarrier.h"
+#include "Sequence.h"
+
+
+namespace Disruptor
+{
+
+    std::int64_t FutexWaitStrategy::waitFor(std::int64_t sequence,
+                                            Sequence& cursor,
+                                            ISequence& dependentSequence,
+                                            ISequenceBarrier& barrier)
+    {
+        auto result = tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+
+        return result.sequence;
+    }
+
+    SequenceWaitResult FutexWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                     Sequence& cursor,
+                                                     ISequence& dependentSequence,
+                                                     ISequenceBarrier& barrier)
+    {
+        if (cursor.value() < sequence)
+        {
+            m_waiters.fetch_add(1);
+
+            auto alerted = false;
+            while (true)
+            {
+                // The word is read before the cursor: a publish made after this read advances the word and fails the futex wait
+                auto futexValue = m_futexWord.load();
+
+                if (cursor.value() >= sequence)
+                    break;
+
+                if (barrier.isAlerted())
+                {
+                    alerted = true;
+                    break;
+                }
+
+                Futex::wait(m_futexWord, futexValue);
+            }
+
+            m_waiters.fetch_sub(1);
+
+            if (alerted)
+                return SequenceWaitResult::alerted();
+        }
+
+        return m_waiterRegistry.tryWaitFor(sequence, dependentSequence, barrier);
+    }
+
+    void FutexWaitStrategy::signalAllWhenBlocking()
+    {
+        // Orders the cursor update before the waiter count read, pairs with the increment of m_waiters in tryWaitFor()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_waiters.load(std::memory_order_relaxed) != 0)
+        {
+            m_futexWord.fetch_add(1);
+            Futex::wakeAll(m_futexWord);
+        }
+    }
+
+    void FutexWaitStrategy::signalAllWhenAlerted()
+    {
+        signalAllWhenBlocking();
+        m_waiterRegistry.wakeAll();
+    }
+
+    WaitQueue* FutexWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return &m_waiterRegistry.registerSequence(sequence);
+    }
+
+    void FutexWaitStrategy::writeDescriptionTo(std::ostream& stream) const
+    {
+        stream << "FutexWaitStrategy";
+    }
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <atomic>
+#include <cstdint>
+
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaiterRegistry.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Blocking strategy parking the waiting threads directly on a futex, without the mutex and condition variable round trip of the BlockingWaitStrategy.
+     *
+     * The futex word is a 32-bit wake counter, advanced by the publishers only when a consumer has registered itself as parked.
+     * When no consumer is parked, signalAllWhenBlocking() costs a fence and an atomic load, otherwise a single FUTEX_WAKE.
+     *
+     * This strategy is only available on Linux and should be used for low rate rings that need blocking semantics with a low wake-up latency.
+     */
+    class FutexWaitStrategy : public IWaitStrategy
+    {
+    public:
+        /**
+         * \see IWaitStrategy::waitFor
+         */
+        std::int64_t waitFor(std::int64_t sequence,
+                             Sequence& cursor,
+                             ISequence& dependentSequence,
+                             ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenBlocking
+         */
+        void signalAllWhenBlocking() override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
+        void writeDescriptionTo(std::ostream& stream) const override;
+
+    private:
+        std::atomic< std::int32_t > m_futexWord { 0 };
+        std::atomic< std::int32_t > m_waiters { 0 };
+        WaiterRegistry m_waiterRegistry;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
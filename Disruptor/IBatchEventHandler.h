@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Disruptor/IEventHandler.h"
+
+
+namespace Disruptor
+{
+
+    /**
+      * Implement this interface in your IEventHandler<T> to receive the available events as contiguous spans instead of one onEvent() call per event.
+      *
+      * When the BatchEventProcessor<T> reads from a RingBuffer<T>, each batch is split into at most two spans, at the point where the ring wraps.
+      * With any other IDataProvider<T> the events are delivered one per span.
+      *
+      * \tparam T Type of events for sharing during exchange or parallel coordination of an event
+      */
+    template <class T>
+    class IBatchEventHandler : public IEventHandler< T >
+    {
+    public:
+        /**
+          * Called when a publisher has committed a range of events to the RingBuffer<T>
+          *
+          * \param first first event of the span, the events of the span are stored contiguously
+          * \param count number of events in the span
+          * \param firstSequence sequence number of the first event of the span
+          */
+        virtual void onBatch(T* first, std::size_t count, std::int64_t firstSequence) = 0;
+
+        void onEvent(T& data, std::int64_t sequence, bool /*endOfBatch*/) override
+        {
+            onBatch(&data, 1, sequence);
+        }
+    };
+
+} // namespace Disruptor
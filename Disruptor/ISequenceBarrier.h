@@ -1,11 +1,20 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+
+#include "Disruptor/AlertException.h"
+#include "Disruptor/SequenceWaitResult.h"
+#include "Disruptor/TimeoutException.h"
 
 
 namespace Disruptor
 {
 
+    class ISequence;
+    class WaitQueue;
+
+
     /**
      * Coordination barrier for tracking the cursor for producers and sequence of dependent IEventProcessor's for a RingBuffer<T>
      */ 
@@ -22,6 +31,29 @@ namespace Disruptor
          */ 
         virtual std::int64_t waitFor(std::int64_t sequence) = 0;
 
+        /**
+         * Wait for the given sequence to be available for consumption, reporting an alert or a timeout as a status rather than throwing.
+         * The default implementation translates the exceptions thrown by waitFor().
+         *
+         * \param sequence sequence to wait for
+         * \returns the sequence up to which is available, or the reason why the wait ended before
+         */
+        virtual SequenceWaitResult tryWaitFor(std::int64_t sequence)
+        {
+            try
+            {
+                return SequenceWaitResult::available(waitFor(sequence));
+            }
+            catch (const AlertException&)
+            {
+                return SequenceWaitResult::alerted();
+            }
+            catch (const TimeoutException&)
+            {
+                return SequenceWaitResult::timedOut();
+            }
+        }
+
         /**
          * Delegate a call to the Sequencer.cursor()
          * Returns the value of the cursor for events that have been published.
@@ -47,6 +79,16 @@ namespace Disruptor
          * Check if an alert has been raised and throw an AlertException if it has.
          */ 
         virtual void checkAlert() = 0;
+
+        /**
+         * Register the sequence of the IEventProcessor waiting on this barrier with the wait strategy, see IWaitStrategy::registerDependentSequence.
+         *
+         * \returns the queue to wake after each update of the sequence, nullptr if the barriers do not park on the sequences of IEventProcessors
+         */
+        virtual WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& /*sequence*/)
+        {
+            return nullptr;
+        }
     };
 
 } // namespace Disruptor
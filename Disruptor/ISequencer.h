@@ -57,6 +57,17 @@ namespace Disruptor
          */ 
         virtual bool removeGatingSequence(const std::shared_ptr< ISequence >& sequence) = 0;
 
+        /**
+         * Track the gating sequences by groups with a cached minimum, so that a producer only reads the sequences of the groups lagging behind
+         * its wrap point instead of all of them. Worth enabling when many event processors gate the sequencer.
+         * The default implementation ignores the group size, for the sequencers which do not support groups.
+         *
+         * \param groupSize number of gating sequences per group, 0 to read all the gating sequences (default)
+         */
+        virtual void setGatingSequenceGroupSize(std::int32_t /*groupSize*/)
+        {
+        }
+
         /**
          * Create a ISequenceBarrier that gates on the the cursor and a list of Sequences
          * 
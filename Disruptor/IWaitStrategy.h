@@ -4,6 +4,9 @@
 #include <iosfwd>
 #include <memory>
 
+#include "Disruptor/SequenceWaitResult.h"
+#include "Disruptor/TimeoutException.h"
+
 
 namespace Disruptor
 {
@@ -11,6 +14,7 @@ namespace Disruptor
     class ISequence;
     class ISequenceBarrier;
     class Sequence;
+    class WaitQueue;
 
 
     class IWaitStrategy
@@ -34,11 +38,65 @@ namespace Disruptor
                                      ISequence& dependentSequence,
                                      ISequenceBarrier& barrier) = 0;
 
+        /**
+         * Wait for the given sequence to be available, reporting a timeout as a status rather than throwing a TimeoutException. The strategies which park
+         * also report an alert of the barrier as SequenceWaitStatus::Alerted, the spinning ones raise it by ISequenceBarrier::checkAlert(). The default
+         * implementation translates the TimeoutException thrown by waitFor(), the parking strategies override it.
+         *
+         * \param sequence sequence to be waited on.
+         * \param cursor Ring buffer cursor on which to wait.
+         * \param dependentSequence on which to wait.
+         * \param barrier barrier the IEventProcessor is waiting on.
+         * \returns the sequence that is available, SequenceWaitStatus::Alerted or SequenceWaitStatus::TimedOut
+         */
+        virtual SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                              Sequence& cursor,
+                                              ISequence& dependentSequence,
+                                              ISequenceBarrier& barrier)
+        {
+            try
+            {
+                return SequenceWaitResult::available(waitFor(sequence, cursor, dependentSequence, barrier));
+            }
+            catch (const TimeoutException&)
+            {
+                return SequenceWaitResult::timedOut();
+            }
+        }
+
         /**
          * Signal those IEventProcessor waiting that the cursor has advanced.
          */ 
         virtual void signalAllWhenBlocking() = 0;
 
+        /**
+         * Signal all the waiters, including those parked on the sequences of IEventProcessors, e.g. to let them observe an alert.
+         */
+        virtual void signalAllWhenAlerted()
+        {
+            signalAllWhenBlocking();
+        }
+
+        /**
+         * Register the sequence of an IEventProcessor, so that the barriers gated on it can park instead of busy spinning.
+         *
+         * \param sequence the sequence of the IEventProcessor
+         * \returns the queue to wake after each update of the sequence, nullptr if the strategy does not park on the sequences of IEventProcessors
+         */
+        virtual WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& /*sequence*/)
+        {
+            return nullptr;
+        }
+
+        /**
+         * Called when a barrier which may have waited on the strategy is destroyed, so that the strategy can release the state it keeps for it.
+         *
+         * \param barrier the barrier being destroyed
+         */
+        virtual void unregisterBarrier(const ISequenceBarrier& /*barrier*/)
+        {
+        }
+
         virtual void writeDescriptionTo(std::ostream& stream) const = 0;
     };
 
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Disruptor/ArgumentOutOfRangeException.h"
+#include "Disruptor/IEventTranslator.h"
+#include "Disruptor/JournalSegment.h"
+#include "Disruptor/RingBuffer.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Reads back the journal written by a JournalingEventHandler<T>, publishing its events to a RingBuffer<T>.
+     *
+     * The segments are read in order, up to the first incomplete record of each one. The replay stops at the first record which does not verify, see
+     * JournalSegment: the events journalled after it would be published after a gap. The events are copied from the mappings of the segments into the
+     * ring buffer in batches, through RingBuffer<T>::publishEvents(). This class is only available on Linux.
+     *
+     * \tparam T event implementation storing the data for sharing during exchange or parallel coordination of an event, must be trivially copyable.
+     */
+    template <class T>
+    class JournalReplayer
+    {
+        static_assert(std::is_trivially_copyable< T >::value, "Journalled events must be trivially copyable");
+
+        class RecordTranslator : public IEventTranslator< T >
+        {
+        public:
+            void translateTo(T& eventData, std::int64_t /*sequence*/) override
+            {
+                eventData = *m_entry;
+            }
+
+            const T* m_entry = nullptr;
+        };
+
+    public:
+        /**
+         * \param directory directory of the journal
+         * \param batchSize maximum number of events published at once, bounded by the size of the ring buffer
+         */
+        explicit JournalReplayer(const std::string& directory, std::int32_t batchSize = 256)
+            : m_directory(directory)
+        {
+            if (batchSize < 1)
+                DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(batchSize);
+
+            for (std::int32_t i = 0; i < batchSize; ++i)
+                m_translators.push_back(std::make_shared< RecordTranslator >());
+        }
+
+        /**
+         * Publish the journalled events to a ring buffer, blocking while it is full.
+         *
+         * \param ringBuffer ring buffer to publish to
+         * \param fromSequence the events journalled with a lower sequence are skipped
+         * \returns the number of published events
+         */
+        std::int64_t replay(RingBuffer< T >& ringBuffer, std::int64_t fromSequence = 0)
+        {
+            auto batchSize = std::min(static_cast< std::int32_t >(m_translators.size()), ringBuffer.bufferSize());
+            std::int64_t published = 0;
+
+            for (auto index : JournalSegment::list(m_directory))
+            {
+                auto segment = JournalSegment::open(m_directory, index, sizeof(T), alignof(T));
+
+                std::int32_t pending = 0;
+                for (std::int32_t record = 0; record < segment->recordCount(); ++record)
+                {
+                    if (segment->sequenceAt(record) < fromSequence)
+                        continue;
+
+                    m_translators[pending]->m_entry = static_cast< const T* >(segment->entryAt(record));
+
+                    if (++pending == batchSize)
+                    {
+                        ringBuffer.publishEvents(m_translators, 0, pending);
+                        published += pending;
+                        pending = 0;
+                    }
+                }
+
+                // The entries are read from the mapping of the segment, the batch is published before it is unmapped
+                if (pending > 0)
+                {
+                    ringBuffer.publishEvents(m_translators, 0, pending);
+                    published += pending;
+                }
+
+                if (segment->isCorrupted())
+                    break;
+            }
+
+            return published;
+        }
+
+    private:
+        std::string m_directory;
+        std::vector< std::shared_ptr< RecordTranslator > > m_translators;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,349 @@
+#include "stdafx.h"
+#include "JournalSegment.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "InvalidOperationException.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    struct SegmentHeader
+    {
+        std::uint64_t magic;
+        std::int32_t version;
+        std::int32_t reserved;
+        std::int64_t index;
+        std::uint64_t size;
+        std::uint64_t entrySize;
+        std::uint64_t entryAlignment;
+        std::uint64_t recordSize;
+    };
+
+    // The records start on a cache line, and the segments are mapped at page boundaries
+    const std::size_t headerSize = 64;
+    const std::size_t maxEntryAlignment = 64;
+
+    static_assert(sizeof(SegmentHeader) <= headerSize, "The header of a segment must fit before its records");
+
+    const std::size_t indexDigits = 20;
+    const std::string fileExtension = ".journal";
+
+    std::size_t alignUp(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    std::size_t entryOffset(std::size_t entryAlignment)
+    {
+        return alignUp(sizeof(JournalSegment::RecordHeader), entryAlignment);
+    }
+
+    std::size_t recordSize(std::size_t entrySize, std::size_t entryAlignment)
+    {
+        return alignUp(entryOffset(entryAlignment) + entrySize, std::max(alignof(JournalSegment::RecordHeader), entryAlignment));
+    }
+
+    // Reflected Castagnoli polynomial
+    const std::uint32_t crc32cPolynomial = 0x82f63b78;
+
+    const std::uint32_t* crc32cTable()
+    {
+        static const auto table = []
+        {
+            std::array< std::uint32_t, 256 > result;
+            for (std::uint32_t i = 0; i < 256; ++i)
+            {
+                auto crc = i;
+                for (auto bit = 0; bit < 8; ++bit)
+                    crc = (crc >> 1) ^ (crc & 1 ? crc32cPolynomial : 0);
+
+                result[i] = crc;
+            }
+            return result;
+        }();
+
+        return table.data();
+    }
+
+    std::uint32_t updateCrc32c(std::uint32_t crc, const void* data, std::size_t size)
+    {
+        auto table = crc32cTable();
+        auto bytes = static_cast< const std::uint8_t* >(data);
+
+        for (std::size_t i = 0; i < size; ++i)
+            crc = table[(crc ^ bytes[i]) & 0xff] ^ (crc >> 8);
+
+        return crc;
+    }
+
+    void syncDirectory(const std::string& directory)
+    {
+        auto descriptor = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+        if (descriptor < 0)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to open the journal directory " << directory << " (errno " << errno << ")");
+
+        auto result = fsync(descriptor);
+        auto error = errno;
+        close(descriptor);
+
+        if (result != 0)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to sync the journal directory " << directory << " (errno " << error << ")");
+    }
+
+} // namespace
+
+
+    const std::uint64_t JournalSegment::magicNumber = 0x314c4e524a525344;
+    const std::int32_t JournalSegment::layoutVersion = 2;
+    const std::uint32_t JournalSegment::recordMarker = 0x4c4e524a;
+
+    JournalSegment::JournalSegment(const std::string& path, std::int64_t index, std::uint8_t* address, std::size_t size, std::size_t entrySize, std::size_t entryAlignment)
+        : m_path(path)
+        , m_index(index)
+        , m_address(address)
+        , m_size(size)
+        , m_records(address + headerSize)
+        , m_entrySize(entrySize)
+        , m_entryOffset(entryOffset(entryAlignment))
+        , m_recordSize(recordSize(entrySize, entryAlignment))
+        , m_capacity(static_cast< std::int32_t >((size - headerSize) / m_recordSize))
+        , m_recordCount(0)
+        , m_isCorrupted(false)
+        , m_syncedSize(0)
+        , m_pageSize(static_cast< std::size_t >(sysconf(_SC_PAGESIZE)))
+    {
+    }
+
+    JournalSegment::~JournalSegment()
+    {
+        munmap(m_address, m_size);
+    }
+
+    std::unique_ptr< JournalSegment > JournalSegment::create(const std::string& directory, std::int64_t index, std::size_t size, std::size_t entrySize, std::size_t entryAlignment)
+    {
+        if (entryAlignment > maxEntryAlignment)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Journalled events must be aligned on at most " << maxEntryAlignment << " bytes, not " << entryAlignment);
+
+        auto records = size < headerSize ? 0 : (size - headerSize) / recordSize(entrySize, entryAlignment);
+        if (records < 1 || records > static_cast< std::size_t >(std::numeric_limits< std::int32_t >::max()))
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("A journal segment of " << size << " bytes must hold between 1 and 2^31 - 1 records of " << entrySize << " bytes");
+
+        auto segmentPath = path(directory, index);
+
+        auto descriptor = ::open(segmentPath.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if (descriptor < 0)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to create the journal segment " << segmentPath << " (errno " << errno << ")");
+
+        // Allocates the blocks of the file, instead of extending it with a hole which could fail to be filled once mapped
+        auto error = posix_fallocate(descriptor, 0, static_cast< off_t >(size));
+
+        void* address = MAP_FAILED;
+        if (error == 0)
+        {
+            address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+            if (address == MAP_FAILED)
+                error = errno;
+        }
+
+        close(descriptor);
+
+        if (address == MAP_FAILED)
+        {
+            unlink(segmentPath.c_str());
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to allocate the journal segment " << segmentPath << " (errno " << error << ")");
+        }
+
+        std::unique_ptr< JournalSegment > segment(new JournalSegment(segmentPath, index, static_cast< std::uint8_t* >(address), size, entrySize, entryAlignment));
+
+        auto header = reinterpret_cast< SegmentHeader* >(address);
+        header->magic = magicNumber;
+        header->version = layoutVersion;
+        header->index = index;
+        header->size = size;
+        header->entrySize = entrySize;
+        header->entryAlignment = entryAlignment;
+        header->recordSize = segment->m_recordSize;
+
+        syncDirectory(directory);
+
+        return segment;
+    }
+
+    std::unique_ptr< JournalSegment > JournalSegment::open(const std::string& directory, std::int64_t index, std::size_t entrySize, std::size_t entryAlignment)
+    {
+        auto segmentPath = path(directory, index);
+
+        auto descriptor = ::open(segmentPath.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to open the journal segment " << segmentPath << " (errno " << errno << ")");
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0)
+        {
+            auto error = errno;
+            close(descriptor);
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to read the size of the journal segment " << segmentPath << " (errno " << error << ")");
+        }
+
+        auto size = static_cast< std::size_t >(status.st_size);
+        if (size < headerSize)
+        {
+            close(descriptor);
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The journal segment " << segmentPath << " is truncated");
+        }
+
+        auto address = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+        auto error = errno;
+        close(descriptor);
+
+        if (address == MAP_FAILED)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to map the journal segment " << segmentPath << " (errno " << error << ")");
+
+        auto header = static_cast< const SegmentHeader* >(address);
+        if (header->magic != magicNumber || header->version != layoutVersion || header->index != index || header->size != size)
+        {
+            munmap(address, size);
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The file " << segmentPath << " is not a segment of version " << layoutVersion << " of this journal");
+        }
+
+        if (header->entrySize != entrySize || header->entryAlignment != entryAlignment || header->recordSize != recordSize(entrySize, entryAlignment))
+        {
+            auto journalledSize = header->entrySize;
+            auto journalledAlignment = header->entryAlignment;
+            munmap(address, size);
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The journal segment " << segmentPath << " holds events of " << journalledSize << " bytes aligned on "
+                                                        << journalledAlignment << ", not of " << entrySize << " bytes aligned on " << entryAlignment);
+        }
+
+        std::unique_ptr< JournalSegment > segment(new JournalSegment(segmentPath, index, static_cast< std::uint8_t* >(address), size, entrySize, entryAlignment));
+
+        auto&& s = *segment;
+        while (s.m_recordCount < s.m_capacity)
+        {
+            auto record = s.m_records + static_cast< std::size_t >(s.m_recordCount) * s.m_recordSize;
+            auto header = reinterpret_cast< const RecordHeader* >(record);
+
+            // A record never appended is left filled with zeros
+            auto marker = header->marker.load(std::memory_order_acquire);
+            if (marker == 0)
+                break;
+
+            if (marker != recordMarker || header->checksum != checksum(header->sequence, record + s.m_entryOffset, s.m_entrySize))
+            {
+                s.m_isCorrupted = true;
+                break;
+            }
+
+            ++s.m_recordCount;
+        }
+
+        s.m_syncedSize = size;
+
+        return segment;
+    }
+
+    std::vector< std::int64_t > JournalSegment::list(const std::string& directory)
+    {
+        std::vector< std::int64_t > indexes;
+
+        auto stream = opendir(directory.c_str());
+        if (stream == nullptr)
+        {
+            if (errno == ENOENT)
+                return indexes;
+
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to list the journal directory " << directory << " (errno " << errno << ")");
+        }
+
+        while (auto entry = readdir(stream))
+        {
+            std::string name(entry->d_name);
+            if (name.size() != indexDigits + fileExtension.size() || name.compare(indexDigits, std::string::npos, fileExtension) != 0)
+                continue;
+
+            if (!std::all_of(name.begin(), name.begin() + indexDigits, [](char c) { return c >= '0' && c <= '9'; }))
+                continue;
+
+            indexes.push_back(std::stoll(name.substr(0, indexDigits)));
+        }
+
+        closedir(stream);
+
+        std::sort(indexes.begin(), indexes.end());
+
+        return indexes;
+    }
+
+    std::string JournalSegment::path(const std::string& directory, std::int64_t index)
+    {
+        std::ostringstream stream;
+        stream << directory << "/" << std::setw(indexDigits) << std::setfill('0') << index << fileExtension;
+        return stream.str();
+    }
+
+    void JournalSegment::createDirectory(const std::string& directory)
+    {
+        if (mkdir(directory.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0 && errno != EEXIST)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to create the journal directory " << directory << " (errno " << errno << ")");
+    }
+
+    std::int64_t JournalSegment::index() const
+    {
+        return m_index;
+    }
+
+    std::int32_t JournalSegment::capacity() const
+    {
+        return m_capacity;
+    }
+
+    std::int32_t JournalSegment::recordCount() const
+    {
+        return m_recordCount;
+    }
+
+    bool JournalSegment::isCorrupted() const
+    {
+        return m_isCorrupted;
+    }
+
+    std::uint32_t JournalSegment::checksum(std::int64_t sequence, const void* entry, std::size_t size)
+    {
+        auto crc = updateCrc32c(0xffffffff, &sequence, sizeof(sequence));
+        return ~updateCrc32c(crc, entry, size);
+    }
+
+    void JournalSegment::sync()
+    {
+        auto size = headerSize + static_cast< std::size_t >(m_recordCount) * m_recordSize;
+        if (size <= m_syncedSize)
+            return;
+
+        // msync takes a range starting at a page boundary
+        auto start = m_syncedSize / m_pageSize * m_pageSize;
+        if (msync(m_address + start, size - start, MS_SYNC) != 0)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to sync the journal segment " << m_path << " (errno " << errno << ")");
+
+        m_syncedSize = size;
+    }
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
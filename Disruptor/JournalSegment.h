@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace Disruptor
+{
+
+    /**
+     * Fixed-size, pre-allocated file of a journal, mapped in the address space of the process and unmapped on destruction.
+     *
+     * The file starts with a header describing its records, followed by records of a fixed size: the sequence of an event, a marker, a checksum of the
+     * sequence and the event, and a copy of the event. Appending a record is a copy in the mapping, the marker being written last: the records of a segment
+     * are its complete records up to the first one without a marker. The pages of a record may reach the storage device in any order, so a record with a
+     * marker is only valid if its checksum matches: the first one which does not verify ends the segment, and the segment is then corrupted.
+     * The blocks of the file are allocated on creation, so that syncing the appended records never changes the metadata of the file.
+     *
+     * The segments of a journal are named after their index in its directory, e.g. "00000000000000000003.journal". This class is only available on Linux.
+     */
+    class JournalSegment
+    {
+    public:
+        struct RecordHeader
+        {
+            std::int64_t sequence;
+            std::atomic< std::uint32_t > marker;
+            std::uint32_t checksum;
+        };
+
+        static const std::uint64_t magicNumber;
+        static const std::int32_t layoutVersion;
+        static const std::uint32_t recordMarker;
+
+        ~JournalSegment();
+
+        JournalSegment(const JournalSegment&) = delete;
+        JournalSegment& operator=(const JournalSegment&) = delete;
+
+        /**
+         * Create a segment file filled with zeros and map it for writing. Fails if the file exists.
+         *
+         * \param directory directory of the journal
+         * \param index index of the segment in the journal
+         * \param size size of the file in bytes, holding the header and at least one record
+         * \param entrySize size of the journalled events
+         * \param entryAlignment alignment of the journalled events
+         */
+        static std::unique_ptr< JournalSegment > create(const std::string& directory, std::int64_t index, std::size_t size, std::size_t entrySize, std::size_t entryAlignment);
+
+        /**
+         * Map an existing segment file for reading, checking that its records hold events of the given size and alignment.
+         */
+        static std::unique_ptr< JournalSegment > open(const std::string& directory, std::int64_t index, std::size_t entrySize, std::size_t entryAlignment);
+
+        /**
+         * Indexes of the segments of a journal, in ascending order. Empty if the directory does not exist.
+         */
+        static std::vector< std::int64_t > list(const std::string& directory);
+
+        static std::string path(const std::string& directory, std::int64_t index);
+
+        /**
+         * Create the directory of a journal if it does not exist, its parent must exist.
+         */
+        static void createDirectory(const std::string& directory);
+
+        std::int64_t index() const;
+
+        /**
+         * Number of records the segment can hold
+         */
+        std::int32_t capacity() const;
+
+        /**
+         * Number of records appended, or valid records found when opened
+         */
+        std::int32_t recordCount() const;
+
+        /**
+         * Whether the segment, when opened, holds a record with a marker which does not verify after its valid records
+         */
+        bool isCorrupted() const;
+
+        /**
+         * CRC-32C of the sequence and the bytes of an event
+         */
+        static std::uint32_t checksum(std::int64_t sequence, const void* entry, std::size_t size);
+
+        bool isFull() const
+        {
+            return m_recordCount == m_capacity;
+        }
+
+        /**
+         * Copy an event at the end of the segment, which must not be full.
+         */
+        void append(std::int64_t sequence, const void* entry)
+        {
+            auto record = m_records + static_cast< std::size_t >(m_recordCount) * m_recordSize;
+            auto header = reinterpret_cast< RecordHeader* >(record);
+
+            std::memcpy(record + m_entryOffset, entry, m_entrySize);
+            header->sequence = sequence;
+            header->checksum = checksum(sequence, entry, m_entrySize);
+            header->marker.store(recordMarker, std::memory_order_release);
+
+            ++m_recordCount;
+        }
+
+        std::int64_t sequenceAt(std::int32_t record) const
+        {
+            return reinterpret_cast< const RecordHeader* >(m_records + static_cast< std::size_t >(record) * m_recordSize)->sequence;
+        }
+
+        const void* entryAt(std::int32_t record) const
+        {
+            return m_records + static_cast< std::size_t >(record) * m_recordSize + m_entryOffset;
+        }
+
+        /**
+         * Write the records appended since the previous sync to the storage device (msync), returning once they are durable.
+         */
+        void sync();
+
+    private:
+        JournalSegment(const std::string& path, std::int64_t index, std::uint8_t* address, std::size_t size, std::size_t entrySize, std::size_t entryAlignment);
+
+        std::string m_path;
+        std::int64_t m_index;
+        std::uint8_t* m_address;
+        std::size_t m_size;
+        std::uint8_t* m_records;
+        std::size_t m_entrySize;
+        std::size_t m_entryOffset;
+        std::size_t m_recordSize;
+        std::int32_t m_capacity;
+        std::int32_t m_recordCount;
+        bool m_isCorrupted;
+        std::size_t m_syncedSize;
+        std::size_t m_pageSize;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
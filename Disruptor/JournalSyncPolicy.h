@@ -0,0 +1,27 @@
+#pragma once
+
+
+namespace Disruptor
+{
+    /**
+     * Defines when a JournalingEventHandler<T> forces the records written to its memory-mapped segments to the storage device.
+     */ 
+    enum class JournalSyncPolicy
+    {
+        /**
+         * Never sync, the kernel writes the dirty pages back on its own schedule. Survives a crash of the process, not of the machine.
+         */ 
+        None,
+
+        /**
+         * Sync at the end of the first batch after the sync interval elapsed, bounding the window of records lost by a crash of the machine.
+         */ 
+        Periodic,
+
+        /**
+         * Sync at the end of each batch, before the IEventProcessors gated on the journaller see its events.
+         */ 
+        EndOfBatch
+    };
+
+} // namespace Disruptor
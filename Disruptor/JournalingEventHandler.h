@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/IEventHandler.h"
+#include "Disruptor/ILifecycleAware.h"
+#include "Disruptor/JournalSegment.h"
+#include "Disruptor/JournalSyncPolicy.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * IEventHandler<T> recording each event, with its sequence, in a journal of memory-mapped, pre-allocated segment files (see JournalSegment).
+     *
+     * Journalling an event is a copy in the mapping of the current segment, without any system call. The records are forced to the storage device
+     * according to the JournalSyncPolicy, at the end of the batches delivered by the BatchEventProcessor<T>: with JournalSyncPolicy::EndOfBatch, the events
+     * are durable before the sequence of the processor moves, so that the IEventProcessors gated on it only see journalled events.
+     *
+     * A full segment is synced, unless the policy is JournalSyncPolicy::None, then replaced by a new one. A journaller never writes to the segments of
+     * a previous run: it starts a new segment after the last one of the directory. The journal is read back with a JournalReplayer<T>.
+     * This class is only available on Linux.
+     *
+     * \tparam T event implementation storing the data for sharing during exchange or parallel coordination of an event, must be trivially copyable.
+     */
+    template <class T>
+    class JournalingEventHandler : public IEventHandler< T >, public ILifecycleAware
+    {
+        static_assert(std::is_trivially_copyable< T >::value, "Journalled events must be trivially copyable");
+
+    public:
+        /**
+         * \param directory directory of the journal, created if it does not exist
+         * \param segmentSize size in bytes of the segment files
+         * \param syncPolicy when to force the records to the storage device
+         * \param syncInterval minimum time between two syncs with JournalSyncPolicy::Periodic
+         */
+        explicit JournalingEventHandler(const std::string& directory,
+                                        std::size_t segmentSize = 64 * 1024 * 1024,
+                                        JournalSyncPolicy syncPolicy = JournalSyncPolicy::EndOfBatch,
+                                        std::chrono::milliseconds syncInterval = std::chrono::milliseconds(10))
+            : m_directory(directory)
+            , m_segmentSize(segmentSize)
+            , m_syncPolicy(syncPolicy)
+            , m_syncInterval(syncInterval)
+            , m_nextSegmentIndex(0)
+        {
+            JournalSegment::createDirectory(directory);
+
+            auto indexes = JournalSegment::list(directory);
+            if (!indexes.empty())
+                m_nextSegmentIndex = indexes.back() + 1;
+        }
+
+        void onEvent(T& data, std::int64_t sequence, bool endOfBatch) override
+        {
+            if (m_segment == nullptr || m_segment->isFull())
+                nextSegment();
+
+            m_segment->append(sequence, &data);
+
+            if (!endOfBatch || m_syncPolicy == JournalSyncPolicy::None)
+                return;
+
+            if (m_syncPolicy == JournalSyncPolicy::EndOfBatch || ClockConfig::Clock::now() - m_lastSync >= m_syncInterval)
+                sync();
+        }
+
+        /**
+         * Allocate the first segment before the first event is available.
+         */
+        void onStart() override
+        {
+            if (m_segment == nullptr)
+                nextSegment();
+        }
+
+        /**
+         * Sync, unless the policy is JournalSyncPolicy::None, and close the current segment.
+         */
+        void onShutdown() override
+        {
+            if (m_segment == nullptr)
+                return;
+
+            if (m_syncPolicy != JournalSyncPolicy::None)
+                sync();
+
+            m_segment.reset();
+        }
+
+        /**
+         * Force the records of the current segment to the storage device, whatever the policy.
+         */
+        void sync()
+        {
+            if (m_segment != nullptr)
+                m_segment->sync();
+
+            m_lastSync = ClockConfig::Clock::now();
+        }
+
+        const std::string& directory() const
+        {
+            return m_directory;
+        }
+
+    private:
+        void nextSegment()
+        {
+            if (m_segment != nullptr && m_syncPolicy != JournalSyncPolicy::None)
+                m_segment->sync();
+
+            m_segment.reset();
+            m_segment = JournalSegment::create(m_directory, m_nextSegmentIndex, m_segmentSize, sizeof(T), alignof(T));
+            ++m_nextSegmentIndex;
+
+            m_lastSync = ClockConfig::Clock::now();
+        }
+
+        std::string m_directory;
+        std::size_t m_segmentSize;
+        JournalSyncPolicy m_syncPolicy;
+        std::chrono::milliseconds m_syncInterval;
+        std::int64_t m_nextSegmentIndex;
+        std::unique_ptr< JournalSegment > m_segment;
+        ClockConfig::TimePoint m_lastSync;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
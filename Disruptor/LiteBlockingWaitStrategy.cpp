@@ -14,6 +14,18 @@ namespace Disruptor
                                                    Sequence& cursor,
                                                    ISequence& dependentSequence,
                                                    ISequenceBarrier& barrier)
+    {
+        auto result = tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+
+        return result.sequence;
+    }
+
+    SequenceWaitResult LiteBlockingWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                            Sequence& cursor,
+                                                            ISequence& dependentSequence,
+                                                            ISequenceBarrier& barrier)
     {
         if (cursor.value() < sequence)
         {
@@ -26,20 +38,15 @@ namespace Disruptor
                 if (cursor.value() >= sequence)
                     break;
 
-                barrier.checkAlert();
+                if (barrier.isAlerted())
+                    return SequenceWaitResult::alerted();
 
                 m_conditionVariable.wait(uniqueLock);
             }
             while (cursor.value() < sequence);
         }
 
-        std::int64_t availableSequence;
-        while ((availableSequence = dependentSequence.value()) < sequence)
-        {
-            barrier.checkAlert();
-        }
-
-        return availableSequence;
+        return m_waiterRegistry.tryWaitFor(sequence, dependentSequence, barrier);
     }
 
     void LiteBlockingWaitStrategy::signalAllWhenBlocking()
@@ -52,6 +59,17 @@ namespace Disruptor
         }
     }
 
+    void LiteBlockingWaitStrategy::signalAllWhenAlerted()
+    {
+        signalAllWhenBlocking();
+        m_waiterRegistry.wakeAll();
+    }
+
+    WaitQueue* LiteBlockingWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return &m_waiterRegistry.registerSequence(sequence);
+    }
+
     void LiteBlockingWaitStrategy::writeDescriptionTo(std::ostream& stream) const
     {
         stream << "LiteBlockingWaitStrategy";
@@ -5,6 +5,7 @@
 #include <boost/thread.hpp>
 
 #include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaiterRegistry.h"
 
 
 namespace Disruptor
@@ -26,17 +27,36 @@ namespace Disruptor
                              ISequence& dependentSequence,
                              ISequenceBarrier& barrier) override;
 
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
         /**
          * \see IWaitStrategy::signalAllWhenBlocking
          */
         void signalAllWhenBlocking() override;
 
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
         void writeDescriptionTo(std::ostream& stream) const override;
 
     private:
         boost::recursive_mutex m_gate;
         boost::condition_variable_any m_conditionVariable;
         std::atomic< bool > m_signalNeeded{ false };
+        WaiterRegistry m_waiterRegistry;
     };
 
 } // namespace Disruptor
@@ -3,8 +3,6 @@
 
 #include <ostream>
 
-#include <boost/chrono.hpp>
-
 #include "ISequenceBarrier.h"
 #include "Sequence.h"
 #include "TimeoutException.h"
@@ -15,6 +13,7 @@ namespace Disruptor
 
     LiteTimeoutBlockingWaitStrategy::LiteTimeoutBlockingWaitStrategy(ClockConfig::Duration timeout)
         : m_timeout(timeout)
+        , m_timeoutSpan(std::chrono::duration_cast< std::chrono::microseconds >(timeout).count())
     {
     }
 
@@ -23,8 +22,20 @@ namespace Disruptor
                                                           ISequence& dependentSequence,
                                                           ISequenceBarrier& barrier)
     {
-        auto timeSpan = boost::chrono::microseconds(std::chrono::duration_cast< std::chrono::microseconds >(m_timeout).count());
+        auto result = tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+        if (result.status == SequenceWaitStatus::TimedOut)
+            DISRUPTOR_THROW_TIMEOUT_EXCEPTION();
+
+        return result.sequence;
+    }
 
+    SequenceWaitResult LiteTimeoutBlockingWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                                   Sequence& cursor,
+                                                                   ISequence& dependentSequence,
+                                                                   ISequenceBarrier& barrier)
+    {
         if (cursor.value() < sequence)
         {
             boost::unique_lock< decltype(m_gate) > uniqueLock(m_gate);
@@ -33,20 +44,15 @@ namespace Disruptor
             {
                 m_signalNeeded.exchange(true);
 
-                barrier.checkAlert();
+                if (barrier.isAlerted())
+                    return SequenceWaitResult::alerted();
 
-                if (m_conditionVariable.wait_for(uniqueLock, timeSpan) == boost::cv_status::timeout)
-                    DISRUPTOR_THROW_TIMEOUT_EXCEPTION();
+                if (m_conditionVariable.wait_for(uniqueLock, m_timeoutSpan) == boost::cv_status::timeout)
+                    return SequenceWaitResult::timedOut();
             }
         }
 
-        std::int64_t availableSequence;
-        while ((availableSequence = dependentSequence.value()) < sequence)
-        {
-            barrier.checkAlert();
-        }
-
-        return availableSequence;
+        return m_waiterRegistry.tryWaitFor(sequence, dependentSequence, barrier, m_timeout);
     }
 
     void LiteTimeoutBlockingWaitStrategy::signalAllWhenBlocking()
@@ -59,6 +65,17 @@ namespace Disruptor
         }
     }
 
+    void LiteTimeoutBlockingWaitStrategy::signalAllWhenAlerted()
+    {
+        signalAllWhenBlocking();
+        m_waiterRegistry.wakeAll();
+    }
+
+    WaitQueue* LiteTimeoutBlockingWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return &m_waiterRegistry.registerSequence(sequence);
+    }
+
     void LiteTimeoutBlockingWaitStrategy::writeDescriptionTo(std::ostream& stream) const
     {
         stream << "LiteTimeoutBlockingWaitStrategy";
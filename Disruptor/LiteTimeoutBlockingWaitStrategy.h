@@ -2,10 +2,12 @@
 
 #include <atomic>
 
+#include <boost/chrono.hpp>
 #include <boost/thread.hpp>
 
 #include "Disruptor/ClockConfig.h"
 #include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaiterRegistry.h"
 
 
 namespace Disruptor
@@ -28,18 +30,38 @@ namespace Disruptor
                              ISequence& dependentSequence,
                              ISequenceBarrier& barrier) override;
 
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
         /**
          * \see IWaitStrategy::signalAllWhenBlocking
          */
         void signalAllWhenBlocking() override;
 
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
         void writeDescriptionTo(std::ostream& stream) const override;
 
     private:
         ClockConfig::Duration m_timeout;
+        boost::chrono::microseconds m_timeoutSpan;
         boost::recursive_mutex m_gate;
         boost::condition_variable_any m_conditionVariable;
         std::atomic< bool > m_signalNeeded{ false };
+        WaiterRegistry m_waiterRegistry;
     };
 
 } // namespace Disruptor
@@ -0,0 +1,276 @@
+#include "stdafx.h"
+#include "MemoryPlacement.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "ArgumentOutOfRangeException.h"
+#include "BuildConfig.h"
+#include "InvalidOperationException.h"
+#include "ThreadHelper.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+
+namespace Disruptor
+{
+namespace
+{
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+    // From linux/mempolicy.h, libnuma is not required
+    const int memoryPolicyBind = 2;
+
+    // From linux/mman.h, the log2 of the huge page size is encoded in the flags of mmap
+    const int hugePageSizeShift = 26;
+
+    int hugePageLog2(MemoryPlacement::PageSize pageSize)
+    {
+        return pageSize == MemoryPlacement::PageSize::Huge1GB ? 30 : 21;
+    }
+
+    std::size_t hugePageBytes(MemoryPlacement::PageSize pageSize)
+    {
+        return static_cast< std::size_t >(1) << hugePageLog2(pageSize);
+    }
+
+    // Transparent huge pages are 2 MB whatever the size requested from the hugetlb pool
+    const std::size_t transparentHugePageBytes = static_cast< std::size_t >(1) << 21;
+
+    void* mapPages(std::size_t size, int flags)
+    {
+        return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    }
+
+    void* mapHugePages(std::size_t size, MemoryPlacement::PageSize pageSize)
+    {
+        auto memory = mapPages(size, MAP_HUGETLB | hugePageLog2(pageSize) << hugePageSizeShift);
+        if (memory != MAP_FAILED)
+            return memory;
+
+        // No page left in the hugetlb pool: transparent huge pages, which require a mapping aligned on their size
+        const auto alignment = transparentHugePageBytes;
+
+        auto reserved = mapPages(size + alignment, 0);
+        if (reserved == MAP_FAILED)
+            throw std::bad_alloc();
+
+        auto first = reinterpret_cast< std::uintptr_t >(reserved);
+        auto aligned = (first + alignment - 1) & ~(alignment - 1);
+
+        if (aligned > first)
+            ::munmap(reserved, aligned - first);
+        ::munmap(reinterpret_cast< void* >(aligned + size), first + alignment - aligned);
+
+        ::madvise(reinterpret_cast< void* >(aligned), size, MADV_HUGEPAGE);
+
+        return reinterpret_cast< void* >(aligned);
+    }
+
+    void prefault(void* memory, std::size_t size)
+    {
+        // Small pages are also touched, in case transparent huge pages were not granted
+        const auto pageBytes = static_cast< std::size_t >(::sysconf(_SC_PAGESIZE));
+
+        auto bytes = static_cast< volatile char* >(memory);
+        for (std::size_t offset = 0; offset < size; offset += pageBytes)
+            bytes[offset] = 0;
+    }
+
+    void bindMemory(void* memory, std::size_t size, std::int32_t node)
+    {
+        const auto bitsPerWord = 8 * sizeof(unsigned long);
+
+        std::vector< unsigned long > nodeMask(node / bitsPerWord + 1, 0);
+        nodeMask[node / bitsPerWord] |= 1UL << (node % bitsPerWord);
+
+        if (::syscall(SYS_mbind, memory, size, memoryPolicyBind, nodeMask.data(), nodeMask.size() * bitsPerWord, 0) != 0)
+        {
+            ::munmap(memory, size);
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to bind memory to node " << node << " (errno " << errno << ")");
+        }
+    }
+
+#endif
+
+} // namespace
+
+
+    MemoryPlacement::MemoryPlacement(std::int32_t node, std::int32_t firstTouchCpu)
+        : m_node(node)
+        , m_firstTouchCpu(firstTouchCpu)
+    {
+    }
+
+    MemoryPlacement MemoryPlacement::bindToNode(std::int32_t node)
+    {
+        if (node < 0)
+            DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(node);
+
+        return MemoryPlacement(node, -1);
+    }
+
+    MemoryPlacement MemoryPlacement::firstTouchFromCpu(std::int32_t cpu)
+    {
+        if (cpu < 0 || cpu >= static_cast< std::int32_t >(ThreadHelper::AffinityMask().size()))
+            DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(cpu);
+
+        return MemoryPlacement(-1, cpu);
+    }
+
+    std::int32_t MemoryPlacement::node() const
+    {
+        return m_node;
+    }
+
+    std::int32_t MemoryPlacement::firstTouchCpu() const
+    {
+        return m_firstTouchCpu;
+    }
+
+    MemoryPlacement MemoryPlacement::withHugePages(PageSize pageSize) const
+    {
+        auto placement = *this;
+        placement.m_pageSize = pageSize;
+        return placement;
+    }
+
+    MemoryPlacement::PageSize MemoryPlacement::pageSize() const
+    {
+        return m_pageSize;
+    }
+
+    bool MemoryPlacement::isDefault() const
+    {
+        return m_node < 0 && m_firstTouchCpu < 0 && m_pageSize == PageSize::Default;
+    }
+
+    void* MemoryPlacement::allocate(std::size_t size) const
+    {
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        if (!isDefault() && size > 0)
+        {
+            auto mappedSize = mappingSize(size);
+
+            if (usesHugePages(size))
+            {
+                auto memory = mapHugePages(mappedSize, m_pageSize);
+
+                if (m_node >= 0)
+                    bindMemory(memory, mappedSize, m_node);
+
+                prefault(memory, mappedSize);
+                return memory;
+            }
+
+            // Fresh pages, never touched by the allocator or by a previous owner of the heap block
+            auto memory = mapPages(mappedSize, 0);
+            if (memory == MAP_FAILED)
+                throw std::bad_alloc();
+
+            if (m_node >= 0)
+                bindMemory(memory, mappedSize, m_node);
+
+            return memory;
+        }
+#endif
+
+        return ::operator new(size);
+    }
+
+    void MemoryPlacement::deallocate(void* memory, std::size_t size) const
+    {
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        if (!isDefault() && size > 0)
+        {
+            ::munmap(memory, mappingSize(size));
+            return;
+        }
+#endif
+
+        ::operator delete(memory);
+    }
+
+    std::size_t MemoryPlacement::mappingSize(std::size_t size) const
+    {
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        if (usesHugePages(size))
+        {
+            auto pageBytes = hugePageBytes(m_pageSize);
+            return (size + pageBytes - 1) & ~(pageBytes - 1);
+        }
+#endif
+
+        return size;
+    }
+
+    bool MemoryPlacement::usesHugePages(std::size_t size) const
+    {
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        // A huge page for a smaller buffer would only waste memory, and the hugetlb pool
+        return m_pageSize != PageSize::Default && size >= hugePageBytes(m_pageSize);
+#else
+        (void)size;
+        return false;
+#endif
+    }
+
+    void MemoryPlacement::touch(const std::function< void() >& initialize) const
+    {
+        if (m_firstTouchCpu < 0)
+        {
+            initialize();
+            return;
+        }
+
+        std::exception_ptr error;
+        std::thread toucher([&]
+        {
+            ThreadHelper::AffinityMask mask;
+            ThreadHelper::setThreadAffinity(mask.set(m_firstTouchCpu));
+
+            try
+            {
+                initialize();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        });
+        toucher.join();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    bool MemoryPlacement::isNodeBindingSupported()
+    {
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+        int mode = 0;
+        return ::syscall(SYS_get_mempolicy, &mode, nullptr, 0, nullptr, 0) == 0;
+#else
+        return false;
+#endif
+    }
+
+    bool MemoryPlacement::operator==(const MemoryPlacement& other) const
+    {
+        return m_node == other.m_node && m_firstTouchCpu == other.m_firstTouchCpu && m_pageSize == other.m_pageSize;
+    }
+
+    bool MemoryPlacement::operator!=(const MemoryPlacement& other) const
+    {
+        return !(*this == other);
+    }
+
+} // namespace Disruptor
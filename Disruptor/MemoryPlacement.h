@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+namespace Disruptor
+{
+
+    /**
+     * Placement of the memory of a ring buffer, i.e. of its entries and of the availability buffer of its sequencer, on the NUMA nodes.
+     *
+     * - by default, the memory comes from the heap and its pages are placed by the operating system on the node of the thread constructing the ring buffer.
+     * - bindToNode() maps fresh pages and binds them to a node (mbind), whichever thread touches them first.
+     * - firstTouchFromCpu() maps fresh pages and initializes them from a thread pinned to a CPU, typically the CPU of the consumer,
+     *   so that the local allocation policy places them on the node of this CPU.
+     *
+     * Any of them can be combined with withHugePages(), to back large ring buffers with huge pages and spare the consumers the TLB misses.
+     *
+     * Node binding and huge pages are only available on Linux, elsewhere the memory comes from the heap.
+     */
+    class MemoryPlacement
+    {
+    public:
+        enum class PageSize
+        {
+            /**
+             * Pages of the operating system, usually 4 KB
+             */
+            Default,
+
+            /**
+             * 2 MB huge pages
+             */
+            Huge2MB,
+
+            /**
+             * 1 GB huge pages
+             */
+            Huge1GB
+        };
+
+        /**
+         * Heap allocation, pages placed by the operating system
+         */
+        MemoryPlacement() = default;
+
+        /**
+         * \param node the NUMA node the memory is bound to
+         */
+        static MemoryPlacement bindToNode(std::int32_t node);
+
+        /**
+         * \param cpu the CPU of the thread initializing the memory
+         */
+        static MemoryPlacement firstTouchFromCpu(std::int32_t cpu);
+
+        /**
+         * The node the memory is bound to, -1 if none
+         */
+        std::int32_t node() const;
+
+        /**
+         * The CPU of the thread initializing the memory, -1 if the memory is initialized by the calling thread
+         */
+        std::int32_t firstTouchCpu() const;
+
+        /**
+         * The same placement, backed by huge pages. Pages reserved in the hugetlb pool (MAP_HUGETLB) are used when available,
+         * otherwise the mapping is aligned on 2 MB and advised for transparent huge pages (MADV_HUGEPAGE).
+         * Allocations smaller than a huge page are made of default pages.
+         * All the pages are faulted in when the memory is allocated, from the first-touch thread if any, so that the first lap over
+         * the ring buffer does not take page faults.
+         *
+         * \param pageSize the size of the huge pages
+         */
+        MemoryPlacement withHugePages(PageSize pageSize = PageSize::Huge2MB) const;
+
+        PageSize pageSize() const;
+
+        bool isDefault() const;
+
+        /**
+         * Allocate memory following the placement, fresh pages are mapped unless the placement is the default one.
+         * The allocation must be made from the function run by touch() for the first-touch placement to apply to huge pages.
+         *
+         * \param size the size in bytes
+         */
+        void* allocate(std::size_t size) const;
+
+        void deallocate(void* memory, std::size_t size) const;
+
+        /**
+         * Run the function initializing the memory: on a thread pinned to firstTouchCpu() if any, on the calling thread otherwise.
+         * Exceptions thrown by the function are rethrown on the calling thread.
+         */
+        void touch(const std::function< void() >& initialize) const;
+
+        /**
+         * Returns true if the memory can be bound to a node on this system.
+         */
+        static bool isNodeBindingSupported();
+
+        bool operator==(const MemoryPlacement& other) const;
+        bool operator!=(const MemoryPlacement& other) const;
+
+    private:
+        MemoryPlacement(std::int32_t node, std::int32_t firstTouchCpu);
+
+        std::size_t mappingSize(std::size_t size) const;
+        bool usesHugePages(std::size_t size) const;
+
+        std::int32_t m_node = -1;
+        std::int32_t m_firstTouchCpu = -1;
+        PageSize m_pageSize = PageSize::Default;
+    };
+
+} // namespace Disruptor
@@ -1,10 +1,9 @@
 #pragma once
 
-#include <atomic>
 #include <memory>
+#include <typeinfo>
 
-#include "Disruptor/InsufficientCapacityException.h"
-#include "Disruptor/Sequencer.h"
+#include "Disruptor/MultiProducerSequencerBase.h"
 #include "Disruptor/SpinWait.h"
 #include "Disruptor/Util.h"
 
@@ -17,38 +16,13 @@ namespace Disruptor
      * Note on Sequencer.cursor:  With this sequencer the cursor value is updated after the call to Sequencer::next(), to determine the highest available sequence that can be read,
      * then getHighestPublishedSequence should be used.
      */ 
-    template <class T>
-    class MultiProducerSequencer : public Sequencer< T >
+    template <class T, class TWaitStrategy = IWaitStrategy>
+    class MultiProducerSequencer : public MultiProducerSequencerBase< T, TWaitStrategy >
     {
     public:
-        MultiProducerSequencer(std::int32_t bufferSize, const std::shared_ptr< IWaitStrategy >& waitStrategy)
-            : Sequencer< T >(bufferSize, waitStrategy)
+        MultiProducerSequencer(std::int32_t bufferSize, const std::shared_ptr< TWaitStrategy >& waitStrategy, const MemoryPlacement& placement = MemoryPlacement())
+            : MultiProducerSequencerBase< T, TWaitStrategy >(bufferSize, waitStrategy, placement)
         {
-            m_availableBuffer = std::unique_ptr< std::atomic< std::int32_t >[] >(new std::atomic< std::int32_t >[bufferSize]);
-            m_indexMask = bufferSize - 1;
-            m_indexShift = Util::log2(bufferSize);
-            initializeAvailableBuffer();
-        }
-
-        /**
-         * Has the buffer got capacity to allocate another sequence.  This is a concurrent method so the response should only be taken as an indication of available capacity.
-         * 
-         * \param requiredCapacity requiredCapacity in the buffer
-         * \returns true if the buffer has the capacity to allocate the next sequence otherwise false.
-         */ 
-        bool hasAvailableCapacity(std::int32_t requiredCapacity) override
-        {
-            return hasAvailableCapacity(this->m_gatingSequences, requiredCapacity, this->m_cursor->value());
-        }
-
-        /**
-         * Claim a specific sequence when only one publisher is involved.
-         * 
-         * \param sequence sequence to be claimed.
-         */ 
-        void claim(std::int64_t sequence) override
-        {
-            this->m_cursor->setValue(sequence);
         }
 
         /**
@@ -92,11 +66,11 @@ namespace Disruptor
                 next = current + n;
 
                 std::int64_t wrapPoint = next - this->m_bufferSize;
-                std::int64_t cachedGatingSequence = m_gatingSequenceCache->value();
+                std::int64_t cachedGatingSequence = this->m_gatingSequenceCache->value();
 
                 if (wrapPoint > cachedGatingSequence || cachedGatingSequence > current)
                 {
-                    std::int64_t gatingSequence = Util::getMinimumSequence(this->m_gatingSequences, current);
+                    std::int64_t gatingSequence = this->m_gatingSequences.minimumSequence(current, wrapPoint);
 
                     if (wrapPoint > gatingSequence)
                     {
@@ -105,7 +79,7 @@ namespace Disruptor
                         continue;
                     }
 
-                    m_gatingSequenceCache->setValue(gatingSequence);
+                    this->m_gatingSequenceCache->setValue(gatingSequence);
                 }
                 else if (this->m_cursor->compareAndSet(current, next))
                 {
@@ -118,180 +92,19 @@ namespace Disruptor
         }
 
         /**
-         * Attempt to claim the next event in sequence for publishing.  Will return the number of the slot if there is at least requiredCapacity slots available.
-         * 
-         * \returns the claimed sequence value
-         */ 
-        std::int64_t tryNext() override
-        {
-            return tryNext(1);
-        }
-
-        /**
-         * Attempt to claim the next event in sequence for publishing.  Will return the number of the slot if there is at least n slots available.
-         * 
-         * \param n 
-         * \param n the number of sequences to claim
-         * \returns the claimed sequence value
-         */ 
-        std::int64_t tryNext(std::int32_t n) override
-        {
-            if (n < 1)
-            {
-                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("n must be > 0");
-            }
-
-            std::int64_t current;
-            std::int64_t next;
-
-            do
-            {
-                current = this->m_cursor->value();
-                next = current + n;
-
-                if (!hasAvailableCapacity(this->m_gatingSequences, n, current))
-                {
-                    DISRUPTOR_THROW_INSUFFICIENT_CAPACITY_EXCEPTION();
-                }
-            }
-            while (!this->m_cursor->compareAndSet(current, next));
-
-            return next;
-        }
-
-        /**
-         * Get the remaining capacity for this sequencer. return The number of slots remaining.
-         */ 
-        std::int64_t getRemainingCapacity() override
-        {
-            auto consumed = Util::getMinimumSequence(this->m_gatingSequences, this->m_cursorRef.value());
-            auto produced = this->m_cursorRef.value();
-
-            return this->bufferSize() - (produced - consumed);
-        }
-
-        /**
-         * Publish an event and make it visible to IEventProcessors
-         * 
-         * \param sequence sequence to be published
-         */ 
-        void publish(std::int64_t sequence) override
-        {
-            setAvailable(sequence);
-            this->m_waitStrategyRef.signalAllWhenBlocking();
-        }
-
-        /**
-         * Publish an event and make it visible to IEventProcessors
-         */ 
-        void publish(std::int64_t lo, std::int64_t hi) override
-        {
-            for (std::int64_t l = lo; l <= hi; l++)
-            {
-                setAvailable(l);
-            }
-            this->m_waitStrategyRef.signalAllWhenBlocking();
-        }
-
-        /**
-         * Confirms if a sequence is published and the event is available for use; non-blocking.
-         * 
-         * \param sequence sequence of the buffer to check
-         * \returns true if the sequence is available for use, false if not
-         */ 
-        bool isAvailable(std::int64_t sequence) override
-        {
-            auto index = calculateIndex(sequence);
-            auto flag = calculateAvailabilityFlag(sequence);
-
-            return m_availableBuffer[index].load(std::memory_order_acquire) == flag;
-        }
-
-        /**
-         * Get the highest sequence number that can be safely read from the ring buffer.  Depending on the implementation of the Sequencer this call may need to scan a number of values
-         * in the Sequencer.  The scan will range from nextSequence to availableSequence.  If there are no available values > nextSequence the return value will be nextSequence - 1.
-         * To work correctly a consumer should pass a value that it 1 higher than the last sequence that was successfully processed.
+         * Create a ISequenceBarrier that gates on the the cursor and a list of Sequences.
+         * The barrier is bound to the concrete sequencer and wait strategy types so its waitFor() does not go through virtual calls,
+         * unless this sequencer is an instance of a derived class.
          *
-         * \param lowerBound The sequence to start scanning from.
-         * \param availableSequence The sequence to scan to.
-         * \returns The highest value that can be safely read, will be at least\returns <code>nextSequence - 1</code>\returns .
-         */ 
-        std::int64_t getHighestPublishedSequence(std::int64_t lowerBound, std::int64_t availableSequence) override
+         * \param sequencesToTrack
+         */
+        std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack) override
         {
-            for (std::int64_t sequence = lowerBound; sequence <= availableSequence; sequence++)
-            {
-                if (!isAvailable(sequence))
-                {
-                    return sequence - 1;
-                }
-            }
+            if (typeid(*this) != typeid(MultiProducerSequencer))
+                return Sequencer< T, TWaitStrategy >::newBarrier(sequencesToTrack);
 
-            return availableSequence;
+            return std::make_shared< ProcessingSequenceBarrier< MultiProducerSequencer, TWaitStrategy > >(std::static_pointer_cast< MultiProducerSequencer >(this->shared_from_this()), this->m_waitStrategy, this->m_cursor, sequencesToTrack);
         }
-
-    private:
-        bool hasAvailableCapacity(const std::vector< std::shared_ptr< ISequence > >& gatingSequences, std::int32_t requiredCapacity, std::int64_t cursorValue)
-        {
-            auto wrapPoint = (cursorValue + requiredCapacity) - this->m_bufferSize;
-            auto cachedGatingSequence = m_gatingSequenceCache->value();
-
-            if (wrapPoint > cachedGatingSequence || cachedGatingSequence > cursorValue)
-            {
-                auto minSequence = Util::getMinimumSequence(gatingSequences, cursorValue);
-                m_gatingSequenceCache->setValue(minSequence);
-
-                if (wrapPoint > minSequence)
-                {
-                    return false;
-                }
-            }
-
-            return true;
-        }
-
-        void initializeAvailableBuffer()
-        {
-            // Called from the constructor before any consumer can observe the
-            // sequencer, so relaxed stores are sufficient here.
-            for (std::int32_t i = this->m_bufferSize - 1; i != 0; i--)
-            {
-                m_availableBuffer[i].store(-1, std::memory_order_relaxed);
-            }
-
-            m_availableBuffer[0].store(-1, std::memory_order_relaxed);
-        }
-
-        void setAvailable(std::int64_t sequence)
-        {
-            setAvailableBufferValue(calculateIndex(sequence), calculateAvailabilityFlag(sequence));
-        }
-
-        void setAvailableBufferValue(std::int32_t index, std::int32_t flag)
-        {
-            // Release-store so the event payload writes that happened before
-            // publish() are visible to any consumer that subsequently sees
-            // the flag via the matching acquire-load in isAvailable().
-            m_availableBuffer[index].store(flag, std::memory_order_release);
-        }
-
-        std::int32_t calculateAvailabilityFlag(std::int64_t sequence)
-        {
-            return static_cast< std::int32_t >(static_cast< std::uint64_t >(sequence) >> m_indexShift);
-        }
-
-        std::int32_t calculateIndex(std::int64_t sequence)
-        {
-            return static_cast< std::int32_t >(sequence) & m_indexMask;
-        }
-
-    private:
-        std::shared_ptr< Sequence > m_gatingSequenceCache = std::make_shared< Sequence >();
-
-        // availableBuffer tracks the state of each ringbuffer slot
-        // see below for more details on the approach
-        std::unique_ptr< std::atomic< std::int32_t >[] > m_availableBuffer;
-        std::int32_t m_indexMask;
-        std::int32_t m_indexShift;
     };
 
 } // namespace Disruptor
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+
+#include "Disruptor/BuildConfig.h"
+
+#include "Disruptor/InsufficientCapacityException.h"
+#include "Disruptor/MemoryPlacement.h"
+#include "Disruptor/PlacementAllocator.h"
+#include "Disruptor/Sequencer.h"
+#include "Disruptor/Util.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Base class of the sequencers suitable for use for sequencing across multiple publisher threads. It tracks the availability of each slot of the ring buffer,
+     * derived classes define how sequences are claimed by next().
+     * Note on Sequencer.cursor:  With these sequencers the cursor value is updated after the call to Sequencer::next(), to determine the highest available sequence that can be read,
+     * then getHighestPublishedSequence should be used.
+     */ 
+    template <class T, class TWaitStrategy = IWaitStrategy>
+    class MultiProducerSequencerBase : public Sequencer< T, TWaitStrategy >
+    {
+    public:
+        /**
+         * \param bufferSize the size of the buffer that this will sequence over.
+         * \param waitStrategy for those waiting on sequences.
+         * \param placement placement of the availability buffer on the NUMA nodes, and the size of its pages
+         */
+        MultiProducerSequencerBase(std::int32_t bufferSize, const std::shared_ptr< TWaitStrategy >& waitStrategy, const MemoryPlacement& placement = MemoryPlacement())
+            : Sequencer< T, TWaitStrategy >(bufferSize, waitStrategy)
+            , m_availableBuffer(nullptr, PlacementDeleter< std::atomic< std::int32_t > >(placement, bufferSize))
+        {
+            m_indexMask = bufferSize - 1;
+            m_indexShift = Util::log2(bufferSize);
+
+            placement.touch([this, &placement]
+            {
+                auto availableBuffer = static_cast< std::atomic< std::int32_t >* >(placement.allocate(this->m_bufferSize * sizeof(std::atomic< std::int32_t >)));
+                for (std::int32_t i = 0; i < this->m_bufferSize; ++i)
+                    new (&availableBuffer[i]) std::atomic< std::int32_t >();
+
+                m_availableBuffer.reset(availableBuffer);
+                initializeAvailableBuffer();
+            });
+        }
+
+        /**
+         * Has the buffer got capacity to allocate another sequence.  This is a concurrent method so the response should only be taken as an indication of available capacity.
+         * 
+         * \param requiredCapacity requiredCapacity in the buffer
+         * \returns true if the buffer has the capacity to allocate the next sequence otherwise false.
+         */ 
+        bool hasAvailableCapacity(std::int32_t requiredCapacity) override
+        {
+            return hasAvailableCapacity(this->m_gatingSequences, requiredCapacity, this->m_cursor->value());
+        }
+
+        /**
+         * Claim a specific sequence when only one publisher is involved.
+         * 
+         * \param sequence sequence to be claimed.
+         */ 
+        void claim(std::int64_t sequence) override
+        {
+            this->m_cursor->setValue(sequence);
+        }
+
+        /**
+         * Attempt to claim the next event in sequence for publishing.  Will return the number of the slot if there is at least requiredCapacity slots available.
+         * 
+         * \returns the claimed sequence value
+         */ 
+        std::int64_t tryNext() override
+        {
+            return tryNext(1);
+        }
+
+        /**
+         * Attempt to claim the next event in sequence for publishing.  Will return the number of the slot if there is at least n slots available.
+         * 
+         * \param n 
+         * \param n the number of sequences to claim
+         * \returns the claimed sequence value
+         */ 
+        std::int64_t tryNext(std::int32_t n) override
+        {
+            if (n < 1)
+            {
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("n must be > 0");
+            }
+
+            std::int64_t current;
+            std::int64_t next;
+
+            do
+            {
+                current = this->m_cursor->value();
+                next = current + n;
+
+                if (!hasAvailableCapacity(this->m_gatingSequences, n, current))
+                {
+                    DISRUPTOR_THROW_INSUFFICIENT_CAPACITY_EXCEPTION();
+                }
+            }
+            while (!this->m_cursor->compareAndSet(current, next));
+
+            return next;
+        }
+
+        /**
+         * Get the remaining capacity for this sequencer. return The number of slots remaining.
+         */ 
+        std::int64_t getRemainingCapacity() override
+        {
+            auto consumed = this->m_gatingSequences.minimumSequence(this->m_cursorRef.Sequence::value());
+            auto produced = this->m_cursorRef.Sequence::value();
+
+            return this->bufferSize() - (produced - consumed);
+        }
+
+        /**
+         * Publish an event and make it visible to IEventProcessors
+         * 
+         * \param sequence sequence to be published
+         */ 
+        void publish(std::int64_t sequence) override
+        {
+            setAvailable(sequence);
+            WaitStrategyDispatch< TWaitStrategy >::signalAllWhenBlocking(this->m_waitStrategyRef);
+        }
+
+        /**
+         * Publish an event and make it visible to IEventProcessors
+         */ 
+        void publish(std::int64_t lo, std::int64_t hi) override
+        {
+            // A single release fence orders the event writes before all the flag stores of the range,
+            // so the flags themselves can be written with relaxed stores. A consumer that acquire-loads
+            // any of these flags in isAvailable() also sees the corresponding event.
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (std::int64_t l = lo; l <= hi; l++)
+            {
+                m_availableBuffer[calculateIndex(l)].store(calculateAvailabilityFlag(l), std::memory_order_relaxed);
+            }
+            WaitStrategyDispatch< TWaitStrategy >::signalAllWhenBlocking(this->m_waitStrategyRef);
+        }
+
+        /**
+         * Confirms if a sequence is published and the event is available for use; non-blocking.
+         * 
+         * \param sequence sequence of the buffer to check
+         * \returns true if the sequence is available for use, false if not
+         */ 
+        bool isAvailable(std::int64_t sequence) override
+        {
+            auto index = calculateIndex(sequence);
+            auto flag = calculateAvailabilityFlag(sequence);
+
+            return m_availableBuffer[index].load(std::memory_order_acquire) == flag;
+        }
+
+        /**
+         * Get the highest sequence number that can be safely read from the ring buffer.  Depending on the implementation of the Sequencer this call may need to scan a number of values
+         * in the Sequencer.  The scan will range from nextSequence to availableSequence.  If there are no available values > nextSequence the return value will be nextSequence - 1.
+         * To work correctly a consumer should pass a value that it 1 higher than the last sequence that was successfully processed.
+         *
+         * \param lowerBound The sequence to start scanning from.
+         * \param availableSequence The sequence to scan to.
+         * \returns The highest value that can be safely read, will be at least\returns <code>nextSequence - 1</code>\returns .
+         */ 
+        std::int64_t getHighestPublishedSequence(std::int64_t lowerBound, std::int64_t availableSequence) override
+        {
+            auto sequence = lowerBound;
+
+            while (sequence <= availableSequence)
+            {
+                // All the slots between index and the end of the buffer expect the same availability flag
+                auto index = calculateIndex(sequence);
+                auto count = static_cast< std::int32_t >(std::min< std::int64_t >(availableSequence - sequence + 1, this->m_bufferSize - index));
+
+                auto availableCount = countAvailable(index, count, calculateAvailabilityFlag(sequence));
+                if (availableCount < count)
+                {
+                    return sequence + availableCount - 1;
+                }
+
+                sequence += count;
+            }
+
+            return availableSequence;
+        }
+
+    protected:
+        bool hasAvailableCapacity(const AtomicSequenceArray& gatingSequences, std::int32_t requiredCapacity, std::int64_t cursorValue)
+        {
+            auto wrapPoint = (cursorValue + requiredCapacity) - this->m_bufferSize;
+            auto cachedGatingSequence = m_gatingSequenceCache->value();
+
+            if (wrapPoint > cachedGatingSequence || cachedGatingSequence > cursorValue)
+            {
+                auto minSequence = gatingSequences.minimumSequence(cursorValue, wrapPoint);
+                m_gatingSequenceCache->setValue(minSequence);
+
+                if (wrapPoint > minSequence)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::shared_ptr< Sequence > m_gatingSequenceCache = std::make_shared< Sequence >();
+
+    private:
+        void initializeAvailableBuffer()
+        {
+            // Called from the constructor before any consumer can observe the
+            // sequencer, so relaxed stores are sufficient here.
+            for (std::int32_t i = this->m_bufferSize - 1; i != 0; i--)
+            {
+                m_availableBuffer[i].store(-1, std::memory_order_relaxed);
+            }
+
+            m_availableBuffer[0].store(-1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Count the consecutive slots of the available buffer, starting at index, that hold the given availability flag.
+         */
+        std::int32_t countAvailable(std::int32_t index, std::int32_t count, std::int32_t flag) const
+        {
+            for (std::int32_t i = 0; i < count; ++i)
+            {
+                if (m_availableBuffer[index + i].load(std::memory_order_acquire) != flag)
+                    return i;
+            }
+
+            return count;
+        }
+
+        void setAvailable(std::int64_t sequence)
+        {
+            setAvailableBufferValue(calculateIndex(sequence), calculateAvailabilityFlag(sequence));
+        }
+
+        void setAvailableBufferValue(std::int32_t index, std::int32_t flag)
+        {
+            // Release-store so the event payload writes that happened before
+            // publish() are visible to any consumer that subsequently sees
+            // the flag via the matching acquire-load in isAvailable().
+            m_availableBuffer[index].store(flag, std::memory_order_release);
+        }
+
+        std::int32_t calculateAvailabilityFlag(std::int64_t sequence)
+        {
+            return static_cast< std::int32_t >(static_cast< std::uint64_t >(sequence) >> m_indexShift);
+        }
+
+        std::int32_t calculateIndex(std::int64_t sequence)
+        {
+            return static_cast< std::int32_t >(sequence) & m_indexMask;
+        }
+
+    private:
+        // availableBuffer tracks the state of each ringbuffer slot
+        // see below for more details on the approach
+        std::unique_ptr< std::atomic< std::int32_t >[], PlacementDeleter< std::atomic< std::int32_t > > > m_availableBuffer;
+        std::int32_t m_indexMask;
+        std::int32_t m_indexShift;
+    };
+
+} // namespace Disruptor
@@ -6,6 +6,7 @@
 
 #include "ArgumentNullException.h"
 #include "BlockingWaitStrategy.h"
+#include "ISequence.h"
 #include "LiteBlockingWaitStrategy.h"
 #include "SleepingWaitStrategy.h"
 
@@ -85,6 +86,21 @@ namespace Disruptor
         m_fallbackStrategy->signalAllWhenBlocking();
     }
 
+    void PhasedBackoffWaitStrategy::signalAllWhenAlerted()
+    {
+        m_fallbackStrategy->signalAllWhenAlerted();
+    }
+
+    WaitQueue* PhasedBackoffWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return m_fallbackStrategy->registerDependentSequence(sequence);
+    }
+
+    void PhasedBackoffWaitStrategy::unregisterBarrier(const ISequenceBarrier& barrier)
+    {
+        m_fallbackStrategy->unregisterBarrier(barrier);
+    }
+
     void PhasedBackoffWaitStrategy::writeDescriptionTo(std::ostream& stream) const
     {
         stream << "PhasedBackoffWaitStrategy (fallback: ";
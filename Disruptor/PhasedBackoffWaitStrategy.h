@@ -61,6 +61,21 @@ namespace Disruptor
          */
         void signalAllWhenBlocking() override;
 
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
+        /**
+         * \see IWaitStrategy::unregisterBarrier
+         */
+        void unregisterBarrier(const ISequenceBarrier& barrier) override;
+
         void writeDescriptionTo(std::ostream& stream) const override;
 
     private:
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Disruptor/MemoryPlacement.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Standard allocator taking its memory from a MemoryPlacement.
+     *
+     * \tparam T type of the allocated objects
+     */
+    template <class T>
+    class PlacementAllocator
+    {
+        template <class U>
+        friend class PlacementAllocator;
+
+    public:
+        using value_type = T;
+
+        PlacementAllocator() = default;
+
+        explicit PlacementAllocator(const MemoryPlacement& placement)
+            : m_placement(placement)
+        {
+        }
+
+        template <class U>
+        PlacementAllocator(const PlacementAllocator< U >& other)
+            : m_placement(other.m_placement)
+        {
+        }
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast< T* >(m_placement.allocate(count * sizeof(T)));
+        }
+
+        void deallocate(T* memory, std::size_t count)
+        {
+            m_placement.deallocate(memory, count * sizeof(T));
+        }
+
+        const MemoryPlacement& placement() const
+        {
+            return m_placement;
+        }
+
+        template <class U>
+        bool operator==(const PlacementAllocator< U >& other) const
+        {
+            return m_placement == other.m_placement;
+        }
+
+        template <class U>
+        bool operator!=(const PlacementAllocator< U >& other) const
+        {
+            return m_placement != other.m_placement;
+        }
+
+    private:
+        MemoryPlacement m_placement;
+    };
+
+
+    /**
+     * Deleter of an array allocated from a MemoryPlacement, for std::unique_ptr<T[], PlacementDeleter<T>>.
+     *
+     * \tparam T type of the elements of the array
+     */
+    template <class T>
+    class PlacementDeleter
+    {
+    public:
+        PlacementDeleter() = default;
+
+        PlacementDeleter(const MemoryPlacement& placement, std::size_t count)
+            : m_placement(placement)
+            , m_count(count)
+        {
+        }
+
+        void operator()(T* memory) const
+        {
+            for (std::size_t i = 0; i < m_count; ++i)
+                memory[i].~T();
+
+            m_placement.deallocate(memory, m_count * sizeof(T));
+        }
+
+    private:
+        MemoryPlacement m_placement;
+        std::size_t m_count = 0;
+    };
+
+} // namespace Disruptor
@@ -1,61 +1,146 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
+#include <vector>
 
+#include "Disruptor/AlertException.h"
+#include "Disruptor/FixedSequenceGroup.h"
+#include "Disruptor/IHighestPublishedSequenceProvider.h"
 #include "Disruptor/ISequenceBarrier.h"
 #include "Disruptor/IWaitStrategy.h"
 #include "Disruptor/Sequence.h"
+#include "Disruptor/StaticDispatch.h"
 
 
 namespace Disruptor
 {
 
-    class IHighestPublishedSequenceProvider;
-    class ISequence;
-    class IWaitStrategy;
-    class Sequence;
-
-
     /**
-     * 
+     *
      * ISequenceBarrier handed out for gating IEventProcessor on a cursor sequence and optional dependent IEventProcessors, using the given WaitStrategy.
-     */ 
-    class ProcessingSequenceBarrier : public ISequenceBarrier, public std::enable_shared_from_this< ProcessingSequenceBarrier >
+     *
+     * When TSequenceProvider and TWaitStrategy are concrete types, the calls made by waitFor() to the sequencer and the wait strategy are resolved at compile time
+     * and can be inlined (see StaticDispatch.h). The strategy still reads the dependent sequence and checks the alert of the barrier through virtual calls.
+     *
+     * \tparam TSequenceProvider type of the sequencer providing the highest published sequence
+     * \tparam TWaitStrategy type of the wait strategy used to wait for the cursor
+     */
+    template <class TSequenceProvider = IHighestPublishedSequenceProvider, class TWaitStrategy = IWaitStrategy>
+    class ProcessingSequenceBarrier : public ISequenceBarrier
     {
     public:
-        ProcessingSequenceBarrier(const std::shared_ptr< IHighestPublishedSequenceProvider >& sequenceProvider,
-                                  const std::shared_ptr< IWaitStrategy >& waitStrategy,
+        ProcessingSequenceBarrier(const std::shared_ptr< TSequenceProvider >& sequenceProvider,
+                                  const std::shared_ptr< TWaitStrategy >& waitStrategy,
                                   const std::shared_ptr< Sequence >& cursorSequence,
-                                  const std::vector< std::shared_ptr< ISequence > >& dependentSequences);
-
-        std::int64_t waitFor(std::int64_t sequence) override;
-
-        std::int64_t cursor() override;
-
-        bool isAlerted() override;
-
-        void alert() override;
-
-        void clearAlert() override;
-
-        void checkAlert() override;
+                                  const std::vector< std::shared_ptr< ISequence > >& dependentSequences)
+            : m_waitStrategy(waitStrategy)
+            , m_dependentSequence(getDependentSequence(cursorSequence, dependentSequences))
+            , m_cursorSequence(cursorSequence)
+            , m_sequenceProvider(sequenceProvider)
+            , m_waitStrategyRef(*m_waitStrategy)
+            , m_dependentSequenceRef(*m_dependentSequence)
+            , m_cursorSequenceRef(*m_cursorSequence)
+            , m_sequenceProviderRef(*m_sequenceProvider)
+            , m_alerted(false)
+        {
+        }
+
+        ~ProcessingSequenceBarrier() override
+        {
+            m_waitStrategyRef.unregisterBarrier(*this);
+        }
+
+        std::int64_t waitFor(std::int64_t sequence) override
+        {
+            checkAlert();
+
+            auto availableSequence = WaitStrategyDispatch< TWaitStrategy >::waitFor(m_waitStrategyRef, sequence, m_cursorSequenceRef, m_dependentSequenceRef, *this);
+
+            if (availableSequence < sequence)
+                return availableSequence;
+
+            return SequencerDispatch< TSequenceProvider >::getHighestPublishedSequence(m_sequenceProviderRef, sequence, availableSequence);
+        }
+
+        SequenceWaitResult tryWaitFor(std::int64_t sequence) override
+        {
+            if (isAlerted())
+                return SequenceWaitResult::alerted();
+
+            SequenceWaitResult result;
+            try
+            {
+                result = WaitStrategyDispatch< TWaitStrategy >::tryWaitFor(m_waitStrategyRef, sequence, m_cursorSequenceRef, m_dependentSequenceRef, *this);
+            }
+            catch (const AlertException&)
+            {
+                // Only thrown by the spinning strategies, when the alert is raised while they are waiting
+                return SequenceWaitResult::alerted();
+            }
+
+            if (!result.isAvailable() || result.sequence < sequence)
+                return result;
+
+            return SequenceWaitResult::available(SequencerDispatch< TSequenceProvider >::getHighestPublishedSequence(m_sequenceProviderRef, sequence, result.sequence));
+        }
+
+        std::int64_t cursor() override
+        {
+            return m_dependentSequenceRef.value();
+        }
+
+        bool isAlerted() override
+        {
+            return m_alerted.load(std::memory_order_acquire);
+        }
+
+        void alert() override
+        {
+            m_alerted.store(true, std::memory_order_release);
+            m_waitStrategyRef.signalAllWhenAlerted();
+        }
+
+        void clearAlert() override
+        {
+            m_alerted.store(false, std::memory_order_release);
+        }
+
+        void checkAlert() override
+        {
+            if (m_alerted.load(std::memory_order_acquire))
+            {
+                DISRUPTOR_THROW_ALERT_EXCEPTION();
+            }
+        }
+
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override
+        {
+            return m_waitStrategyRef.registerDependentSequence(sequence);
+        }
 
     private:
         static std::shared_ptr< ISequence > getDependentSequence(const std::shared_ptr< Sequence >& cursorSequence,
-                                                                 const std::vector< std::shared_ptr< ISequence > >& dependentSequences);
+                                                                 const std::vector< std::shared_ptr< ISequence > >& dependentSequences)
+        {
+            if (dependentSequences.empty())
+                return cursorSequence;
+
+            return std::make_shared< FixedSequenceGroup >(dependentSequences);
+        }
 
 
-        std::shared_ptr< IWaitStrategy > m_waitStrategy;
+        std::shared_ptr< TWaitStrategy > m_waitStrategy;
         std::shared_ptr< ISequence > m_dependentSequence;
         std::shared_ptr< Sequence > m_cursorSequence;
-        std::shared_ptr< IHighestPublishedSequenceProvider > m_sequenceProvider;
+        std::shared_ptr< TSequenceProvider > m_sequenceProvider;
 
-        IWaitStrategy& m_waitStrategyRef;
+        TWaitStrategy& m_waitStrategyRef;
         ISequence& m_dependentSequenceRef;
         Sequence& m_cursorSequenceRef;
-        IHighestPublishedSequenceProvider& m_sequenceProviderRef;
+        TSequenceProvider& m_sequenceProviderRef;
 
-        bool m_alerted;
+        std::atomic< bool > m_alerted;
     };
 
 } // namespace Disruptor
@@ -13,6 +13,8 @@ namespace std
             return stream << "Single";
         case Disruptor::ProducerType::Multi:
             return stream << "Multi";
+        case Disruptor::ProducerType::MultiFetchAndAdd:
+            return stream << "MultiFetchAndAdd";
         default:
             return stream << static_cast< int >(value);
         }
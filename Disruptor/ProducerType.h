@@ -16,7 +16,13 @@ namespace Disruptor
         /**
          * Create a RingBuffer supporting multiple event publishers to the one RingBuffer
          */ 
-        Multi
+        Multi,
+
+        /**
+         * Create a RingBuffer supporting multiple event publishers to the one RingBuffer, claiming sequences with fetch-and-add
+         * instead of compare-and-set. Suited to a large number of contending publishers.
+         */ 
+        MultiFetchAndAdd
     };
 
 } // namespace Disruptor
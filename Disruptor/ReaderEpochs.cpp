@@ -0,0 +1,133 @@
+#include "stdafx.h"
+#include "ReaderEpochs.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+
+namespace Disruptor
+{
+namespace
+{
+
+#if defined(DISRUPTOR_OS_FAMILY_LINUX) && defined(SYS_membarrier)
+
+    // From linux/membarrier.h, the expedited command interrupts the CPUs running the threads of the process instead of waiting for a grace period
+    const int membarrierPrivateExpedited = 1 << 3;
+    const int membarrierRegisterPrivateExpedited = 1 << 4;
+
+    bool registerProcessWideBarrier()
+    {
+        return ::syscall(SYS_membarrier, membarrierRegisterPrivateExpedited, 0) == 0;
+    }
+
+    void runProcessWideBarrier()
+    {
+        ::syscall(SYS_membarrier, membarrierPrivateExpedited, 0);
+    }
+
+#elif defined(DISRUPTOR_OS_FAMILY_WINDOWS)
+
+    bool registerProcessWideBarrier()
+    {
+        return true;
+    }
+
+    void runProcessWideBarrier()
+    {
+        ::FlushProcessWriteBuffers();
+    }
+
+#else
+
+    bool registerProcessWideBarrier()
+    {
+        return false;
+    }
+
+    void runProcessWideBarrier()
+    {
+    }
+
+#endif
+
+    struct ReaderRegistry
+    {
+        std::mutex mutex;
+        std::vector< const std::atomic< std::uint64_t >* > epochs;
+    };
+
+    // Never destroyed, the threads may exit after the static objects are destroyed
+    ReaderRegistry& readerRegistry()
+    {
+        static auto registry = new ReaderRegistry();
+        return *registry;
+    }
+
+} // namespace
+
+
+    ReaderEpochs::Reader::Reader()
+        : m_hasProcessWideBarrier(ReaderEpochs::hasProcessWideBarrier())
+    {
+        auto& registry = readerRegistry();
+
+        std::lock_guard< std::mutex > lock(registry.mutex);
+        registry.epochs.push_back(&m_epoch);
+    }
+
+    ReaderEpochs::Reader::~Reader()
+    {
+        auto& registry = readerRegistry();
+
+        std::lock_guard< std::mutex > lock(registry.mutex);
+        registry.epochs.erase(std::find(registry.epochs.begin(), registry.epochs.end(), &m_epoch));
+    }
+
+    void ReaderEpochs::synchronize()
+    {
+        // Either a reader sees the structure published before this barrier, or this thread sees the epoch of the reader which may have loaded
+        // the structure it replaced
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (hasProcessWideBarrier())
+            runProcessWideBarrier();
+
+        auto& registry = readerRegistry();
+
+        // The threads in a read section never take the lock, a thread starting or exiting meanwhile waits for the readers to be done
+        std::lock_guard< std::mutex > lock(registry.mutex);
+
+        std::vector< std::pair< const std::atomic< std::uint64_t >*, std::uint64_t > > readingEpochs;
+        for (auto epoch : registry.epochs)
+        {
+            auto value = epoch->load(std::memory_order_acquire);
+            if (value % 2 != 0)
+                readingEpochs.emplace_back(epoch, value);
+        }
+
+        for (auto&& readingEpoch : readingEpochs)
+        {
+            while (readingEpoch.first->load(std::memory_order_acquire) == readingEpoch.second)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool ReaderEpochs::hasProcessWideBarrier()
+    {
+        static const auto isRegistered = registerProcessWideBarrier();
+        return isRegistered;
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace Disruptor
+{
+
+    /**
+     * Epochs of the threads reading structures which writers replace and free, e.g. the arrays of an AtomicSequenceArray.
+     *
+     * A reader moves the epoch of its own slot to an odd value before loading the pointer to the structure, and to the next even value once it
+     * no longer uses it: two plain stores to memory owned by the thread, no read-modify-write on a shared cache line. A writer publishes the new
+     * structure, then calls synchronize(), which returns once every thread reading at that time has left its read section, so that the structure
+     * it replaced can be freed.
+     *
+     * The epoch must be visible to the writer before the reader loads the pointer, which requires a store-load barrier. Where the system can
+     * run a barrier on all the threads of the process (membarrier() on Linux, FlushProcessWriteBuffers() on Windows), synchronize() runs it on
+     * behalf of the readers, which only prevent the compiler from reordering. Otherwise the readers issue a full fence.
+     */
+    class ReaderEpochs
+    {
+    public:
+        /**
+         * Read section slot of a thread
+         */
+        class Reader
+        {
+        public:
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+            /**
+             * Enter a read section: a structure loaded after this call is not freed before the matching exit(). Read sections may be nested.
+             */
+            void enter()
+            {
+                if (m_depth++ != 0)
+                    return;
+
+                m_epoch.store(m_epoch.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+                if (m_hasProcessWideBarrier)
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                else
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+
+            void exit()
+            {
+                if (--m_depth != 0)
+                    return;
+
+                // Orders the reads of the structure before a writer seeing the new epoch frees it
+                m_epoch.store(m_epoch.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+        private:
+            friend class ReaderEpochs;
+
+            Reader();
+            ~Reader();
+
+            std::atomic< std::uint64_t > m_epoch { 0 };
+            std::int32_t m_depth = 0;
+            bool m_hasProcessWideBarrier;
+        };
+
+        /**
+         * The slot of the calling thread, registered on first use and unregistered when the thread exits
+         */
+        static Reader& currentReader()
+        {
+            static thread_local Reader reader;
+            return reader;
+        }
+
+        /**
+         * Wait until the threads which were in a read section when the call started have left it. A structure replaced before the call is
+         * then no longer read by any thread. Must not be called from a read section.
+         */
+        static void synchronize();
+
+        /**
+         * Returns true if synchronize() runs the store-load barrier on behalf of the readers.
+         */
+        static bool hasProcessWideBarrier();
+    };
+
+} // namespace Disruptor
@@ -6,15 +6,20 @@
 #include "Disruptor/ArgumentException.h"
 #include "Disruptor/ArgumentOutOfRangeException.h"
 #include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/ClaimLease.h"
+#include "Disruptor/FetchAndAddMultiProducerSequencer.h"
 #include "Disruptor/ICursored.h"
 #include "Disruptor/IEventSequencer.h"
 #include "Disruptor/IEventTranslator.h"
 #include "Disruptor/IEventTranslatorVararg.h"
 #include "Disruptor/ISequenceBarrier.h"
 #include "Disruptor/ISequencer.h"
+#include "Disruptor/MemoryPlacement.h"
 #include "Disruptor/MultiProducerSequencer.h"
+#include "Disruptor/PlacementAllocator.h"
 #include "Disruptor/ProducerType.h"
 #include "Disruptor/SingleProducerSequencer.h"
+#include "Disruptor/StaticDispatch.h"
 #include "Disruptor/Util.h"
 
 
@@ -23,11 +28,16 @@ namespace Disruptor
 
     /**
      * Ring based store of reusable entries containing the data representing an event being exchanged between event publisher and IEventProcessors.
+     *
+     * RingBuffer<T> drives its sequencer through the ISequencer<T> interface. A concrete sequencer type can be supplied instead,
+     * e.g. RingBuffer<T, SingleProducerSequencer<T, BusySpinWaitStrategy>>, in which case the claim and publish calls are resolved at compile time.
+     * The sequencer must then be exactly of that type (see StaticDispatch.h).
      * 
      * \tparam T implementation storing the data for sharing during exchange or parallel coordination of an event.
+     * \tparam TSequencer type of the sequencer, ISequencer<T> by default.
      */ 
-    template <class T>
-    class RingBuffer : public IEventSequencer< T >, public ICursored, public std::enable_shared_from_this< RingBuffer< T > >
+    template <class T, class TSequencer = ISequencer< T >>
+    class RingBuffer : public IEventSequencer< T >, public ICursored, public std::enable_shared_from_this< RingBuffer< T, TSequencer > >
     {
         static_assert(std::is_class< T >::value, "T should be a class");
 
@@ -65,10 +75,13 @@ namespace Disruptor
          * 
          * \param eventFactory eventFactory to create entries for filling the RingBuffer
          * \param sequencer waiting strategy employed by processorsToTrack waiting on entries becoming available.
+         * \param placement placement of the entries on the NUMA nodes and their page size, the entries are created by eventFactory from the first-touch thread of the placement if any
          */ 
-        RingBuffer(const std::function< T() >& eventFactory, const std::shared_ptr< ISequencer< T > >& sequencer)
+        RingBuffer(const std::function< T() >& eventFactory, const std::shared_ptr< TSequencer >& sequencer, const MemoryPlacement& placement = MemoryPlacement())
+            : m_entries(PlacementAllocator< T >(placement))
+            , m_sequencer(sequencer)
+            , m_sequencerRef(*m_sequencer)
         {
-            m_sequencer = sequencer;
             m_bufferSize = sequencer->bufferSize();
             
             if (m_bufferSize < 1)
@@ -81,10 +94,15 @@ namespace Disruptor
                 DISRUPTOR_THROW_ARGUMENT_EXCEPTION("bufferSize must be a power of 2");
             }
 
+            requireExactType(m_sequencerRef);
+
             m_indexMask = m_bufferSize - 1;
-            m_entries.resize(m_bufferSize + 2 * m_bufferPad);
 
-            fill(eventFactory);
+            placement.touch([&]
+            {
+                m_entries.resize(m_bufferSize + 2 * m_bufferPad);
+                fill(eventFactory);
+            });
         }
 
         
@@ -131,6 +149,18 @@ namespace Disruptor
             return createMultiProducer(factory, bufferSize, std::make_shared< BlockingWaitStrategy >());
         }
 
+        /**
+         * Create a new multiple producer RingBuffer claiming its sequences with fetch-and-add, see FetchAndAddMultiProducerSequencer<T>.
+         * 
+         * \param factory used to create the events within the ring buffer.
+         * \param bufferSize number of elements to create within the ring buffer.
+         * \param waitStrategy used to determine how to wait for new elements to become available.
+         */ 
+        static std::shared_ptr< RingBuffer< T > > createMultiProducerFetchAndAdd(const std::function< T() >& factory, std::int32_t bufferSize, const std::shared_ptr< IWaitStrategy >& waitStrategy)
+        {
+            return std::make_shared< RingBuffer< T > >(factory, std::make_shared< FetchAndAddMultiProducerSequencer< T > >(bufferSize, waitStrategy));
+        }
+
         /**
          * Create a new single producer RingBuffer with the specified wait strategy.
          * 
@@ -173,11 +203,54 @@ namespace Disruptor
                     return createSingleProducer(factory, bufferSize, waitStrategy);
                 case ProducerType::Multi:
                     return createMultiProducer(factory, bufferSize, waitStrategy);
+                case ProducerType::MultiFetchAndAdd:
+                    return createMultiProducerFetchAndAdd(factory, bufferSize, waitStrategy);
                 default:
                     DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(producerType);
             }
         }
 
+        /**
+         * Create a new Ring Buffer with the specified producer type, placing its entries and the availability buffer of its sequencer on the NUMA nodes.
+         *
+         * \param producerType producer type to use<see cref="ProducerType"/>
+         * \param factory used to create the events within the ring buffer.
+         * \param bufferSize number of elements to create within the ring buffer.
+         * \param waitStrategy used to determine how to wait for new elements to become available.
+         * \param placement placement of the memory of the ring buffer, see MemoryPlacement
+         */
+        static std::shared_ptr< RingBuffer< T > > create(ProducerType producerType,
+                                                         const std::function< T() >& factory,
+                                                         std::int32_t bufferSize,
+                                                         const std::shared_ptr< IWaitStrategy >& waitStrategy,
+                                                         const MemoryPlacement& placement)
+        {
+            switch (producerType)
+            {
+                case ProducerType::Single:
+                    return std::make_shared< RingBuffer< T > >(factory, std::make_shared< SingleProducerSequencer< T > >(bufferSize, waitStrategy), placement);
+                case ProducerType::Multi:
+                    return std::make_shared< RingBuffer< T > >(factory, std::make_shared< MultiProducerSequencer< T > >(bufferSize, waitStrategy, placement), placement);
+                case ProducerType::MultiFetchAndAdd:
+                    return std::make_shared< RingBuffer< T > >(factory, std::make_shared< FetchAndAddMultiProducerSequencer< T > >(bufferSize, waitStrategy, placement), placement);
+                default:
+                    DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(producerType);
+            }
+        }
+
+        /**
+         * Create a new RingBuffer using a sequencer of type TSequencer, e.g. RingBuffer<T, SingleProducerSequencer<T, BusySpinWaitStrategy>>::create(factory, 1024, waitStrategy).
+         *
+         * \param factory used to create the events within the ring buffer.
+         * \param bufferSize number of elements to create within the ring buffer.
+         * \param waitStrategy used to determine how to wait for new elements to become available.
+         */
+        template <class TWaitStrategy>
+        static std::shared_ptr< RingBuffer< T, TSequencer > > create(const std::function< T() >& factory, std::int32_t bufferSize, const std::shared_ptr< TWaitStrategy >& waitStrategy)
+        {
+            return std::make_shared< RingBuffer< T, TSequencer > >(factory, std::make_shared< TSequencer >(bufferSize, waitStrategy));
+        }
+
         /**
          * Get the event for a given sequence in the RingBuffer.
          * 
@@ -195,27 +268,27 @@ namespace Disruptor
 
         bool hasAvailableCapacity(std::int32_t requiredCapacity) override
         {
-            return m_sequencer->hasAvailableCapacity(requiredCapacity);
+            return m_sequencerRef.hasAvailableCapacity(requiredCapacity);
         }
 
         std::int64_t next() override
         {
-            return m_sequencer->next();
+            return SequencerDispatch< TSequencer >::next(m_sequencerRef);
         }
 
         std::int64_t next(std::int32_t n) override
         {
-            return m_sequencer->next(n);
+            return SequencerDispatch< TSequencer >::next(m_sequencerRef, n);
         }
 
         std::int64_t tryNext() override
         {
-            return m_sequencer->tryNext();
+            return SequencerDispatch< TSequencer >::tryNext(m_sequencerRef);
         }
 
         std::int64_t tryNext(std::int32_t n) override
         {
-            return m_sequencer->tryNext(n);
+            return SequencerDispatch< TSequencer >::tryNext(m_sequencerRef, n);
         }
 
         /**
@@ -223,7 +296,7 @@ namespace Disruptor
          */ 
         std::int64_t cursor() const override
         {
-            return m_sequencer->cursor();
+            return m_sequencerRef.cursor();
         }
 
         /**
@@ -233,12 +306,12 @@ namespace Disruptor
          */ 
         std::int64_t getRemainingCapacity() override
         {
-            return m_sequencer->getRemainingCapacity();
+            return m_sequencerRef.getRemainingCapacity();
         }
 
         void publish(std::int64_t sequence) override
         {
-            m_sequencer->publish(sequence);
+            SequencerDispatch< TSequencer >::publish(m_sequencerRef, sequence);
         }
 
         /**
@@ -249,35 +322,35 @@ namespace Disruptor
          */ 
         void publish(std::int64_t lo, std::int64_t hi) override
         {
-            m_sequencer->publish(lo, hi);
+            SequencerDispatch< TSequencer >::publish(m_sequencerRef, lo, hi);
         }
 
         //deprecated
         void resetTo(std::int64_t sequence)
         {
-            m_sequencer->claim(sequence);
-            m_sequencer->publish(sequence);
+            m_sequencerRef.claim(sequence);
+            SequencerDispatch< TSequencer >::publish(m_sequencerRef, sequence);
         }
 
         T& claimAndGetPreallocated(std::int64_t sequence)
         {
-            m_sequencer->claim(sequence);
+            m_sequencerRef.claim(sequence);
             return (*this)[sequence];
         }
 
         bool isPublished(std::int64_t sequence)
         {
-            return m_sequencer->isAvailable(sequence);
+            return m_sequencerRef.isAvailable(sequence);
         }
 
         void addGatingSequences(const std::vector< std::shared_ptr< ISequence > >& gatingSequences)
         {
-            m_sequencer->addGatingSequences(gatingSequences);
+            m_sequencerRef.addGatingSequences(gatingSequences);
         }
 
         std::int64_t getMinimumGatingSequence()
         {
-            return m_sequencer->getMinimumSequence();
+            return m_sequencerRef.getMinimumSequence();
         }
 
         /**
@@ -288,7 +361,17 @@ namespace Disruptor
          */ 
         bool removeGatingSequence(const std::shared_ptr< ISequence >& sequence)
         {
-            return m_sequencer->removeGatingSequence(sequence);
+            return m_sequencerRef.removeGatingSequence(sequence);
+        }
+
+        /**
+         * Track the gating sequences by groups with a cached minimum, see ISequencer::setGatingSequenceGroupSize.
+         *
+         * \param groupSize number of gating sequences per group, 0 to read all the gating sequences
+         */
+        void setGatingSequenceGroupSize(std::int32_t groupSize)
+        {
+            m_sequencerRef.setGatingSequenceGroupSize(groupSize);
         }
 
         /**
@@ -299,7 +382,7 @@ namespace Disruptor
          */ 
         std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack = {})
         {
-            return m_sequencer->newBarrier(sequencesToTrack);
+            return m_sequencerRef.newBarrier(sequencesToTrack);
         }
 
         /**
@@ -310,7 +393,22 @@ namespace Disruptor
          */ 
         std::shared_ptr< EventPoller< T > > newPoller(const std::vector< std::shared_ptr< ISequence > >& gatingSequences = {})
         {
-            return m_sequencer->newPoller(this->shared_from_this(), gatingSequences);
+            return m_sequencerRef.newPoller(this->shared_from_this(), gatingSequences);
+        }
+
+        /**
+         * Creates a producer handle that claims sequences of this ring buffer by blocks of leaseSize. Each publisher thread should use its own handle.
+         *
+         * \param leaseSize number of sequences claimed at once
+         * \param fillerTranslator translator writing the events published for the sequences of a lease that are not used
+         * \param flushTimeout time after which the unused sequences of a lease are flushed, zero to only flush explicitly
+         * \returns A ClaimLease handing out the sequences of its current lease.
+         */
+        std::shared_ptr< ClaimLease< T, TSequencer > > newClaimLease(std::int32_t leaseSize,
+                                                                     const std::shared_ptr< IEventTranslator< T > >& fillerTranslator,
+                                                                     ClockConfig::Duration flushTimeout = ClockConfig::Duration::zero())
+        {
+            return std::make_shared< ClaimLease< T, TSequencer > >(this->shared_from_this(), leaseSize, fillerTranslator, flushTimeout);
         }
 
         template <class TTranslator>
@@ -320,7 +418,7 @@ namespace Disruptor
         >
         ::type publishEvent(const std::shared_ptr< TTranslator >& translator)
         {
-            auto sequence = m_sequencer->next();
+            auto sequence = SequencerDispatch< TSequencer >::next(m_sequencerRef);
             translateAndPublish(translator, sequence);
         }
 
@@ -334,7 +432,7 @@ namespace Disruptor
         {
             try
             {
-                auto sequence = m_sequencer->tryNext();
+                auto sequence = SequencerDispatch< TSequencer >::tryNext(m_sequencerRef);
                 translateAndPublish(translator, sequence);
                 return true;
             }
@@ -351,7 +449,7 @@ namespace Disruptor
         >
         ::type publishEvent(const std::shared_ptr< TTranslator >& translator, const TArgs&... args)
         {
-            auto sequence = m_sequencer->next();
+            auto sequence = SequencerDispatch< TSequencer >::next(m_sequencerRef);
             translateAndPublish(translator, sequence, args...);
         }
 
@@ -365,7 +463,7 @@ namespace Disruptor
         {
             try
             {
-                auto sequence = m_sequencer->tryNext();
+                auto sequence = SequencerDispatch< TSequencer >::tryNext(m_sequencerRef);
                 translateAndPublish(translator, sequence, args...);
                 return true;
             }
@@ -401,7 +499,7 @@ namespace Disruptor
         ::type publishEvents(const TTranslators& translators, std::int32_t batchStartsAt, std::int32_t batchSize)
         {
             checkBounds(static_cast< std::int32_t >(translators.size()), batchStartsAt, batchSize);
-            std::int64_t finalSequence = m_sequencer->next(batchSize);
+            std::int64_t finalSequence = SequencerDispatch< TSequencer >::next(m_sequencerRef, batchSize);
             translateAndPublishBatch(translators, batchStartsAt, batchSize, finalSequence);
         }
 
@@ -435,7 +533,7 @@ namespace Disruptor
             checkBounds(static_cast< std::int32_t >(translators.size()), batchStartsAt, batchSize);
             try
             {
-                auto finalSequence = m_sequencer->tryNext(batchSize);
+                auto finalSequence = SequencerDispatch< TSequencer >::tryNext(m_sequencerRef, batchSize);
                 translateAndPublishBatch(translators, batchStartsAt, batchSize, finalSequence);
                 return true;
             }
@@ -471,7 +569,7 @@ namespace Disruptor
         ::type publishEvents(const std::shared_ptr< TTranslator >& translator, std::int32_t batchStartsAt, std::int32_t batchSize, const std::initializer_list< TArgs >&... args)
         {
             checkBounds(getGreatestLength(args...), batchStartsAt, batchSize);
-            std::int64_t finalSequence = m_sequencer->next(batchSize);
+            std::int64_t finalSequence = SequencerDispatch< TSequencer >::next(m_sequencerRef, batchSize);
             translateAndPublishBatch(translator, batchStartsAt, batchSize, finalSequence, args...);
         }
 
@@ -505,7 +603,7 @@ namespace Disruptor
             checkBounds(getGreatestLength(args...), batchStartsAt, batchSize);
             try
             {
-                auto finalSequence = m_sequencer->tryNext(batchSize);
+                auto finalSequence = SequencerDispatch< TSequencer >::tryNext(m_sequencerRef, batchSize);
                 translateAndPublishBatch(translator, batchStartsAt, batchSize, finalSequence, args...);
                 return true;
             }
@@ -518,7 +616,7 @@ namespace Disruptor
         void writeDescriptionTo(std::ostream& stream) const
         {
             stream << "BufferSize: " << m_bufferSize << ", Sequencer: { ";
-            m_sequencer->writeDescriptionTo(stream);
+            m_sequencerRef.writeDescriptionTo(stream);
             stream << " }";
         }
 
@@ -567,7 +665,7 @@ namespace Disruptor
             {
             }
 
-            m_sequencer->publish(sequence);
+            SequencerDispatch< TSequencer >::publish(m_sequencerRef, sequence);
         }
 
         template <class TTranslator, class... TArgs>
@@ -585,7 +683,7 @@ namespace Disruptor
             {
             }
 
-            m_sequencer->publish(sequence);
+            SequencerDispatch< TSequencer >::publish(m_sequencerRef, sequence);
         }
 
         template <class TTranslators, class = decltype(std::declval< TTranslators >().begin())>
@@ -615,7 +713,7 @@ namespace Disruptor
             {
             }
 
-            m_sequencer->publish(initialSequence, finalSequence);
+            SequencerDispatch< TSequencer >::publish(m_sequencerRef, initialSequence, finalSequence);
         }
 
         template <class TTranslator, class... TArgs>
@@ -647,16 +745,17 @@ namespace Disruptor
             {
             }
 
-            m_sequencer->publish(initialSequence, finalSequence);
+            SequencerDispatch< TSequencer >::publish(m_sequencerRef, initialSequence, finalSequence);
         }
 
     private:
         char padding0[56];
-        mutable std::vector< T > m_entries;
+        mutable std::vector< T, PlacementAllocator< T > > m_entries;
         std::int32_t m_indexMask;
         std::int32_t m_bufferSize;
-        std::shared_ptr< ISequencer< T > > m_sequencer;
-        char padding1[40];
+        std::shared_ptr< TSequencer > m_sequencer;
+        TSequencer& m_sequencerRef;
+        char padding1[32];
     };
     
 } // namespace Disruptor
@@ -665,8 +764,8 @@ namespace Disruptor
 namespace std
 {
     
-    template <class T>
-    ostream& operator<<(ostream& stream, const Disruptor::RingBuffer< T >& ringBuffer)
+    template <class T, class TSequencer>
+    ostream& operator<<(ostream& stream, const Disruptor::RingBuffer< T, TSequencer >& ringBuffer)
     {
         stream << "RingBuffer: { ";
         ringBuffer.writeDescriptionTo(stream);
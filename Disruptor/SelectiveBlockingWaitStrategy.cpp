@@ -0,0 +1,63 @@
+#include "stdafx.h"
+#include "SelectiveBlockingWaitStrategy.h"
+
+#include <ostream>
+
+#include "ISequenceBarrier.h"
+#include "Sequence.h"
+
+
+namespace Disruptor
+{
+
+    std::int64_t SelectiveBlockingWaitStrategy::waitFor(std::int64_t sequence,
+                                                        Sequence& cursor,
+                                                        ISequence& dependentSequence,
+                                                        ISequenceBarrier& barrier)
+    {
+        auto result = tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+
+        return result.sequence;
+    }
+
+    SequenceWaitResult SelectiveBlockingWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                                 Sequence& cursor,
+                                                                 ISequence& dependentSequence,
+                                                                 ISequenceBarrier& barrier)
+    {
+        if (&dependentSequence == &cursor)
+        {
+            if (m_cursorWaitQueue.tryWaitUntil([&] { return cursor.value() >= sequence; }, barrier) == SequenceWaitStatus::Alerted)
+                return SequenceWaitResult::alerted();
+
+            return SequenceWaitResult::available(cursor.value());
+        }
+
+        // The sequences of the processors never pass the cursor, so there is no need to wait for the cursor first
+        return m_waiterRegistry.tryWaitFor(sequence, dependentSequence, barrier);
+    }
+
+    void SelectiveBlockingWaitStrategy::signalAllWhenBlocking()
+    {
+        m_cursorWaitQueue.wakeAll();
+    }
+
+    void SelectiveBlockingWaitStrategy::signalAllWhenAlerted()
+    {
+        m_cursorWaitQueue.wakeAll();
+        m_waiterRegistry.wakeAll();
+    }
+
+    WaitQueue* SelectiveBlockingWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return &m_waiterRegistry.registerSequence(sequence);
+    }
+
+    void SelectiveBlockingWaitStrategy::writeDescriptionTo(std::ostream& stream) const
+    {
+        stream << "SelectiveBlockingWaitStrategy";
+    }
+
+} // namespace Disruptor
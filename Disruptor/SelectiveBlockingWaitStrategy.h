@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaitQueue.h"
+#include "Disruptor/WaiterRegistry.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Blocking strategy which only wakes the barriers gated on the sequence that advanced.
+     *
+     * Barriers without dependent sequences park on a queue signalled by the publishers. Barriers gated on IEventProcessors park on the queues
+     * of their sequences, which the processors signal after each batch: they are not woken up by the publishers, and only by their direct
+     * upstream processors. A barrier gated on a sequence which is not registered by its processor busy spins on it.
+     */
+    class SelectiveBlockingWaitStrategy : public IWaitStrategy
+    {
+    public:
+        /**
+         * \see IWaitStrategy::waitFor
+         */
+        std::int64_t waitFor(std::int64_t sequence,
+                             Sequence& cursor,
+                             ISequence& dependentSequence,
+                             ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenBlocking
+         */
+        void signalAllWhenBlocking() override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
+        void writeDescriptionTo(std::ostream& stream) const override;
+
+    private:
+        WaitQueue m_cursorWaitQueue;
+        WaiterRegistry m_waiterRegistry;
+    };
+
+} // namespace Disruptor
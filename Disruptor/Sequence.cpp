@@ -14,16 +14,6 @@ namespace Disruptor
     {
     }
 
-    std::int64_t Sequence::value() const
-    {
-        return std::atomic_load_explicit(&m_fieldsValue, std::memory_order_acquire);
-    }
-
-    void Sequence::setValue(std::int64_t value)
-    {
-        std::atomic_store_explicit(&m_fieldsValue, value, std::memory_order_release);
-    }
-
     bool Sequence::compareAndSet(std::int64_t expectedSequence, std::int64_t nextSequence)
     {
         return std::atomic_compare_exchange_strong(&m_fieldsValue, &expectedSequence, nextSequence);
@@ -25,14 +25,20 @@ namespace Disruptor
         /**
          * Current sequence number
          */ 
-        std::int64_t value() const override;
+        std::int64_t value() const override
+        {
+            return std::atomic_load_explicit(&m_fieldsValue, std::memory_order_acquire);
+        }
 
         /**
          * Perform an ordered write of this sequence.  The intent is a Store/Store barrier between this write and any previous store.
          * 
          * \param value The new value for the sequence.
          */
-        void setValue(std::int64_t value) override;
+        void setValue(std::int64_t value) override
+        {
+            std::atomic_store_explicit(&m_fieldsValue, value, std::memory_order_release);
+        }
 
         /**
          * Atomically set the value to the given updated value if the current value == the expected value.
@@ -59,6 +65,14 @@ namespace Disruptor
 
         void writeDescriptionTo(std::ostream& stream) const override;
 
+        /**
+         * Address of the counter, used to monitor its cache line while waiting for it to change.
+         */
+        const void* valueAddress() const
+        {
+            return &m_fieldsValue;
+        }
+
         /**
          * Set to -1 as sequence starting point
          */ 
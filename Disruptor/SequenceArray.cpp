@@ -0,0 +1,74 @@
+#include "stdafx.h"
+#include "SequenceArray.h"
+
+#include <algorithm>
+#include <typeinfo>
+
+#include "ArgumentException.h"
+
+
+namespace Disruptor
+{
+
+    SequenceArray::SequenceArray(const std::vector< std::shared_ptr< ISequence > >& sequences, std::int32_t groupSize)
+        : m_sequences(sequences)
+        , m_groupSize(groupSize)
+    {
+        if (groupSize < 0)
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("groupSize must not be negative");
+
+        for (auto&& sequence : m_sequences)
+        {
+            if (typeid(*sequence) == typeid(Sequence))
+                m_concreteSequences.push_back(static_cast< const Sequence* >(sequence.get()));
+            else
+                m_otherSequences.push_back(sequence.get());
+        }
+
+        if (groupSize > 0)
+        {
+            m_groupCount = (m_concreteSequences.size() + groupSize - 1) / groupSize;
+            m_groupMinimums.reset(new GroupMinimum[m_groupCount]);
+        }
+    }
+
+    std::int64_t SequenceArray::refreshMinimum(std::int64_t requiredSequence, bool stopAtLaggingGroup) const
+    {
+        auto minimum = std::numeric_limits< std::int64_t >::max();
+        auto refresh = true;
+
+        for (std::size_t group = 0; group < m_groupCount; ++group)
+        {
+            auto& groupMinimum = m_groupMinimums[group].value;
+            auto value = groupMinimum.load(std::memory_order_acquire);
+
+            if (refresh && value < requiredSequence)
+            {
+                auto first = group * m_groupSize;
+                auto last = std::min< std::size_t >(first + m_groupSize, m_concreteSequences.size());
+
+                value = std::numeric_limits< std::int64_t >::max();
+                for (auto i = first; i < last; ++i)
+                {
+                    value = std::min(value, m_concreteSequences[i]->Sequence::value());
+                }
+                groupMinimum.store(value, std::memory_order_release);
+
+                // Once a group is behind the required sequence the other groups cannot change the outcome, their cached minimums are kept
+                if (stopAtLaggingGroup && value < requiredSequence)
+                    refresh = false;
+            }
+
+            minimum = std::min(minimum, value);
+        }
+
+        for (auto sequence : m_otherSequences)
+        {
+            minimum = std::min(minimum, sequence->value());
+        }
+
+        m_minimum.store(minimum, std::memory_order_release);
+        return minimum;
+    }
+
+} // namespace Disruptor
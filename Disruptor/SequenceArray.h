@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "Disruptor/ISequence.h"
+#include "Disruptor/Sequence.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Immutable group of sequences laid out for computing their minimum value.
+     *
+     * The instances of exactly the Sequence class are stored in a contiguous array, so minimumSequence() reads them in a tight loop without
+     * virtual calls. Other ISequence implementations, like FixedSequenceGroup or classes derived from Sequence, are read through ISequence::value().
+     *
+     * When built with a group size, the Sequence instances are split in groups of that size, each one with a cached minimum, and the minimum
+     * of the whole array is cached as well. Since sequences never move backwards a cached minimum remains a lower bound of its group, so
+     * minimumSequence(minimum, requiredSequence) returns the cached minimum of the array when it is not behind requiredSequence and otherwise
+     * only reads the groups whose cached minimum is behind.
+     */
+    class SequenceArray
+    {
+    public:
+        SequenceArray() = default;
+
+        /**
+         * \param sequences sequences to be tracked, the array shares their ownership
+         * \param groupSize number of sequences per group with a cached minimum, 0 to always read all the sequences
+         */
+        explicit SequenceArray(const std::vector< std::shared_ptr< ISequence > >& sequences, std::int32_t groupSize = 0);
+
+        SequenceArray(const SequenceArray&) = delete;
+        SequenceArray& operator=(const SequenceArray&) = delete;
+
+        /**
+         * Get the minimum value of the sequences.
+         *
+         * \param minimum an initial default minimum, returned if the array is empty
+         */
+        std::int64_t minimumSequence(std::int64_t minimum = std::numeric_limits< std::int64_t >::max()) const
+        {
+            if (m_groupMinimums != nullptr)
+                return std::min(minimum, refreshMinimum(std::numeric_limits< std::int64_t >::max(), false));
+
+            for (auto sequence : m_concreteSequences)
+            {
+                auto value = sequence->Sequence::value();
+                minimum = value < minimum ? value : minimum;
+            }
+
+            for (auto sequence : m_otherSequences)
+            {
+                auto value = sequence->value();
+                minimum = value < minimum ? value : minimum;
+            }
+
+            return minimum;
+        }
+
+        /**
+         * Get a lower bound of the minimum value of the sequences, which is not behind requiredSequence if and only if the minimum value is not.
+         * Without groups, the minimum value itself is returned.
+         *
+         * \param minimum an initial default minimum, returned if the array is empty
+         * \param requiredSequence sequence that all the sequences must have reached, e.g. the wrap point of a producer
+         */
+        std::int64_t minimumSequence(std::int64_t minimum, std::int64_t requiredSequence) const
+        {
+            if (m_groupMinimums == nullptr)
+                return minimumSequence(minimum);
+
+            auto cachedMinimum = m_minimum.load(std::memory_order_acquire);
+            if (cachedMinimum >= requiredSequence)
+                return std::min(minimum, cachedMinimum);
+
+            return std::min(minimum, refreshMinimum(requiredSequence, true));
+        }
+
+        /**
+         * The sequences, in the order they were supplied
+         */
+        const std::vector< std::shared_ptr< ISequence > >& sequences() const
+        {
+            return m_sequences;
+        }
+
+        std::size_t size() const
+        {
+            return m_sequences.size();
+        }
+
+        bool empty() const
+        {
+            return m_sequences.empty();
+        }
+
+        std::int32_t groupSize() const
+        {
+            return m_groupSize;
+        }
+
+    private:
+        struct GroupMinimum
+        {
+            char padding0[56] = {};
+            std::atomic< std::int64_t > value { std::numeric_limits< std::int64_t >::min() };
+            char padding1[56] = {};
+        };
+
+        std::int64_t refreshMinimum(std::int64_t requiredSequence, bool stopAtLaggingGroup) const;
+
+        std::vector< std::shared_ptr< ISequence > > m_sequences;
+        std::vector< const Sequence* > m_concreteSequences;
+        std::vector< const ISequence* > m_otherSequences;
+
+        std::int32_t m_groupSize = 0;
+        std::unique_ptr< GroupMinimum[] > m_groupMinimums;
+        std::size_t m_groupCount = 0;
+        mutable std::atomic< std::int64_t > m_minimum { std::numeric_limits< std::int64_t >::min() };
+    };
+
+} // namespace Disruptor
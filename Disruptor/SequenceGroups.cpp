@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "SequenceGroups.h"
 
+#include "AtomicSequenceArray.h"
 #include "ICursored.h"
 #include "ISequence.h"
 
@@ -68,6 +69,36 @@ namespace Disruptor
         }
     }
 
+    void SequenceGroups::addSequences(AtomicSequenceArray& sequences, const ICursored& cursor, const std::vector< std::shared_ptr< ISequence > >& sequencesToAdd)
+    {
+        std::int64_t cursorSequence;
+        std::vector< std::shared_ptr< ISequence > > updatedSequences;
+        std::vector< std::shared_ptr< ISequence > > currentSequences;
+
+        do
+        {
+            currentSequences = sequences.sequences();
+
+            updatedSequences = currentSequences;
+            updatedSequences.insert(updatedSequences.end(), sequencesToAdd.begin(), sequencesToAdd.end());
+
+            cursorSequence = cursor.cursor();
+
+            for (auto&& sequence : sequencesToAdd)
+            {
+                sequence->setValue(cursorSequence);
+            }
+        }
+        while (!sequences.compareAndSet(currentSequences, updatedSequences));
+
+        cursorSequence = cursor.cursor();
+
+        for (auto&& sequence : sequencesToAdd)
+        {
+            sequence->setValue(cursorSequence);
+        }
+    }
+
     bool SequenceGroups::removeSequence(std::vector< std::shared_ptr< ISequence > >& sequences, const std::shared_ptr< ISequence >& sequence)
     {
         std::int32_t numToRemove = countMatching(sequences, sequence);
@@ -85,6 +116,37 @@ namespace Disruptor
             }
         }
 
+        sequences.resize(oldSize - numToRemove);
+
+        return numToRemove != 0;
+    }
+
+    bool SequenceGroups::removeSequence(AtomicSequenceArray& sequences, const std::shared_ptr< ISequence >& sequence)
+    {
+        std::int32_t numToRemove;
+        std::vector< std::shared_ptr< ISequence > > oldSequences;
+        std::vector< std::shared_ptr< ISequence > > newSequences;
+
+        do
+        {
+            oldSequences = sequences.sequences();
+
+            numToRemove = countMatching(oldSequences, sequence);
+
+            if (numToRemove == 0)
+                break;
+
+            newSequences.clear();
+            for (auto&& testSequence : oldSequences)
+            {
+                if (sequence != testSequence)
+                {
+                    newSequences.push_back(testSequence);
+                }
+            }
+        }
+        while (!sequences.compareAndSet(oldSequences, newSequences));
+
         return numToRemove != 0;
     }
 
@@ -6,6 +6,7 @@
 namespace Disruptor
 {
 
+    class AtomicSequenceArray;
     class ICursored;
     class ISequence;
 
@@ -23,8 +24,13 @@ namespace Disruptor
                                  const ICursored& cursor,
                                  const std::vector< std::shared_ptr< ISequence > >& sequencesToAdd);
 
+        static void addSequences(AtomicSequenceArray& sequences,
+                                 const ICursored& cursor,
+                                 const std::vector< std::shared_ptr< ISequence > >& sequencesToAdd);
+
         static bool removeSequence(std::shared_ptr< std::vector< std::shared_ptr< ISequence > > >& sequences, const std::shared_ptr< ISequence >& sequence);
         static bool removeSequence(std::vector< std::shared_ptr< ISequence > >& sequences, const std::shared_ptr< ISequence >& sequence);
+        static bool removeSequence(AtomicSequenceArray& sequences, const std::shared_ptr< ISequence >& sequence);
 
     private:
         static std::int32_t countMatching(const std::vector< std::shared_ptr< ISequence > >& values, const std::shared_ptr< ISequence >& toMatch);
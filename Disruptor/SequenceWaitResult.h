@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+
+
+namespace Disruptor
+{
+
+    enum class SequenceWaitStatus
+    {
+        /**
+         * The sequence holds the highest available sequence
+         */
+        Available,
+
+        /**
+         * The barrier has been alerted before the requested sequence became available
+         */
+        Alerted,
+
+        /**
+         * The wait strategy timed out before the requested sequence became available
+         */
+        TimedOut
+    };
+
+
+    /**
+     * Outcome of ISequenceBarrier::tryWaitFor(), which reports alerts and timeouts as a status instead of throwing an AlertException or a TimeoutException.
+     */
+    struct SequenceWaitResult
+    {
+        static SequenceWaitResult available(std::int64_t sequence)
+        {
+            return { SequenceWaitStatus::Available, sequence };
+        }
+
+        static SequenceWaitResult alerted()
+        {
+            return { SequenceWaitStatus::Alerted, -1 };
+        }
+
+        static SequenceWaitResult timedOut()
+        {
+            return { SequenceWaitStatus::TimedOut, -1 };
+        }
+
+        bool isAvailable() const
+        {
+            return status == SequenceWaitStatus::Available;
+        }
+
+        SequenceWaitStatus status;
+
+        /**
+         * The sequence up to which is available, only meaningful when status is SequenceWaitStatus::Available
+         */
+        std::int64_t sequence;
+    };
+
+} // namespace Disruptor
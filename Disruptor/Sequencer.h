@@ -5,11 +5,13 @@
 #include <vector>
 
 #include "Disruptor/ArgumentException.h"
+#include "Disruptor/AtomicSequenceArray.h"
 #include "Disruptor/ISequencer.h"
 #include "Disruptor/IWaitStrategy.h"
 #include "Disruptor/ProcessingSequenceBarrier.h"
 #include "Disruptor/Sequence.h"
 #include "Disruptor/SequenceGroups.h"
+#include "Disruptor/StaticDispatch.h"
 #include "Disruptor/EventPoller.h"
 #include "Disruptor/Util.h"
 
@@ -17,17 +19,26 @@
 namespace Disruptor
 {
 
-    template <class T>
-    class Sequencer : public ISequencer< T >, public std::enable_shared_from_this< Sequencer< T > >
+    /**
+     * Base class for the various sequencer types (single/multi).  Provides common functionality like the management of gating sequences (add/remove) and ownership of the current cursor.
+     *
+     * \tparam T event type
+     * \tparam TWaitStrategy type of the wait strategy. Defaults to IWaitStrategy; with a concrete strategy its calls are resolved at compile time and can be inlined,
+     * the strategy must then be exactly of that type (see StaticDispatch.h).
+     */
+    template <class T, class TWaitStrategy = IWaitStrategy>
+    class Sequencer : public ISequencer< T >, public std::enable_shared_from_this< Sequencer< T, TWaitStrategy > >
     {
     public:
+        typedef TWaitStrategy WaitStrategyType;
+
         /**
          * Construct a Sequencer with the selected strategies.
          * 
          * \param bufferSize 
          * \param waitStrategy waitStrategy for those waiting on sequences.
          */ 
-        Sequencer(std::int32_t bufferSize, const std::shared_ptr< IWaitStrategy >& waitStrategy)
+        Sequencer(std::int32_t bufferSize, const std::shared_ptr< TWaitStrategy >& waitStrategy)
             : m_bufferSize(bufferSize)
             , m_waitStrategy(waitStrategy)
             , m_cursor(std::make_shared< Sequence >())
@@ -43,6 +54,8 @@ namespace Disruptor
             {
                 DISRUPTOR_THROW_ARGUMENT_EXCEPTION("bufferSize must be a power of 2");
             }
+
+            requireExactType(m_waitStrategyRef);
         }
 
         /**
@@ -53,7 +66,7 @@ namespace Disruptor
          */ 
         std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack) override
         {
-            return std::make_shared< ProcessingSequenceBarrier >(this->shared_from_this(), m_waitStrategy, m_cursor, sequencesToTrack);
+            return std::make_shared< ProcessingSequenceBarrier< IHighestPublishedSequenceProvider, TWaitStrategy > >(this->shared_from_this(), m_waitStrategy, m_cursor, sequencesToTrack);
         }
 
         /**
@@ -69,7 +82,7 @@ namespace Disruptor
          */ 
         std::int64_t cursor() const override
         {
-            return m_cursorRef.value();
+            return m_cursorRef.Sequence::value();
         }
 
         /**
@@ -93,6 +106,16 @@ namespace Disruptor
             return SequenceGroups::removeSequence(m_gatingSequences, sequence);
         }
 
+        /**
+         * Track the gating sequences by groups with a cached minimum.
+         *
+         * \param groupSize number of gating sequences per group, 0 to read all the gating sequences
+         */
+        void setGatingSequenceGroupSize(std::int32_t groupSize) override
+        {
+            m_gatingSequences.setGroupSize(groupSize);
+        }
+
         /**
          * Get the minimum sequence value from all of the gating sequences added to this ringBuffer.
          * 
@@ -100,7 +123,7 @@ namespace Disruptor
          */ 
         std::int64_t getMinimumSequence() override
         {
-            return Util::getMinimumSequence(m_gatingSequences, m_cursorRef.value());
+            return m_gatingSequences.minimumSequence(m_cursorRef.Sequence::value());
         }
 
         /**
@@ -125,7 +148,7 @@ namespace Disruptor
             stream << " }, GatingSequences: [ ";
 
             auto firstItem = true;
-            for (auto&& sequence : m_gatingSequences)
+            for (auto&& sequence : m_gatingSequences.sequences())
             {
                 if (firstItem)
                     firstItem = false;
@@ -141,14 +164,14 @@ namespace Disruptor
 
     protected:
         /**
-         * Volatile in the Java version => always use Volatile.Read/Write or Interlocked methods to access this field.
+         * Replaced as a whole when gating sequences are added or removed, so producers can read it concurrently.
          */ 
-        std::vector< std::shared_ptr< ISequence > > m_gatingSequences;
+        AtomicSequenceArray m_gatingSequences;
 
         std::int32_t m_bufferSize;
-        std::shared_ptr< IWaitStrategy > m_waitStrategy;
+        std::shared_ptr< TWaitStrategy > m_waitStrategy;
         std::shared_ptr< Sequence > m_cursor;
-        IWaitStrategy& m_waitStrategyRef;
+        TWaitStrategy& m_waitStrategyRef;
         Sequence& m_cursorRef;
     };
 
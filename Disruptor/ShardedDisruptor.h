@@ -0,0 +1,257 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Disruptor/BasicExecutor.h"
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/ExceptionHandlerWrapper.h"
+#include "Disruptor/FunctionEventHandler.h"
+#include "Disruptor/IEventHandler.h"
+#include "Disruptor/IExceptionHandler.h"
+#include "Disruptor/IExecutor.h"
+#include "Disruptor/InvalidOperationException.h"
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/ShardedEventProcessor.h"
+#include "Disruptor/ShardedRingBuffer.h"
+#include "Disruptor/TimeoutException.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * A DSL-style API for setting up event handlers around a ShardedRingBuffer<T>, where each publisher thread publishes to its own single producer shard.
+     * The event handlers run in parallel, each one consuming every shard through a ShardedEventProcessor<T>.
+     * <code>
+     *      auto disruptor = std::make_shared< shardedDisruptor< MyEvent > >(MyEvent::eventFactory(), 3, 1024, taskScheduler);
+     *      disruptor->handleEventsWith(handler);
+     *      auto ringBuffer = disruptor->start();
+     *      auto& shard = *ringBuffer->shard(publisherIndex);
+     * </code>
+     *
+     * \tparam T the type of event used.
+     */
+    template <class T>
+    class shardedDisruptor
+    {
+    public:
+        /**
+         * Create a new sharded Disruptor. Will default to BlockingWaitStrategy.
+         *
+         * \param eventFactory the factory to create events in the shards
+         * \param shardCount the number of shards, usually the number of publisher threads
+         * \param shardBufferSize the size of each shard, must be power of 2
+         * \param taskScheduler a TaskScheduler to create threads to for processors
+         */
+        shardedDisruptor(const std::function< T() >& eventFactory, std::int32_t shardCount, std::int32_t shardBufferSize, const std::shared_ptr< ITaskScheduler >& taskScheduler)
+            : shardedDisruptor(eventFactory, shardCount, shardBufferSize, taskScheduler, std::make_shared< BlockingWaitStrategy >())
+        {
+        }
+
+        /**
+         * Create a new sharded Disruptor.
+         *
+         * \param eventFactory the factory to create events in the shards
+         * \param shardCount the number of shards, usually the number of publisher threads
+         * \param shardBufferSize the size of each shard, must be power of 2
+         * \param taskScheduler a TaskScheduler to create threads to for processors
+         * \param waitStrategy the wait strategy shared by the shards
+         */
+        shardedDisruptor(const std::function< T() >& eventFactory,
+                         std::int32_t shardCount,
+                         std::int32_t shardBufferSize,
+                         const std::shared_ptr< ITaskScheduler >& taskScheduler,
+                         const std::shared_ptr< IWaitStrategy >& waitStrategy)
+            : m_ringBuffer(ShardedRingBuffer< T >::create(eventFactory, shardCount, shardBufferSize, waitStrategy))
+            , m_executor(std::make_shared< BasicExecutor >(taskScheduler))
+        {
+        }
+
+        /**
+         * Allows the executor to be specified
+         *
+         * \param eventFactory the factory to create events in the shards
+         * \param shardCount the number of shards, usually the number of publisher threads
+         * \param shardBufferSize the size of each shard, must be power of 2
+         * \param executor the executor running the event processors
+         */
+        shardedDisruptor(const std::function< T() >& eventFactory, std::int32_t shardCount, std::int32_t shardBufferSize, const std::shared_ptr< IExecutor >& executor)
+            : m_ringBuffer(ShardedRingBuffer< T >::create(eventFactory, shardCount, shardBufferSize))
+            , m_executor(executor)
+        {
+        }
+
+        /**
+         * Set up an event handler consuming the events of all the shards. The handlers process events in parallel.
+         *
+         * \param handler the event handler that will process events
+         * \returns the ShardedEventProcessor<T> created for the handler
+         */
+        std::shared_ptr< ShardedEventProcessor< T > > handleEventsWith(const std::shared_ptr< IEventHandler< T > >& handler)
+        {
+            return createEventProcessor(handler);
+        }
+
+        /**
+         * Set up a callable consuming the events of all the shards. The callable is invoked as function(T& data, std::int64_t sequence, bool endOfBatch).
+         *
+         * \param function the callable that will process events
+         * \returns the ShardedEventProcessor<T> created for the callable
+         */
+        template <class TFunction, typename std::enable_if< IsEventHandlerFunction< T, TFunction >::value, int >::type = 0>
+        std::shared_ptr< ShardedEventProcessor< T, FunctionEventHandler< T, TFunction > > > handleEventsWith(const TFunction& function)
+        {
+            return createEventProcessor(std::make_shared< FunctionEventHandler< T, TFunction > >(function));
+        }
+
+        /**
+         * Specify an exception handler to be used for existing and future event handlers.
+         *
+         * \param exceptionHandler the exception handler to use
+         */
+        void setDefaultExceptionHandler(const std::shared_ptr< IExceptionHandler< T > >& exceptionHandler)
+        {
+            m_exceptionHandler->switchTo(exceptionHandler);
+        }
+
+        /**
+         * Starts the event processors and returns the fully configured sharded ring buffer. Each shard is set up to prevent overwriting any entry
+         * that is yet to be processed by the slowest event processor. This method must only be called once after all event processors have been added.
+         *
+         * \returns the configured sharded ring buffer
+         */
+        std::shared_ptr< ShardedRingBuffer< T > > start()
+        {
+            checkOnlyStartedOnce();
+
+            for (auto&& shardSequences : m_shardSequences)
+            {
+                m_ringBuffer->addGatingSequences(shardSequences);
+            }
+
+            for (auto&& processor : m_processors)
+            {
+                m_executor->execute([processor] { processor->run(); });
+            }
+
+            return m_ringBuffer;
+        }
+
+        /**
+         * Calls IEventProcessor::halt() on all of the event processors created via this disruptor.
+         */
+        void halt()
+        {
+            for (auto&& processor : m_processors)
+            {
+                processor->halt();
+            }
+        }
+
+        /**
+         * Waits until all events currently in the shards have been processed by all event processors and then halts the processors.
+         * It is critical that publishing has stopped before calling this method, otherwise it may never return.
+         */
+        void shutdown()
+        {
+            try
+            {
+                shutdown(ClockConfig::Duration::max());
+            }
+            catch (TimeoutException& ex)
+            {
+                m_exceptionHandler->handleOnShutdownException(ex);
+            }
+        }
+
+        /**
+         * Waits until all events currently in the shards have been processed by all event processors and then halts the processors.
+         *
+         * \param timeout the amount of time to wait for all events to be processed. ClockConfig::Duration::max() will give an infinite timeout
+         */
+        void shutdown(ClockConfig::Duration timeout)
+        {
+            const auto waitInfinitely = timeout == ClockConfig::Duration::max();
+
+            const auto timeoutAt = ClockConfig::Clock::now() + timeout;
+            while (hasBacklog())
+            {
+                if (!waitInfinitely && timeout.count() >= 0 && ClockConfig::Clock::now() > timeoutAt)
+                    DISRUPTOR_THROW_TIMEOUT_EXCEPTION();
+
+                std::this_thread::yield();
+            }
+            halt();
+        }
+
+        /**
+         * The ShardedRingBuffer<T> used by this Disruptor.
+         */
+        std::shared_ptr< ShardedRingBuffer< T > > ringBuffer() const
+        {
+            return m_ringBuffer;
+        }
+
+    private:
+        template <class TEventHandler>
+        std::shared_ptr< ShardedEventProcessor< T, TEventHandler > > createEventProcessor(const std::shared_ptr< TEventHandler >& eventHandler)
+        {
+            checkNotStarted();
+
+            auto processor = std::make_shared< ShardedEventProcessor< T, TEventHandler > >(m_ringBuffer, eventHandler);
+            processor->setExceptionHandler(m_exceptionHandler);
+
+            m_processors.push_back(processor);
+            m_shardSequences.push_back(processor->shardSequences());
+
+            return processor;
+        }
+
+        // Confirms if all messages have been consumed by all event processors
+        bool hasBacklog() const
+        {
+            auto&& shards = m_ringBuffer->shards();
+            for (auto&& shardSequences : m_shardSequences)
+            {
+                for (auto i = 0u; i < shards.size(); ++i)
+                {
+                    if (shards[i]->cursor() > shardSequences[i]->value())
+                        return true;
+                }
+            }
+            return false;
+        }
+
+        void checkNotStarted() const
+        {
+            if (m_started == 1)
+            {
+                DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("All event handlers must be added before calling starts.");
+            }
+        }
+
+        void checkOnlyStartedOnce()
+        {
+            if (std::atomic_exchange(&m_started, 1) != 0)
+            {
+                DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Disruptor.start() must only be called once.");
+            }
+        }
+
+        std::shared_ptr< ShardedRingBuffer< T > > m_ringBuffer;
+        std::shared_ptr< IExecutor > m_executor;
+        std::vector< std::shared_ptr< IEventProcessor > > m_processors;
+        std::vector< std::vector< std::shared_ptr< ISequence > > > m_shardSequences;
+        std::shared_ptr< ExceptionHandlerWrapper< T > > m_exceptionHandler = std::make_shared< ExceptionHandlerWrapper< T > >();
+        std::atomic< int > m_started {0};
+    };
+
+} // namespace Disruptor
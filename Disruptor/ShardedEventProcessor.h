@@ -0,0 +1,259 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Disruptor/ArgumentNullException.h"
+#include "Disruptor/FatalExceptionHandler.h"
+#include "Disruptor/IEventHandler.h"
+#include "Disruptor/IEventProcessor.h"
+#include "Disruptor/IExceptionHandler.h"
+#include "Disruptor/ILifecycleAware.h"
+#include "Disruptor/InvalidOperationException.h"
+#include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/Sequence.h"
+#include "Disruptor/SequenceWaitResult.h"
+#include "Disruptor/ShardedRingBuffer.h"
+#include "Disruptor/WaitQueue.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Event processor consuming the shards of a ShardedRingBuffer<T> in round-robin: each pass delivers the events available in every shard,
+     * one shard batch after the other. Events of a shard are delivered in order, there is no ordering between shards.
+     *
+     * The handler receives a merged sequence, counting the events delivered across all the shards, which is also the value of sequence().
+     * The shards must be gated on shardSequences(). When no shard has events available the processor yields a bounded number of times, then parks
+     * on the publication queue of the ring buffer until an event is published to any shard, or until it is halted.
+     *
+     * \tparam T Event implementation storing the data for sharing during exchange or parallel coordination of an event.
+     * \tparam TEventHandler type of the event handler, must derive from IEventHandler<T>
+     */
+    template <class T, class TEventHandler = IEventHandler< T >>
+    class ShardedEventProcessor : public IEventProcessor
+    {
+        static const std::int32_t yieldsBeforeParking = 100;
+
+    public:
+        /**
+         * \param ringBuffer sharded ring buffer to which events are published
+         * \param eventHandler eventHandler is the delegate to which events are dispatched.
+         */
+        ShardedEventProcessor(const std::shared_ptr< ShardedRingBuffer< T > >& ringBuffer, const std::shared_ptr< TEventHandler >& eventHandler)
+            : m_running(false)
+            , m_ringBuffer(ringBuffer)
+            , m_barriers(ringBuffer->newBarriers())
+            , m_eventHandler(eventHandler)
+            , m_eventHandlerRef(*m_eventHandler)
+            , m_sequence(std::make_shared< Sequence >())
+            , m_sequenceRef(*m_sequence)
+        {
+            m_shardSequences.reserve(m_barriers.size());
+            for (auto i = 0u; i < m_barriers.size(); ++i)
+            {
+                m_shardSequences.push_back(std::make_shared< Sequence >());
+            }
+        }
+
+        /**
+         * The merged sequence of the last event delivered to the handler
+         */
+        std::shared_ptr< ISequence > sequence() const override
+        {
+            return m_sequence;
+        }
+
+        /**
+         * The sequences of the last event consumed in each shard, in shard order
+         */
+        const std::vector< std::shared_ptr< ISequence > >& shardSequences() const
+        {
+            return m_shardSequences;
+        }
+
+        void halt() override
+        {
+            m_running = false;
+            for (auto&& barrier : m_barriers)
+            {
+                barrier->alert();
+            }
+        }
+
+        bool isRunning() const override
+        {
+            return m_running;
+        }
+
+        /**
+         * Set a new IExceptionHandler<T> for handling exceptions propagated out of the ShardedEventProcessor<T>
+         *
+         * \param exceptionHandler exceptionHandler to replace the existing exceptionHandler.
+         */
+        void setExceptionHandler(const std::shared_ptr< IExceptionHandler< T > >& exceptionHandler)
+        {
+            if (exceptionHandler == nullptr)
+                DISRUPTOR_THROW_ARGUMENT_NULL_EXCEPTION(exceptionHandler);
+
+            m_exceptionHandler = exceptionHandler;
+        }
+
+        /**
+         * It is ok to have another thread rerun this method after a halt().
+         */
+        void run() override
+        {
+            if (m_running.exchange(true) != false)
+            {
+                DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Thread is already running");
+            }
+
+            for (auto&& barrier : m_barriers)
+            {
+                barrier->clearAlert();
+            }
+
+            notifyStart();
+
+            m_mergedSequence = m_sequenceRef.value();
+
+            auto idlePasses = 0;
+            while (true)
+            {
+                auto processed = false;
+                for (auto i = 0u; i < m_barriers.size(); ++i)
+                {
+                    processed |= processShard(i);
+                }
+
+                if (processed)
+                {
+                    idlePasses = 0;
+                    continue;
+                }
+
+                // All the barriers are alerted together
+                if (m_barriers[0]->isAlerted())
+                {
+                    if (m_running == false)
+                        break;
+                }
+
+                if (++idlePasses <= yieldsBeforeParking)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // An alert ends the park, the loop then checks whether the processor is halted
+                m_ringBuffer->publicationQueue().tryWaitUntil([this] { return hasAvailableEvents(); }, *m_barriers[0]);
+            }
+
+            notifyShutdown();
+            m_running = false;
+        }
+
+    private:
+        static_assert(std::is_base_of< IEventHandler< T >, TEventHandler >::value, "TEventHandler must derive from IEventHandler<T>");
+
+        bool hasAvailableEvents() const
+        {
+            for (auto i = 0u; i < m_barriers.size(); ++i)
+            {
+                if (m_barriers[i]->cursor() > m_shardSequences[i]->value())
+                    return true;
+            }
+            return false;
+        }
+
+        bool processShard(std::size_t index)
+        {
+            auto& barrier = *m_barriers[index];
+            auto& shardSequence = *m_shardSequences[index];
+
+            auto nextSequence = shardSequence.value() + 1;
+
+            // Only wait on a shard which has been claimed up to nextSequence, waitFor() then returns without blocking
+            if (barrier.cursor() < nextSequence)
+                return false;
+
+            // Alerts are checked by run() once no shard has events available, timeouts are ignored
+            auto result = barrier.tryWaitFor(nextSequence);
+            if (!result.isAvailable() || result.sequence < nextSequence)
+                return false;
+
+            auto availableSequence = result.sequence;
+
+            auto& shard = *m_ringBuffer->shards()[index];
+
+            for (; nextSequence <= availableSequence; ++nextSequence)
+            {
+                auto& evt = shard[nextSequence];
+                ++m_mergedSequence;
+
+                try
+                {
+                    m_eventHandlerRef.onEvent(evt, m_mergedSequence, nextSequence == availableSequence);
+                }
+                catch (const std::exception& ex)
+                {
+                    m_exceptionHandler->handleEventException(ex, m_mergedSequence, evt);
+                }
+            }
+
+            m_sequenceRef.setValue(m_mergedSequence);
+            shardSequence.setValue(availableSequence);
+            return true;
+        }
+
+        void notifyStart()
+        {
+            auto lifecycleAware = std::dynamic_pointer_cast< ILifecycleAware >(m_eventHandler);
+            if (lifecycleAware != nullptr)
+            {
+                try
+                {
+                    lifecycleAware->onStart();
+                }
+                catch (std::exception& ex)
+                {
+                    m_exceptionHandler->handleOnStartException(ex);
+                }
+            }
+        }
+
+        void notifyShutdown()
+        {
+            auto lifecycleAware = std::dynamic_pointer_cast< ILifecycleAware >(m_eventHandler);
+            if (lifecycleAware != nullptr)
+            {
+                try
+                {
+                    lifecycleAware->onShutdown();
+                }
+                catch (std::exception& ex)
+                {
+                    m_exceptionHandler->handleOnShutdownException(ex);
+                }
+            }
+        }
+
+        std::atomic< bool > m_running;
+        std::shared_ptr< ShardedRingBuffer< T > > m_ringBuffer;
+        std::vector< std::shared_ptr< ISequenceBarrier > > m_barriers;
+        std::vector< std::shared_ptr< ISequence > > m_shardSequences;
+        std::shared_ptr< TEventHandler > m_eventHandler;
+        TEventHandler& m_eventHandlerRef;
+        std::shared_ptr< Sequence > m_sequence;
+        Sequence& m_sequenceRef;
+        std::int64_t m_mergedSequence = Sequence::InitialCursorValue;
+        std::shared_ptr< IExceptionHandler< T > > m_exceptionHandler = std::make_shared< FatalExceptionHandler< T > >();
+    };
+
+} // namespace Disruptor
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/ArgumentOutOfRangeException.h"
+#include "Disruptor/BlockingWaitStrategy.h"
+#include "Disruptor/ISequence.h"
+#include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/RingBuffer.h"
+#include "Disruptor/ShardedWaitStrategy.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Set of single producer RingBuffer<T> shards, one per publisher thread, read through a merged view by ShardedEventProcessor<T>.
+     * Each publisher claims and publishes on its own shard, so publishers never contend on a shared cursor.
+     *
+     * \tparam T implementation storing the data for sharing during exchange or parallel coordination of an event.
+     */
+    template <class T>
+    class ShardedRingBuffer
+    {
+    public:
+        /**
+         * Construct a ShardedRingBuffer with the full option set.
+         *
+         * \param eventFactory to newInstance entries for filling the shards
+         * \param shardCount number of shards, usually the number of publisher threads
+         * \param shardBufferSize size of each shard, must be power of 2
+         * \param waitStrategy wait strategy shared by the shards
+         */
+        ShardedRingBuffer(const std::function< T() >& eventFactory,
+                          std::int32_t shardCount,
+                          std::int32_t shardBufferSize,
+                          const std::shared_ptr< IWaitStrategy >& waitStrategy)
+        {
+            if (shardCount < 1)
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("shardCount must not be less than 1");
+
+            m_waitStrategy = std::make_shared< ShardedWaitStrategy >(waitStrategy);
+
+            m_shards.reserve(shardCount);
+            for (auto i = 0; i < shardCount; ++i)
+            {
+                m_shards.push_back(RingBuffer< T >::createSingleProducer(eventFactory, shardBufferSize, m_waitStrategy));
+            }
+        }
+
+        /**
+         * Create a new ShardedRingBuffer using a BlockingWaitStrategy.
+         *
+         * \param eventFactory to newInstance entries for filling the shards
+         * \param shardCount number of shards, usually the number of publisher threads
+         * \param shardBufferSize size of each shard, must be power of 2
+         */
+        static std::shared_ptr< ShardedRingBuffer< T > > create(const std::function< T() >& eventFactory, std::int32_t shardCount, std::int32_t shardBufferSize)
+        {
+            return create(eventFactory, shardCount, shardBufferSize, std::make_shared< BlockingWaitStrategy >());
+        }
+
+        /**
+         * Create a new ShardedRingBuffer.
+         *
+         * \param eventFactory to newInstance entries for filling the shards
+         * \param shardCount number of shards, usually the number of publisher threads
+         * \param shardBufferSize size of each shard, must be power of 2
+         * \param waitStrategy wait strategy shared by the shards
+         */
+        static std::shared_ptr< ShardedRingBuffer< T > > create(const std::function< T() >& eventFactory,
+                                                                std::int32_t shardCount,
+                                                                std::int32_t shardBufferSize,
+                                                                const std::shared_ptr< IWaitStrategy >& waitStrategy)
+        {
+            return std::make_shared< ShardedRingBuffer< T > >(eventFactory, shardCount, shardBufferSize, waitStrategy);
+        }
+
+        /**
+         * Get the shard owned by a publisher. A shard must only be published to by a single thread.
+         *
+         * \param index index of the shard, between 0 and shardCount() - 1
+         */
+        const std::shared_ptr< RingBuffer< T > >& shard(std::int32_t index) const
+        {
+            if (index < 0 || index >= shardCount())
+                DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(index);
+
+            return m_shards[index];
+        }
+
+        const std::vector< std::shared_ptr< RingBuffer< T > > >& shards() const
+        {
+            return m_shards;
+        }
+
+        std::int32_t shardCount() const
+        {
+            return static_cast< std::int32_t >(m_shards.size());
+        }
+
+        /**
+         * The capacity of each shard.
+         */
+        std::int32_t shardBufferSize() const
+        {
+            return m_shards[0]->bufferSize();
+        }
+
+        /**
+         * Add gating sequences to the shards, one per shard, in shard order.
+         *
+         * \param shardSequences the sequences to add, as returned by ShardedEventProcessor<T>::shardSequences()
+         */
+        void addGatingSequences(const std::vector< std::shared_ptr< ISequence > >& shardSequences)
+        {
+            checkShardSequences(shardSequences);
+
+            for (auto i = 0u; i < m_shards.size(); ++i)
+            {
+                m_shards[i]->addGatingSequences({ shardSequences[i] });
+            }
+        }
+
+        /**
+         * Remove gating sequences previously added with addGatingSequences().
+         *
+         * \param shardSequences the sequences to remove, one per shard, in shard order
+         * \returns true if all the sequences were found, false otherwise.
+         */
+        bool removeGatingSequences(const std::vector< std::shared_ptr< ISequence > >& shardSequences)
+        {
+            checkShardSequences(shardSequences);
+
+            auto removed = true;
+            for (auto i = 0u; i < m_shards.size(); ++i)
+            {
+                removed &= m_shards[i]->removeGatingSequence(shardSequences[i]);
+            }
+            return removed;
+        }
+
+        /**
+         * Create a barrier per shard, in shard order.
+         */
+        std::vector< std::shared_ptr< ISequenceBarrier > > newBarriers()
+        {
+            std::vector< std::shared_ptr< ISequenceBarrier > > barriers;
+            barriers.reserve(m_shards.size());
+
+            for (auto&& shard : m_shards)
+            {
+                barriers.push_back(shard->newBarrier());
+            }
+            return barriers;
+        }
+
+        /**
+         * Queue on which a ShardedEventProcessor<T> parks while no shard has events, woken after each publication to any shard.
+         */
+        WaitQueue& publicationQueue() const
+        {
+            return m_waitStrategy->publicationQueue();
+        }
+
+    private:
+        void checkShardSequences(const std::vector< std::shared_ptr< ISequence > >& shardSequences) const
+        {
+            if (shardSequences.size() != m_shards.size())
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("Should have as many sequences as shards (" << shardSequences.size() << " != " << m_shards.size() << ")");
+        }
+
+        std::shared_ptr< ShardedWaitStrategy > m_waitStrategy;
+        std::vector< std::shared_ptr< RingBuffer< T > > > m_shards;
+    };
+
+} // namespace Disruptor
@@ -0,0 +1,76 @@
+#include "stdafx.h"
+#include "ShardedWaitStrategy.h"
+
+#include <ostream>
+
+#include "ArgumentNullException.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    IWaitStrategy& requireWaitStrategy(const std::shared_ptr< IWaitStrategy >& waitStrategy)
+    {
+        if (waitStrategy == nullptr)
+            DISRUPTOR_THROW_ARGUMENT_NULL_EXCEPTION(waitStrategy);
+
+        return *waitStrategy;
+    }
+
+} // namespace
+
+
+    ShardedWaitStrategy::ShardedWaitStrategy(const std::shared_ptr< IWaitStrategy >& waitStrategy)
+        : m_waitStrategy(waitStrategy)
+        , m_waitStrategyRef(requireWaitStrategy(waitStrategy))
+    {
+    }
+
+    std::int64_t ShardedWaitStrategy::waitFor(std::int64_t sequence,
+                                              Sequence& cursor,
+                                              ISequence& dependentSequence,
+                                              ISequenceBarrier& barrier)
+    {
+        return m_waitStrategyRef.waitFor(sequence, cursor, dependentSequence, barrier);
+    }
+
+    SequenceWaitResult ShardedWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                       Sequence& cursor,
+                                                       ISequence& dependentSequence,
+                                                       ISequenceBarrier& barrier)
+    {
+        return m_waitStrategyRef.tryWaitFor(sequence, cursor, dependentSequence, barrier);
+    }
+
+    void ShardedWaitStrategy::signalAllWhenBlocking()
+    {
+        m_waitStrategyRef.signalAllWhenBlocking();
+        m_publicationQueue.wakeAll();
+    }
+
+    void ShardedWaitStrategy::signalAllWhenAlerted()
+    {
+        m_waitStrategyRef.signalAllWhenAlerted();
+        m_publicationQueue.wakeAll();
+    }
+
+    WaitQueue* ShardedWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return m_waitStrategyRef.registerDependentSequence(sequence);
+    }
+
+    void ShardedWaitStrategy::writeDescriptionTo(std::ostream& stream) const
+    {
+        stream << "ShardedWaitStrategy { WaitStrategy: ";
+        m_waitStrategyRef.writeDescriptionTo(stream);
+        stream << " }";
+    }
+
+    WaitQueue& ShardedWaitStrategy::publicationQueue()
+    {
+        return m_publicationQueue;
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaitQueue.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Wait strategy shared by the shards of a ShardedRingBuffer<T>. It delegates to the wait strategy chosen for the shards, and also wakes the
+     * ShardedEventProcessor<T> parked on publicationQueue() until any shard has events, which no single shard barrier can wait for.
+     *
+     * Each publication then costs a fence and an atomic load on top of the delegate, see WaitQueue::wakeAll().
+     */
+    class ShardedWaitStrategy : public IWaitStrategy
+    {
+    public:
+        /**
+         * \param waitStrategy wait strategy of the shards
+         */
+        explicit ShardedWaitStrategy(const std::shared_ptr< IWaitStrategy >& waitStrategy);
+
+        /**
+         * \see IWaitStrategy::waitFor
+         */
+        std::int64_t waitFor(std::int64_t sequence,
+                             Sequence& cursor,
+                             ISequence& dependentSequence,
+                             ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenBlocking
+         */
+        void signalAllWhenBlocking() override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
+        void writeDescriptionTo(std::ostream& stream) const override;
+
+        /**
+         * Queue woken after each publication to a shard, and when a shard barrier is alerted
+         */
+        WaitQueue& publicationQueue();
+
+    private:
+        std::shared_ptr< IWaitStrategy > m_waitStrategy;
+        IWaitStrategy& m_waitStrategyRef;
+        WaitQueue m_publicationQueue;
+    };
+
+} // namespace Disruptor
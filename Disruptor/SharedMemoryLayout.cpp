@@ -0,0 +1,317 @@
+#include "stdafx.h"
+#include "SharedMemoryLayout.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <algorithm>
+#include <new>
+
+#include "ArgumentException.h"
+#include "ArgumentOutOfRangeException.h"
+#include "InvalidOperationException.h"
+#include "Sequence.h"
+#include "SpinWait.h"
+#include "Util.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "The atomics of the shared memory must be lock-free to be shared between processes");
+    static_assert(sizeof(SharedMemoryLayout::ControlBlock) == 384, "The fields of the control block should be on separate cache lines");
+    static_assert(sizeof(SharedMemoryLayout::ConsumerSlot) == 128, "The consumer slots should be on separate cache lines");
+
+    const std::size_t maxEntryAlignment = 4096;
+
+    std::size_t alignUp(std::size_t offset, std::size_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    struct Offsets
+    {
+        std::size_t availableBuffer;
+        std::size_t entries;
+        std::size_t size;
+    };
+
+    Offsets computeOffsets(ProducerType producerType, std::int32_t bufferSize, std::int32_t maxConsumers, std::size_t entrySize, std::size_t entryAlignment)
+    {
+        Offsets offsets;
+
+        auto offset = sizeof(SharedMemoryLayout::ControlBlock) + static_cast< std::size_t >(maxConsumers) * sizeof(SharedMemoryLayout::ConsumerSlot);
+
+        offsets.availableBuffer = 0;
+        if (producerType == ProducerType::Multi)
+        {
+            offsets.availableBuffer = offset;
+            offset = alignUp(offset + static_cast< std::size_t >(bufferSize) * sizeof(std::atomic< std::int32_t >), 128);
+        }
+
+        offsets.entries = alignUp(offset, std::max< std::size_t >(entryAlignment, 128));
+        offsets.size = offsets.entries + static_cast< std::size_t >(bufferSize) * entrySize;
+
+        return offsets;
+    }
+
+    SharedMemoryLayout::ControlBlock& controlBlockOf(const SharedMemoryRegion& region)
+    {
+        return *static_cast< SharedMemoryLayout::ControlBlock* >(region.address());
+    }
+
+    bool holdsRingBuffer(const SharedMemoryRegion& region)
+    {
+        return region.size() >= sizeof(SharedMemoryLayout::ControlBlock) && controlBlockOf(region).magic == SharedMemoryLayout::magicNumber;
+    }
+
+} // namespace
+
+
+    SharedMemoryLayout::SharedMemoryLayout(std::unique_ptr< SharedMemoryRegion > region, bool isProducer)
+        : m_region(std::move(region))
+        , m_isProducer(isProducer)
+        , m_controlBlock(controlBlockOf(*m_region))
+        , m_consumerSlots(reinterpret_cast< ConsumerSlot* >(static_cast< char* >(m_region->address()) + sizeof(ControlBlock)))
+        , m_maxConsumers(m_controlBlock.maxConsumers)
+    {
+    }
+
+    SharedMemoryLayout::~SharedMemoryLayout()
+    {
+        if (!m_isProducer)
+            return;
+
+        // The consumers observe that the producer is gone, the object is destroyed once they detach
+        m_controlBlock.producerProcessId.store(0, std::memory_order_release);
+        m_controlBlock.state.store(static_cast< std::int32_t >(State::Closed), std::memory_order_release);
+        m_controlBlock.futexWord.fetch_add(1);
+        Futex::wakeAllShared(m_controlBlock.futexWord);
+
+        SharedMemoryRegion::unlink(m_region->name());
+    }
+
+    std::shared_ptr< SharedMemoryLayout > SharedMemoryLayout::create(const std::string& name,
+                                                                     ProducerType producerType,
+                                                                     std::int32_t bufferSize,
+                                                                     std::int32_t maxConsumers,
+                                                                     std::size_t entrySize,
+                                                                     std::size_t entryAlignment)
+    {
+        if (producerType != ProducerType::Single && producerType != ProducerType::Multi)
+            DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(producerType);
+
+        if (bufferSize < 1 || !Util::isPowerOf2(bufferSize))
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("bufferSize must be a power of 2");
+
+        if (maxConsumers < 1)
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("maxConsumers must not be less than 1");
+
+        if (entryAlignment > maxEntryAlignment)
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("entryAlignment must not be greater than " << maxEntryAlignment);
+
+        auto existing = SharedMemoryRegion::open(name);
+        if (existing != nullptr)
+        {
+            // Only the region left behind by a crashed producer is replaced
+            if (!holdsRingBuffer(*existing))
+                DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The shared memory object " << name << " does not hold a ring buffer");
+
+            auto producerProcessId = controlBlockOf(*existing).producerProcessId.load();
+            if (SharedMemoryRegion::isProcessAlive(producerProcessId))
+                DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The ring buffer " << name << " is used by the running process " << producerProcessId);
+
+            existing.reset();
+            SharedMemoryRegion::unlink(name);
+        }
+
+        auto offsets = computeOffsets(producerType, bufferSize, maxConsumers, entrySize, entryAlignment);
+        auto region = SharedMemoryRegion::create(name, offsets.size);
+
+        auto& controlBlock = *new (region->address()) ControlBlock();
+        controlBlock.magic = magicNumber;
+        controlBlock.version = layoutVersion;
+        controlBlock.producerType = static_cast< std::int32_t >(producerType);
+        controlBlock.bufferSize = bufferSize;
+        controlBlock.maxConsumers = maxConsumers;
+        controlBlock.entrySize = static_cast< std::uint32_t >(entrySize);
+        controlBlock.entryAlignment = static_cast< std::uint32_t >(entryAlignment);
+        controlBlock.availableBufferOffset = offsets.availableBuffer;
+        controlBlock.entriesOffset = offsets.entries;
+        controlBlock.cursor.store(Sequence::InitialCursorValue, std::memory_order_relaxed);
+        controlBlock.producerProcessId.store(SharedMemoryRegion::currentProcessId(), std::memory_order_relaxed);
+
+        auto address = static_cast< char* >(region->address());
+        for (std::int32_t i = 0; i < maxConsumers; ++i)
+            new (address + sizeof(ControlBlock) + i * sizeof(ConsumerSlot)) ConsumerSlot();
+
+        if (producerType == ProducerType::Multi)
+        {
+            auto availableBuffer = reinterpret_cast< std::atomic< std::int32_t >* >(address + offsets.availableBuffer);
+            for (std::int32_t i = 0; i < bufferSize; ++i)
+                new (&availableBuffer[i]) std::atomic< std::int32_t >(-1);
+        }
+
+        // The entries are initialized by the ring buffer before it is published to the consumers with markReady()
+        return std::shared_ptr< SharedMemoryLayout >(new SharedMemoryLayout(std::move(region), true));
+    }
+
+    std::shared_ptr< SharedMemoryLayout > SharedMemoryLayout::attach(const std::string& name,
+                                                                    std::size_t entrySize,
+                                                                    std::size_t entryAlignment,
+                                                                    std::chrono::milliseconds initializationTimeout)
+    {
+        auto region = SharedMemoryRegion::open(name);
+        if (region == nullptr)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("There is no ring buffer named " << name);
+
+        if (!holdsRingBuffer(*region))
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The shared memory object " << name << " does not hold a ring buffer");
+
+        auto& controlBlock = controlBlockOf(*region);
+
+        // The region may be attached while the producer is initializing it
+        auto deadline = std::chrono::steady_clock::now() + initializationTimeout;
+        SpinWait spinWait;
+        while (controlBlock.state.load(std::memory_order_acquire) == static_cast< std::int32_t >(State::Initializing))
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+                DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The ring buffer " << name << " is not initialized");
+
+            spinWait.spinOnce();
+        }
+
+        if (controlBlock.version != layoutVersion)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The ring buffer " << name << " has the layout version " << controlBlock.version << ", expected " << layoutVersion);
+
+        if (controlBlock.entrySize != entrySize || controlBlock.entryAlignment != entryAlignment)
+        {
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The entries of the ring buffer " << name << " have a size of " << controlBlock.entrySize << " and an alignment of " << controlBlock.entryAlignment
+                                                        << ", expected " << entrySize << " and " << entryAlignment);
+        }
+
+        auto offsets = computeOffsets(static_cast< ProducerType >(controlBlock.producerType), controlBlock.bufferSize, controlBlock.maxConsumers, entrySize, entryAlignment);
+        if (region->size() < offsets.size || controlBlock.entriesOffset != offsets.entries || controlBlock.availableBufferOffset != offsets.availableBuffer)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The layout of the ring buffer " << name << " is corrupted");
+
+        return std::shared_ptr< SharedMemoryLayout >(new SharedMemoryLayout(std::move(region), false));
+    }
+
+    void SharedMemoryLayout::markReady()
+    {
+        m_controlBlock.state.store(static_cast< std::int32_t >(State::Ready), std::memory_order_release);
+    }
+
+    bool SharedMemoryLayout::isProducer() const
+    {
+        return m_isProducer;
+    }
+
+    ProducerType SharedMemoryLayout::producerType() const
+    {
+        return static_cast< ProducerType >(m_controlBlock.producerType);
+    }
+
+    std::int32_t SharedMemoryLayout::bufferSize() const
+    {
+        return m_controlBlock.bufferSize;
+    }
+
+    std::int32_t SharedMemoryLayout::maxConsumers() const
+    {
+        return m_maxConsumers;
+    }
+
+    std::atomic< std::int32_t >* SharedMemoryLayout::availableBuffer() const
+    {
+        if (m_controlBlock.availableBufferOffset == 0)
+            return nullptr;
+
+        return reinterpret_cast< std::atomic< std::int32_t >* >(static_cast< char* >(m_region->address()) + m_controlBlock.availableBufferOffset);
+    }
+
+    void* SharedMemoryLayout::entries() const
+    {
+        return static_cast< char* >(m_region->address()) + m_controlBlock.entriesOffset;
+    }
+
+    bool SharedMemoryLayout::isProducerAlive() const
+    {
+        return m_controlBlock.state.load(std::memory_order_acquire) == static_cast< std::int32_t >(State::Ready)
+            && SharedMemoryRegion::isProcessAlive(m_controlBlock.producerProcessId.load(std::memory_order_acquire));
+    }
+
+    std::int32_t SharedMemoryLayout::acquireConsumerSlot()
+    {
+        auto processId = SharedMemoryRegion::currentProcessId();
+
+        for (std::int32_t i = 0; i < m_maxConsumers; ++i)
+        {
+            auto& slot = m_consumerSlots[i];
+
+            // The slot is reserved before its sequence is written, the producer ignores it meanwhile
+            std::int32_t expected = 0;
+            if (!slot.processId.compare_exchange_strong(expected, -processId))
+                continue;
+
+            slot.sequence.store(m_controlBlock.cursor.load(std::memory_order_acquire), std::memory_order_release);
+            slot.processId.store(processId, std::memory_order_release);
+
+            // The producer may have claimed sequences before observing the slot, the consumer starts after them
+            slot.sequence.store(m_controlBlock.cursor.load(std::memory_order_acquire), std::memory_order_release);
+
+            return i;
+        }
+
+        DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("All the " << m_maxConsumers << " consumer slots of the ring buffer " << m_region->name() << " are used");
+    }
+
+    void SharedMemoryLayout::releaseConsumerSlot(std::int32_t slot)
+    {
+        // The slot may already have been released by releaseDeadConsumers() and acquired by another process
+        auto processId = SharedMemoryRegion::currentProcessId();
+        consumerSlot(slot).processId.compare_exchange_strong(processId, 0);
+    }
+
+    SharedMemoryLayout::ConsumerSlot& SharedMemoryLayout::consumerSlot(std::int32_t slot) const
+    {
+        if (slot < 0 || slot >= m_maxConsumers)
+            DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(slot);
+
+        return m_consumerSlots[slot];
+    }
+
+    std::int32_t SharedMemoryLayout::consumerCount() const
+    {
+        std::int32_t count = 0;
+        for (std::int32_t i = 0; i < m_maxConsumers; ++i)
+        {
+            if (m_consumerSlots[i].processId.load(std::memory_order_acquire) > 0)
+                ++count;
+        }
+
+        return count;
+    }
+
+    std::int32_t SharedMemoryLayout::releaseDeadConsumers()
+    {
+        std::int32_t count = 0;
+        for (std::int32_t i = 0; i < m_maxConsumers; ++i)
+        {
+            auto& slot = m_consumerSlots[i];
+
+            auto processId = slot.processId.load(std::memory_order_acquire);
+            if (processId == 0 || SharedMemoryRegion::isProcessAlive(processId < 0 ? -processId : processId))
+                continue;
+
+            if (slot.processId.compare_exchange_strong(processId, 0))
+                ++count;
+        }
+
+        return count;
+    }
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Disruptor/Futex.h"
+#include "Disruptor/ProducerType.h"
+#include "Disruptor/SharedMemoryRegion.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Layout of the SharedMemoryRegion of a SharedMemoryRingBuffer<T>:
+     *
+     * - a control block: a versioned header describing the layout, the cursor and the futex word the consumers park on,
+     * - the consumer slots, each holding the process and the sequence of a consumer, on which the producer gates,
+     * - the availability buffer of the multi producer rings,
+     * - the entries.
+     *
+     * The region is created by the producer process, the consumer processes attach to it. The pages are only written through atomics and
+     * trivially copyable entries, so that no pointer and no virtual table is shared between the processes.
+     */
+    class SharedMemoryLayout
+    {
+    public:
+        static const std::uint64_t magicNumber = 0x314d485350525344; // "DSRPSHM1"
+        static const std::uint32_t layoutVersion = 1;
+
+        enum class State : std::int32_t
+        {
+            Initializing,
+            Ready,
+            Closed
+        };
+
+        struct ControlBlock
+        {
+            // Written by the producer before the state becomes Ready
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::int32_t producerType;
+            std::int32_t bufferSize;
+            std::int32_t maxConsumers;
+            std::uint32_t entrySize;
+            std::uint32_t entryAlignment;
+            std::uint64_t availableBufferOffset;
+            std::uint64_t entriesOffset;
+            std::atomic< std::int32_t > state;
+            std::atomic< std::int32_t > producerProcessId;
+            char padding0[72];
+
+            std::atomic< std::int64_t > cursor;
+            char padding1[120];
+
+            // Advanced by the producer when consumers are parked
+            std::atomic< std::int32_t > futexWord;
+            std::atomic< std::int32_t > waiters;
+            char padding2[120];
+        };
+
+        struct ConsumerSlot
+        {
+            // 0 when the slot is free, negative while being acquired
+            std::atomic< std::int32_t > processId;
+            std::int32_t padding0;
+            std::atomic< std::int64_t > sequence;
+            char padding1[112];
+        };
+
+        ~SharedMemoryLayout();
+
+        SharedMemoryLayout(const SharedMemoryLayout&) = delete;
+        SharedMemoryLayout& operator=(const SharedMemoryLayout&) = delete;
+
+        /**
+         * Create the region of a ring buffer, owned by the calling process as its producer. The region of a previous producer which is no longer running is replaced.
+         *
+         * \param name name of the shared memory object
+         * \param producerType Single, or Multi for several producer threads in the calling process
+         * \param bufferSize number of entries, must be a power of 2
+         * \param maxConsumers number of consumer slots
+         * \param entrySize size of an entry
+         * \param entryAlignment alignment of an entry, at most 4096
+         */
+        static std::shared_ptr< SharedMemoryLayout > create(const std::string& name,
+                                                            ProducerType producerType,
+                                                            std::int32_t bufferSize,
+                                                            std::int32_t maxConsumers,
+                                                            std::size_t entrySize,
+                                                            std::size_t entryAlignment);
+
+        /**
+         * Attach to the region of a ring buffer created by a producer process.
+         *
+         * \param name name of the shared memory object
+         * \param entrySize size of an entry, must match the size used by the producer
+         * \param entryAlignment alignment of an entry, must match the alignment used by the producer
+         * \param initializationTimeout how long to wait for a producer which is still initializing the region
+         */
+        static std::shared_ptr< SharedMemoryLayout > attach(const std::string& name,
+                                                            std::size_t entrySize,
+                                                            std::size_t entryAlignment,
+                                                            std::chrono::milliseconds initializationTimeout);
+
+        /**
+         * Publish the region to the consumers, once the producer has initialized the entries.
+         */
+        void markReady();
+
+        /**
+         * Whether the calling process created the region
+         */
+        bool isProducer() const;
+
+        ProducerType producerType() const;
+
+        std::int32_t bufferSize() const;
+
+        std::int32_t maxConsumers() const;
+
+        ControlBlock& controlBlock() const
+        {
+            return m_controlBlock;
+        }
+
+        /**
+         * The availability buffer, nullptr for a single producer ring
+         */
+        std::atomic< std::int32_t >* availableBuffer() const;
+
+        void* entries() const;
+
+        /**
+         * Whether the producer process is still running and has not closed the region
+         */
+        bool isProducerAlive() const;
+
+        /**
+         * Acquire a free consumer slot for the calling process. The sequence of the slot starts at the cursor: the consumer reads the entries published after its attachment.
+         *
+         * \returns the index of the slot
+         */
+        std::int32_t acquireConsumerSlot();
+
+        void releaseConsumerSlot(std::int32_t slot);
+
+        ConsumerSlot& consumerSlot(std::int32_t slot) const;
+
+        /**
+         * Number of acquired consumer slots
+         */
+        std::int32_t consumerCount() const;
+
+        /**
+         * Release the slots of the consumer processes which are no longer running, so that the producer no longer gates on them.
+         *
+         * \returns the number of released slots
+         */
+        std::int32_t releaseDeadConsumers();
+
+        /**
+         * Get the minimum sequence of the consumer slots.
+         *
+         * \param minimum returned when no slot is acquired, or when it is lower than the sequences of the slots
+         */
+        std::int64_t minimumConsumerSequence(std::int64_t minimum) const
+        {
+            for (std::int32_t i = 0; i < m_maxConsumers; ++i)
+            {
+                auto& slot = m_consumerSlots[i];
+                if (slot.processId.load(std::memory_order_acquire) > 0)
+                {
+                    auto sequence = slot.sequence.load(std::memory_order_acquire);
+                    if (sequence < minimum)
+                        minimum = sequence;
+                }
+            }
+
+            return minimum;
+        }
+
+        /**
+         * Wake the consumers parked on the futex word, after an update of the cursor or of the availability buffer.
+         */
+        void signalConsumers()
+        {
+            // Orders the publication before the waiter count read, pairs with the increment of the waiters by the consumers
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (m_controlBlock.waiters.load(std::memory_order_relaxed) != 0)
+            {
+                m_controlBlock.futexWord.fetch_add(1);
+                Futex::wakeAllShared(m_controlBlock.futexWord);
+            }
+        }
+
+    private:
+        SharedMemoryLayout(std::unique_ptr< SharedMemoryRegion > region, bool isProducer);
+
+        std::unique_ptr< SharedMemoryRegion > m_region;
+        bool m_isProducer;
+        ControlBlock& m_controlBlock;
+        ConsumerSlot* m_consumerSlots;
+        std::int32_t m_maxConsumers;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,143 @@
+#include "stdafx.h"
+#include "SharedMemoryRegion.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "InvalidOperationException.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    void* mapObject(int descriptor, std::size_t size, const std::string& name)
+    {
+        auto address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        auto error = errno;
+        close(descriptor);
+
+        if (address == MAP_FAILED)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to map the shared memory object " << name << " (errno " << error << ")");
+
+        return address;
+    }
+
+} // namespace
+
+
+    SharedMemoryRegion::SharedMemoryRegion(const std::string& name, void* address, std::size_t size)
+        : m_name(name)
+        , m_address(address)
+        , m_size(size)
+    {
+    }
+
+    SharedMemoryRegion::~SharedMemoryRegion()
+    {
+        munmap(m_address, m_size);
+    }
+
+    std::unique_ptr< SharedMemoryRegion > SharedMemoryRegion::create(const std::string& name, std::size_t size)
+    {
+        auto descriptor = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if (descriptor < 0)
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to create the shared memory object " << name << " (errno " << errno << ")");
+
+        // The object is extended with zeros
+        if (ftruncate(descriptor, static_cast< off_t >(size)) != 0)
+        {
+            auto error = errno;
+            close(descriptor);
+            shm_unlink(name.c_str());
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to size the shared memory object " << name << " (errno " << error << ")");
+        }
+
+        void* address;
+        try
+        {
+            address = mapObject(descriptor, size, name);
+        }
+        catch (...)
+        {
+            shm_unlink(name.c_str());
+            throw;
+        }
+
+        return std::unique_ptr< SharedMemoryRegion >(new SharedMemoryRegion(name, address, size));
+    }
+
+    std::unique_ptr< SharedMemoryRegion > SharedMemoryRegion::open(const std::string& name)
+    {
+        auto descriptor = shm_open(name.c_str(), O_RDWR, 0);
+        if (descriptor < 0)
+        {
+            if (errno == ENOENT)
+                return nullptr;
+
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to open the shared memory object " << name << " (errno " << errno << ")");
+        }
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0)
+        {
+            auto error = errno;
+            close(descriptor);
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Unable to read the size of the shared memory object " << name << " (errno " << error << ")");
+        }
+
+        auto size = static_cast< std::size_t >(status.st_size);
+        if (size == 0)
+        {
+            close(descriptor);
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The shared memory object " << name << " is empty");
+        }
+
+        return std::unique_ptr< SharedMemoryRegion >(new SharedMemoryRegion(name, mapObject(descriptor, size, name), size));
+    }
+
+    bool SharedMemoryRegion::unlink(const std::string& name)
+    {
+        return shm_unlink(name.c_str()) == 0;
+    }
+
+    std::int32_t SharedMemoryRegion::currentProcessId()
+    {
+        return static_cast< std::int32_t >(getpid());
+    }
+
+    bool SharedMemoryRegion::isProcessAlive(std::int32_t processId)
+    {
+        if (processId <= 0)
+            return false;
+
+        // EPERM: the process exists but belongs to another user
+        return kill(static_cast< pid_t >(processId), 0) == 0 || errno == EPERM;
+    }
+
+    const std::string& SharedMemoryRegion::name() const
+    {
+        return m_name;
+    }
+
+    void* SharedMemoryRegion::address() const
+    {
+        return m_address;
+    }
+
+    std::size_t SharedMemoryRegion::size() const
+    {
+        return m_size;
+    }
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
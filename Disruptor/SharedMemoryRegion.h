@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+
+namespace Disruptor
+{
+
+    /**
+     * POSIX shared memory object (shm_open) mapped in the address space of the process, unmapped on destruction.
+     *
+     * The same object is usually mapped at different addresses by the processes sharing it, so the data laid out in a region must not hold pointers.
+     * This class is only available on Linux.
+     */
+    class SharedMemoryRegion
+    {
+    public:
+        ~SharedMemoryRegion();
+
+        SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+        SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+        /**
+         * Create a shared memory object filled with zeros and map it. Fails if an object with the same name exists.
+         *
+         * \param name name of the object, e.g. "/feed-handler"
+         * \param size size of the object in bytes
+         */
+        static std::unique_ptr< SharedMemoryRegion > create(const std::string& name, std::size_t size);
+
+        /**
+         * Map an existing shared memory object, with its whole size.
+         *
+         * \param name name of the object
+         * \returns nullptr if there is no object with this name
+         */
+        static std::unique_ptr< SharedMemoryRegion > open(const std::string& name);
+
+        /**
+         * Remove the name of a shared memory object, the object is destroyed once unmapped by all the processes.
+         *
+         * \returns false if there is no object with this name
+         */
+        static bool unlink(const std::string& name);
+
+        /**
+         * Identifier of the calling process, as recorded in the regions
+         */
+        static std::int32_t currentProcessId();
+
+        /**
+         * Whether a process is still running. A crashed process is detected as soon as it is reaped by its parent.
+         */
+        static bool isProcessAlive(std::int32_t processId);
+
+        const std::string& name() const;
+
+        void* address() const;
+
+        std::size_t size() const;
+
+    private:
+        SharedMemoryRegion(const std::string& name, void* address, std::size_t size);
+
+        std::string m_name;
+        void* m_address;
+        std::size_t m_size;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
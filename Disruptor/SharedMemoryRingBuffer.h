@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Disruptor/EventPoller.h"
+#include "Disruptor/ICursored.h"
+#include "Disruptor/IEventSequencer.h"
+#include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/ProducerType.h"
+#include "Disruptor/SharedMemoryLayout.h"
+#include "Disruptor/SharedMemorySequencer.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Ring buffer shared between processes: its entries, its cursor, the sequences of its consumers and the availability buffer of its sequencer
+     * live in a POSIX shared memory object, see SharedMemoryLayout. A consumer process reads the entries in place, without copying them.
+     *
+     * The producer process creates the ring with create(), and publishes to it like to a RingBuffer<T>. A consumer process attaches to it with attach(),
+     * then consumes it with a BatchEventProcessor<T> on a barrier from newBarrier(), or with an EventPoller<T> from newPoller(). Each barrier and each poller
+     * holds one of the maxConsumers consumer slots of the ring, on which the producer gates.
+     *
+     * Crashes are detected through the process identifiers stored in the region: the producer releases the slots of the crashed consumers while the ring
+     * is full, the barriers of the consumers report a timeout once the producer has crashed, and a new producer replaces the region of a crashed one.
+     *
+     * The entries are trivially copyable: they are shared as raw memory by processes which may map it at different addresses.
+     * This class is only available on Linux.
+     *
+     * \tparam T implementation storing the data for sharing during exchange or parallel coordination of an event, must be trivially copyable.
+     */
+    template <class T>
+    class SharedMemoryRingBuffer : public IEventSequencer< T >, public ICursored, public std::enable_shared_from_this< SharedMemoryRingBuffer< T > >
+    {
+        static_assert(std::is_trivially_copyable< T >::value, "The entries of a shared memory ring buffer must be trivially copyable");
+        static_assert(std::is_default_constructible< T >::value, "The entries of a shared memory ring buffer are default constructed");
+
+    public:
+        /**
+         * \param layout the region of the ring buffer, with initialized entries
+         * \param livenessCheckInterval period of the liveness checks of the other processes while waiting for them
+         */
+        SharedMemoryRingBuffer(const std::shared_ptr< SharedMemoryLayout >& layout, std::chrono::milliseconds livenessCheckInterval)
+            : m_layout(layout)
+            , m_sequencer(std::make_shared< SharedMemorySequencer< T > >(layout, livenessCheckInterval))
+            , m_sequencerRef(*m_sequencer)
+            , m_entries(static_cast< T* >(layout->entries()))
+            , m_indexMask(layout->bufferSize() - 1)
+        {
+        }
+
+        /**
+         * Create a ring buffer in a new shared memory object, the calling process being its producer.
+         *
+         * \param name name of the shared memory object, e.g. "/feed-handler"
+         * \param producerType Single, or Multi for several producer threads in the calling process
+         * \param bufferSize number of entries, must be a power of 2
+         * \param maxConsumers number of consumer slots
+         * \param livenessCheckInterval period of the liveness checks of the consumer processes while the ring is full
+         */
+        static std::shared_ptr< SharedMemoryRingBuffer< T > > create(const std::string& name,
+                                                                     ProducerType producerType,
+                                                                     std::int32_t bufferSize,
+                                                                     std::int32_t maxConsumers = 8,
+                                                                     std::chrono::milliseconds livenessCheckInterval = std::chrono::milliseconds(100))
+        {
+            auto layout = SharedMemoryLayout::create(name, producerType, bufferSize, maxConsumers, sizeof(T), alignof(T));
+
+            auto entries = static_cast< T* >(layout->entries());
+            for (std::int32_t i = 0; i < bufferSize; ++i)
+                new (&entries[i]) T();
+
+            layout->markReady();
+
+            return std::make_shared< SharedMemoryRingBuffer< T > >(layout, livenessCheckInterval);
+        }
+
+        /**
+         * Attach to the ring buffer created by a producer process.
+         *
+         * \param name name of the shared memory object
+         * \param livenessCheckInterval period of the liveness checks of the producer process by the barriers
+         * \param initializationTimeout how long to wait for a producer which is still initializing the entries
+         */
+        static std::shared_ptr< SharedMemoryRingBuffer< T > > attach(const std::string& name,
+                                                                     std::chrono::milliseconds livenessCheckInterval = std::chrono::milliseconds(100),
+                                                                     std::chrono::milliseconds initializationTimeout = std::chrono::seconds(5))
+        {
+            return std::make_shared< SharedMemoryRingBuffer< T > >(SharedMemoryLayout::attach(name, sizeof(T), alignof(T), initializationTimeout), livenessCheckInterval);
+        }
+
+        T& operator[](std::int64_t sequence) const override
+        {
+            return m_entries[sequence & m_indexMask];
+        }
+
+        std::int32_t bufferSize() override
+        {
+            return m_sequencerRef.bufferSize();
+        }
+
+        bool hasAvailableCapacity(std::int32_t requiredCapacity) override
+        {
+            return m_sequencerRef.hasAvailableCapacity(requiredCapacity);
+        }
+
+        std::int64_t getRemainingCapacity() override
+        {
+            return m_sequencerRef.getRemainingCapacity();
+        }
+
+        std::int64_t next() override
+        {
+            return m_sequencerRef.next();
+        }
+
+        std::int64_t next(std::int32_t n) override
+        {
+            return m_sequencerRef.next(n);
+        }
+
+        std::int64_t tryNext() override
+        {
+            return m_sequencerRef.tryNext();
+        }
+
+        std::int64_t tryNext(std::int32_t n) override
+        {
+            return m_sequencerRef.tryNext(n);
+        }
+
+        void publish(std::int64_t sequence) override
+        {
+            m_sequencerRef.publish(sequence);
+        }
+
+        void publish(std::int64_t lo, std::int64_t hi) override
+        {
+            m_sequencerRef.publish(lo, hi);
+        }
+
+        std::int64_t cursor() const override
+        {
+            return m_sequencerRef.cursor();
+        }
+
+        /**
+         * Create a new barrier holding a consumer slot of the ring, see SharedMemorySequenceBarrier.
+         *
+         * \param sequencesToTrack the sequences of the IEventProcessors of the calling process to track
+         */
+        std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack = {})
+        {
+            return m_sequencerRef.newBarrier(sequencesToTrack);
+        }
+
+        /**
+         * Creates an event poller holding a consumer slot of the ring.
+         *
+         * \param gatingSequences the sequences of the IEventProcessors of the calling process to gate on
+         */
+        std::shared_ptr< EventPoller< T > > newPoller(const std::vector< std::shared_ptr< ISequence > >& gatingSequences = {})
+        {
+            return m_sequencerRef.newPoller(this->shared_from_this(), gatingSequences);
+        }
+
+        /**
+         * Add gating sequences of IEventProcessors of the producer process, consuming the ring without a consumer slot.
+         */
+        void addGatingSequences(const std::vector< std::shared_ptr< ISequence > >& gatingSequences)
+        {
+            m_sequencerRef.addGatingSequences(gatingSequences);
+        }
+
+        bool removeGatingSequence(const std::shared_ptr< ISequence >& sequence)
+        {
+            return m_sequencerRef.removeGatingSequence(sequence);
+        }
+
+        /**
+         * Whether the calling process created the ring buffer
+         */
+        bool isProducer() const
+        {
+            return m_layout->isProducer();
+        }
+
+        /**
+         * Whether the producer process is still running and has not destroyed the ring buffer
+         */
+        bool isProducerAlive() const
+        {
+            return m_layout->isProducerAlive();
+        }
+
+        /**
+         * Number of consumer slots in use, in all the processes
+         */
+        std::int32_t consumerCount() const
+        {
+            return m_layout->consumerCount();
+        }
+
+        /**
+         * Release the slots of the consumer processes which are no longer running.
+         *
+         * \returns the number of released slots
+         */
+        std::int32_t releaseDeadConsumers()
+        {
+            return m_layout->releaseDeadConsumers();
+        }
+
+    private:
+        std::shared_ptr< SharedMemoryLayout > m_layout;
+        std::shared_ptr< SharedMemorySequencer< T > > m_sequencer;
+        SharedMemorySequencer< T >& m_sequencerRef;
+        T* m_entries;
+        std::int64_t m_indexMask;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
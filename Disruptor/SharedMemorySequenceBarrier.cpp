@@ -0,0 +1,219 @@
+#include "stdafx.h"
+#include "SharedMemorySequenceBarrier.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <thread>
+
+#include "FixedSequenceGroup.h"
+#include "Futex.h"
+#include "SpinWait.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    // Parking makes each publication pay for a futex wake-up, the consumer yields first while the producer is active
+    const std::int32_t yieldsBeforeParking = 100;
+
+} // namespace
+
+
+    SharedMemorySequenceBarrier::SharedMemorySequenceBarrier(const std::shared_ptr< SharedMemoryLayout >& layout,
+                                                             const std::shared_ptr< IHighestPublishedSequenceProvider >& sequenceProvider,
+                                                             const std::vector< std::shared_ptr< ISequence > >& dependentSequences,
+                                                             std::chrono::milliseconds livenessCheckInterval)
+        : m_layout(layout)
+        , m_controlBlock(layout->controlBlock())
+        , m_consumerSlot(layout->acquireConsumerSlot())
+        , m_consumerSlotRef(layout->consumerSlot(m_consumerSlot))
+        , m_sequenceProvider(sequenceProvider)
+        , m_alerted(false)
+    {
+        if (!dependentSequences.empty())
+            m_dependentSequence = std::make_shared< FixedSequenceGroup >(dependentSequences);
+
+        auto seconds = std::chrono::duration_cast< std::chrono::seconds >(livenessCheckInterval);
+        m_livenessCheckTimeout.tv_sec = static_cast< decltype(m_livenessCheckTimeout.tv_sec) >(seconds.count());
+        m_livenessCheckTimeout.tv_nsec = static_cast< decltype(m_livenessCheckTimeout.tv_nsec) >(std::chrono::duration_cast< std::chrono::nanoseconds >(livenessCheckInterval - seconds).count());
+    }
+
+    SharedMemorySequenceBarrier::~SharedMemorySequenceBarrier()
+    {
+        m_layout->releaseConsumerSlot(m_consumerSlot);
+    }
+
+    std::int64_t SharedMemorySequenceBarrier::waitFor(std::int64_t sequence)
+    {
+        auto result = tryWaitFor(sequence);
+
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+
+        if (result.status == SequenceWaitStatus::TimedOut)
+            DISRUPTOR_THROW_TIMEOUT_EXCEPTION();
+
+        return result.sequence;
+    }
+
+    SequenceWaitResult SharedMemorySequenceBarrier::tryWaitFor(std::int64_t sequence)
+    {
+        reportProgress(sequence);
+
+        if (isAlerted())
+            return SequenceWaitResult::alerted();
+
+        auto result = waitForCursor(sequence);
+        if (!result.isAvailable())
+            return result;
+
+        if (m_dependentSequence != nullptr)
+        {
+            result = waitForDependentSequence(sequence);
+            if (!result.isAvailable())
+                return result;
+        }
+
+        if (result.sequence < sequence)
+            return result;
+
+        return SequenceWaitResult::available(m_sequenceProvider->getHighestPublishedSequence(sequence, result.sequence));
+    }
+
+    std::int64_t SharedMemorySequenceBarrier::cursor()
+    {
+        if (m_dependentSequence != nullptr)
+            return m_dependentSequence->value();
+
+        return m_controlBlock.cursor.load(std::memory_order_acquire);
+    }
+
+    bool SharedMemorySequenceBarrier::isAlerted()
+    {
+        return m_alerted.load(std::memory_order_acquire);
+    }
+
+    void SharedMemorySequenceBarrier::alert()
+    {
+        m_alerted.store(true, std::memory_order_release);
+
+        // Also wakes the consumers of the other processes, they park again
+        m_controlBlock.futexWord.fetch_add(1);
+        Futex::wakeAllShared(m_controlBlock.futexWord);
+    }
+
+    void SharedMemorySequenceBarrier::clearAlert()
+    {
+        m_alerted.store(false, std::memory_order_release);
+    }
+
+    void SharedMemorySequenceBarrier::checkAlert()
+    {
+        if (isAlerted())
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+    }
+
+    WaitQueue* SharedMemorySequenceBarrier::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        sequence->setValue(m_consumerSlotRef.sequence.load(std::memory_order_acquire));
+        m_processorSequence = sequence;
+
+        return nullptr;
+    }
+
+    std::int32_t SharedMemorySequenceBarrier::consumerSlot() const
+    {
+        return m_consumerSlot;
+    }
+
+    void SharedMemorySequenceBarrier::reportProgress(std::int64_t sequence)
+    {
+        auto consumed = m_processorSequence != nullptr ? m_processorSequence->value() : sequence - 1;
+
+        // Only the calling process writes the slot, which never moves backwards
+        if (consumed > m_consumerSlotRef.sequence.load(std::memory_order_relaxed))
+            m_consumerSlotRef.sequence.store(consumed, std::memory_order_release);
+    }
+
+    SequenceWaitResult SharedMemorySequenceBarrier::waitForCursor(std::int64_t sequence)
+    {
+        SpinWait spinWait;
+        std::int32_t yieldCount = 0;
+
+        std::int64_t availableSequence;
+        while ((availableSequence = m_controlBlock.cursor.load(std::memory_order_acquire)) < sequence)
+        {
+            if (isAlerted())
+                return SequenceWaitResult::alerted();
+
+            if (!spinWait.nextSpinWillYield())
+            {
+                spinWait.spinOnce();
+            }
+            else if (yieldCount < yieldsBeforeParking)
+            {
+                std::this_thread::yield();
+                ++yieldCount;
+            }
+            else
+            {
+                return park(sequence);
+            }
+        }
+
+        return SequenceWaitResult::available(availableSequence);
+    }
+
+    SequenceWaitResult SharedMemorySequenceBarrier::park(std::int64_t sequence)
+    {
+        m_controlBlock.waiters.fetch_add(1);
+
+        auto result = SequenceWaitResult::timedOut();
+        while (true)
+        {
+            // The word is read before the cursor: a publish made after this read advances the word and fails the futex wait
+            auto futexValue = m_controlBlock.futexWord.load();
+
+            auto availableSequence = m_controlBlock.cursor.load(std::memory_order_acquire);
+            if (availableSequence >= sequence)
+            {
+                result = SequenceWaitResult::available(availableSequence);
+                break;
+            }
+
+            if (isAlerted())
+            {
+                result = SequenceWaitResult::alerted();
+                break;
+            }
+
+            if (!Futex::waitShared(m_controlBlock.futexWord, futexValue, &m_livenessCheckTimeout) && !m_layout->isProducerAlive())
+                break;
+        }
+
+        m_controlBlock.waiters.fetch_sub(1);
+
+        return result;
+    }
+
+    SequenceWaitResult SharedMemorySequenceBarrier::waitForDependentSequence(std::int64_t sequence)
+    {
+        SpinWait spinWait;
+
+        std::int64_t availableSequence;
+        while ((availableSequence = m_dependentSequence->value()) < sequence)
+        {
+            if (isAlerted())
+                return SequenceWaitResult::alerted();
+
+            spinWait.spinOnce();
+        }
+
+        return SequenceWaitResult::available(availableSequence);
+    }
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <vector>
+
+#include "Disruptor/IHighestPublishedSequenceProvider.h"
+#include "Disruptor/ISequenceBarrier.h"
+#include "Disruptor/SharedMemoryLayout.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * ISequenceBarrier of a consumer of a SharedMemoryRingBuffer<T>, possibly in another process than the producer.
+     *
+     * The barrier holds a consumer slot of the ring, on which the producer gates. The IEventProcessor registered with registerDependentSequence() starts
+     * at the sequence of the slot, and its sequence is copied to the slot each time it waits for the next events. Without a registered IEventProcessor,
+     * waiting for a sequence reports the previous ones as consumed. The slot is released when the barrier is destroyed.
+     *
+     * The barrier spins and yields briefly, then parks on the futex word of the ring shared with the producer. Parked waits are checked for the liveness of
+     * the producer process every livenessCheckInterval: once the producer has crashed or closed the ring, waiting ends with SequenceWaitStatus::TimedOut,
+     * so that an ITimeoutHandler can halt the IEventProcessor.
+     */
+    class SharedMemorySequenceBarrier : public ISequenceBarrier
+    {
+    public:
+        /**
+         * \param layout the region of the ring buffer
+         * \param sequenceProvider the sequencer of the ring buffer
+         * \param dependentSequences the sequences of the IEventProcessors of the calling process the barrier gates on, in addition to the cursor
+         * \param livenessCheckInterval period of the liveness checks of the producer process while parked
+         */
+        SharedMemorySequenceBarrier(const std::shared_ptr< SharedMemoryLayout >& layout,
+                                    const std::shared_ptr< IHighestPublishedSequenceProvider >& sequenceProvider,
+                                    const std::vector< std::shared_ptr< ISequence > >& dependentSequences,
+                                    std::chrono::milliseconds livenessCheckInterval);
+
+        ~SharedMemorySequenceBarrier() override;
+
+        std::int64_t waitFor(std::int64_t sequence) override;
+
+        SequenceWaitResult tryWaitFor(std::int64_t sequence) override;
+
+        std::int64_t cursor() override;
+
+        bool isAlerted() override;
+
+        void alert() override;
+
+        void clearAlert() override;
+
+        void checkAlert() override;
+
+        /**
+         * Start the sequence of the IEventProcessor at the sequence of the consumer slot, and copy it to the slot from now on.
+         *
+         * \returns nullptr, the barriers gated on the IEventProcessor spin on its sequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
+        /**
+         * Index of the consumer slot held by the barrier
+         */
+        std::int32_t consumerSlot() const;
+
+    private:
+        void reportProgress(std::int64_t sequence);
+        SequenceWaitResult waitForCursor(std::int64_t sequence);
+        SequenceWaitResult park(std::int64_t sequence);
+        SequenceWaitResult waitForDependentSequence(std::int64_t sequence);
+
+        std::shared_ptr< SharedMemoryLayout > m_layout;
+        SharedMemoryLayout::ControlBlock& m_controlBlock;
+        std::int32_t m_consumerSlot;
+        SharedMemoryLayout::ConsumerSlot& m_consumerSlotRef;
+        std::shared_ptr< IHighestPublishedSequenceProvider > m_sequenceProvider;
+        std::shared_ptr< ISequence > m_dependentSequence;
+        std::shared_ptr< ISequence > m_processorSequence;
+        timespec m_livenessCheckTimeout;
+        std::atomic< bool > m_alerted;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
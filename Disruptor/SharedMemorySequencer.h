@@ -0,0 +1,389 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/AtomicSequenceArray.h"
+#include "Disruptor/EventPoller.h"
+#include "Disruptor/InsufficientCapacityException.h"
+#include "Disruptor/InvalidOperationException.h"
+#include "Disruptor/ISequencer.h"
+#include "Disruptor/Sequence.h"
+#include "Disruptor/SequenceGroups.h"
+#include "Disruptor/SharedMemoryLayout.h"
+#include "Disruptor/SharedMemorySequenceBarrier.h"
+#include "Disruptor/SharedSequence.h"
+#include "Disruptor/SpinWait.h"
+#include "Disruptor/Util.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Sequencer of a SharedMemoryRingBuffer<T>, whose cursor, availability buffer and consumer sequences live in a SharedMemoryLayout.
+     *
+     * Sequences are claimed by the process which created the layout, by a single thread or by several threads depending on the producer type of the layout,
+     * the same way as the SingleProducerSequencer<T> and the MultiProducerSequencer<T>. The producer gates on the consumer slots of the layout, and on the
+     * gating sequences added to the sequencer by the consumers of its own process. The slots of crashed consumers are released while the ring is full.
+     *
+     * The barriers and the pollers it creates acquire a consumer slot, so they can be used in any of the processes attached to the layout.
+     */
+    template <class T>
+    class SharedMemorySequencer : public ISequencer< T >, public std::enable_shared_from_this< SharedMemorySequencer< T > >
+    {
+        struct Fields
+        {
+            char padding0[56];
+            std::int64_t nextValue;
+            std::int64_t cachedValue;
+            char padding1[56];
+        };
+
+    public:
+        /**
+         * \param layout the region of the ring buffer
+         * \param livenessCheckInterval period of the liveness checks of the consumer processes while the ring is full, and of the producer process by the barriers
+         */
+        SharedMemorySequencer(const std::shared_ptr< SharedMemoryLayout >& layout, std::chrono::milliseconds livenessCheckInterval)
+            : m_layout(layout)
+            , m_layoutRef(*m_layout)
+            , m_bufferSize(layout->bufferSize())
+            , m_indexMask(m_bufferSize - 1)
+            , m_indexShift(Util::log2(m_bufferSize))
+            , m_isProducer(layout->isProducer())
+            , m_cursorRef(layout->controlBlock().cursor)
+            , m_availableBuffer(layout->availableBuffer())
+            , m_cursorSequence(std::make_shared< SharedSequence >(layout->controlBlock().cursor, layout))
+            , m_livenessCheckInterval(livenessCheckInterval)
+        {
+            m_fields.nextValue = m_cursorRef.load(std::memory_order_acquire);
+            m_fields.cachedValue = Sequence::InitialCursorValue;
+        }
+
+        std::int32_t bufferSize() override
+        {
+            return m_bufferSize;
+        }
+
+        bool hasAvailableCapacity(std::int32_t requiredCapacity) override
+        {
+            auto current = m_availableBuffer == nullptr ? m_fields.nextValue : m_cursorRef.load(std::memory_order_acquire);
+            auto wrapPoint = (current + requiredCapacity) - m_bufferSize;
+
+            return wrapPoint <= minimumGatingSequence(current);
+        }
+
+        std::int64_t getRemainingCapacity() override
+        {
+            auto produced = m_availableBuffer == nullptr ? m_fields.nextValue : m_cursorRef.load(std::memory_order_acquire);
+            auto consumed = minimumGatingSequence(produced);
+
+            return m_bufferSize - (produced - consumed);
+        }
+
+        std::int64_t next() override
+        {
+            return next(1);
+        }
+
+        std::int64_t next(std::int32_t n) override
+        {
+            if (n < 1 || n > m_bufferSize)
+            {
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("n must be > 0 and < bufferSize");
+            }
+
+            checkProducer();
+
+            if (m_availableBuffer == nullptr)
+                return nextSingle(n);
+
+            return nextMulti(n);
+        }
+
+        std::int64_t tryNext() override
+        {
+            return tryNext(1);
+        }
+
+        std::int64_t tryNext(std::int32_t n) override
+        {
+            if (n < 1)
+            {
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("n must be > 0");
+            }
+
+            checkProducer();
+
+            if (m_availableBuffer == nullptr)
+            {
+                if (!hasAvailableCapacity(n))
+                {
+                    DISRUPTOR_THROW_INSUFFICIENT_CAPACITY_EXCEPTION();
+                }
+
+                m_fields.nextValue += n;
+                return m_fields.nextValue;
+            }
+
+            std::int64_t current;
+            std::int64_t next;
+
+            do
+            {
+                current = m_cursorRef.load(std::memory_order_acquire);
+                next = current + n;
+
+                if (next - m_bufferSize > minimumGatingSequence(current))
+                {
+                    DISRUPTOR_THROW_INSUFFICIENT_CAPACITY_EXCEPTION();
+                }
+            }
+            while (!m_cursorRef.compare_exchange_weak(current, next));
+
+            return next;
+        }
+
+        void claim(std::int64_t sequence) override
+        {
+            checkProducer();
+
+            if (m_availableBuffer == nullptr)
+                m_fields.nextValue = sequence;
+            else
+                m_cursorRef.store(sequence, std::memory_order_release);
+        }
+
+        void publish(std::int64_t sequence) override
+        {
+            if (m_availableBuffer == nullptr)
+                m_cursorRef.store(sequence, std::memory_order_release);
+            else
+                m_availableBuffer[sequence & m_indexMask].store(availabilityFlag(sequence), std::memory_order_release);
+
+            m_layoutRef.signalConsumers();
+        }
+
+        void publish(std::int64_t lo, std::int64_t hi) override
+        {
+            if (m_availableBuffer == nullptr)
+            {
+                publish(hi);
+                return;
+            }
+
+            // A single release fence orders the event writes before all the flag stores of the range
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (auto sequence = lo; sequence <= hi; ++sequence)
+                m_availableBuffer[sequence & m_indexMask].store(availabilityFlag(sequence), std::memory_order_relaxed);
+
+            m_layoutRef.signalConsumers();
+        }
+
+        bool isAvailable(std::int64_t sequence) override
+        {
+            if (m_availableBuffer == nullptr)
+            {
+                auto currentSequence = m_cursorRef.load(std::memory_order_acquire);
+                return sequence <= currentSequence && sequence > currentSequence - m_bufferSize;
+            }
+
+            return m_availableBuffer[sequence & m_indexMask].load(std::memory_order_acquire) == availabilityFlag(sequence);
+        }
+
+        std::int64_t getHighestPublishedSequence(std::int64_t lowerBound, std::int64_t availableSequence) override
+        {
+            if (m_availableBuffer == nullptr)
+                return availableSequence;
+
+            for (auto sequence = lowerBound; sequence <= availableSequence; ++sequence)
+            {
+                if (!isAvailable(sequence))
+                    return sequence - 1;
+            }
+
+            return availableSequence;
+        }
+
+        std::int64_t cursor() const override
+        {
+            return m_cursorRef.load(std::memory_order_acquire);
+        }
+
+        /**
+         * Add gating sequences of the IEventProcessors of the producer process, in addition to the consumer slots of the layout.
+         */
+        void addGatingSequences(const std::vector< std::shared_ptr< ISequence > >& gatingSequences) override
+        {
+            SequenceGroups::addSequences(m_gatingSequences, *this, gatingSequences);
+        }
+
+        bool removeGatingSequence(const std::shared_ptr< ISequence >& sequence) override
+        {
+            return SequenceGroups::removeSequence(m_gatingSequences, sequence);
+        }
+
+        void setGatingSequenceGroupSize(std::int32_t groupSize) override
+        {
+            m_gatingSequences.setGroupSize(groupSize);
+        }
+
+        /**
+         * Create a SharedMemorySequenceBarrier holding a consumer slot of the layout.
+         *
+         * \param sequencesToTrack the sequences of the IEventProcessors of the calling process to track, in addition to the cursor
+         */
+        std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack) override
+        {
+            return std::make_shared< SharedMemorySequenceBarrier >(m_layout, this->shared_from_this(), sequencesToTrack, m_livenessCheckInterval);
+        }
+
+        std::int64_t getMinimumSequence() override
+        {
+            return minimumGatingSequence(cursor());
+        }
+
+        /**
+         * Create an event poller whose sequence is the sequence of a consumer slot of the layout, released with the poller.
+         */
+        std::shared_ptr< EventPoller< T > > newPoller(const std::shared_ptr< IDataProvider< T > >& provider, const std::vector< std::shared_ptr< ISequence > >& gatingSequences) override
+        {
+            auto layout = m_layout;
+            auto consumerSlot = layout->acquireConsumerSlot();
+            std::shared_ptr< void > slotOwner(nullptr, [layout, consumerSlot](void*) { layout->releaseConsumerSlot(consumerSlot); });
+
+            auto sequence = std::make_shared< SharedSequence >(layout->consumerSlot(consumerSlot).sequence, slotOwner);
+
+            return EventPoller< T >::newInstance(provider, this->shared_from_this(), sequence, m_cursorSequence, gatingSequences);
+        }
+
+        void writeDescriptionTo(std::ostream& stream) const override
+        {
+            stream << "Cursor: { " << cursor() << " }, ConsumerCount: " << m_layoutRef.consumerCount() << ", IsProducer: " << m_isProducer;
+        }
+
+    private:
+        void checkProducer() const
+        {
+            if (!m_isProducer)
+                DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("Only the process which created the ring buffer publishes to it");
+        }
+
+        std::int64_t minimumGatingSequence(std::int64_t minimum) const
+        {
+            return m_layoutRef.minimumConsumerSequence(m_gatingSequences.minimumSequence(minimum));
+        }
+
+        std::int64_t nextSingle(std::int32_t n)
+        {
+            auto nextValue = m_fields.nextValue;
+
+            auto nextSequence = nextValue + n;
+            auto wrapPoint = nextSequence - m_bufferSize;
+            auto cachedGatingSequence = m_fields.cachedValue;
+
+            if (wrapPoint > cachedGatingSequence || cachedGatingSequence > nextValue)
+            {
+                m_cursorRef.store(nextValue, std::memory_order_release);
+
+                SpinWait spinWait;
+                auto nextLivenessCheck = std::chrono::steady_clock::now() + m_livenessCheckInterval;
+
+                std::int64_t minSequence;
+                while (wrapPoint > (minSequence = minimumGatingSequence(nextValue)))
+                    waitForConsumers(spinWait, nextLivenessCheck);
+
+                m_fields.cachedValue = minSequence;
+            }
+
+            m_fields.nextValue = nextSequence;
+
+            return nextSequence;
+        }
+
+        std::int64_t nextMulti(std::int32_t n)
+        {
+            std::int64_t current;
+            std::int64_t next;
+
+            SpinWait spinWait;
+            auto nextLivenessCheck = std::chrono::steady_clock::now() + m_livenessCheckInterval;
+
+            do
+            {
+                current = m_cursorRef.load(std::memory_order_acquire);
+                next = current + n;
+
+                auto wrapPoint = next - m_bufferSize;
+                auto cachedGatingSequence = m_gatingSequenceCache.value();
+
+                if (wrapPoint > cachedGatingSequence || cachedGatingSequence > current)
+                {
+                    auto gatingSequence = minimumGatingSequence(current);
+
+                    if (wrapPoint > gatingSequence)
+                    {
+                        waitForConsumers(spinWait, nextLivenessCheck);
+                        continue;
+                    }
+
+                    m_gatingSequenceCache.setValue(gatingSequence);
+                }
+                else if (m_cursorRef.compare_exchange_weak(current, next))
+                {
+                    break;
+                }
+            }
+            while (true);
+
+            return next;
+        }
+
+        void waitForConsumers(SpinWait& spinWait, std::chrono::steady_clock::time_point& nextLivenessCheck)
+        {
+            m_layoutRef.signalConsumers();
+            spinWait.spinOnce();
+
+            // A crashed consumer would otherwise block the producer forever
+            auto now = std::chrono::steady_clock::now();
+            if (now >= nextLivenessCheck)
+            {
+                m_layoutRef.releaseDeadConsumers();
+                nextLivenessCheck = now + m_livenessCheckInterval;
+            }
+        }
+
+        std::int32_t availabilityFlag(std::int64_t sequence) const
+        {
+            return static_cast< std::int32_t >(static_cast< std::uint64_t >(sequence) >> m_indexShift);
+        }
+
+        std::shared_ptr< SharedMemoryLayout > m_layout;
+        SharedMemoryLayout& m_layoutRef;
+        std::int32_t m_bufferSize;
+        std::int32_t m_indexMask;
+        std::int32_t m_indexShift;
+        bool m_isProducer;
+        std::atomic< std::int64_t >& m_cursorRef;
+        std::atomic< std::int32_t >* m_availableBuffer;
+        std::shared_ptr< SharedSequence > m_cursorSequence;
+        std::chrono::milliseconds m_livenessCheckInterval;
+        AtomicSequenceArray m_gatingSequences;
+        Fields m_fields;
+        Sequence m_gatingSequenceCache;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
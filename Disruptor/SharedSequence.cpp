@@ -0,0 +1,36 @@
+#include "stdafx.h"
+#include "SharedSequence.h"
+
+#include <ostream>
+
+
+namespace Disruptor
+{
+
+    SharedSequence::SharedSequence(std::atomic< std::int64_t >& value, const std::shared_ptr< void >& owner)
+        : m_value(value)
+        , m_owner(owner)
+    {
+    }
+
+    bool SharedSequence::compareAndSet(std::int64_t expectedSequence, std::int64_t nextSequence)
+    {
+        return m_value.compare_exchange_strong(expectedSequence, nextSequence);
+    }
+
+    std::int64_t SharedSequence::incrementAndGet()
+    {
+        return m_value.fetch_add(1) + 1;
+    }
+
+    std::int64_t SharedSequence::addAndGet(std::int64_t value)
+    {
+        return m_value.fetch_add(value) + value;
+    }
+
+    void SharedSequence::writeDescriptionTo(std::ostream& stream) const
+    {
+        stream << m_value.load();
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "Disruptor/ISequence.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Sequence whose counter lives outside of the object, e.g. in a SharedMemoryRegion where it is read and written by several processes.
+     * A Sequence cannot be placed in shared memory itself since its virtual table is private to each process.
+     */
+    class SharedSequence : public ISequence
+    {
+    public:
+        /**
+         * \param value the counter
+         * \param owner kept alive as long as the sequence, typically the mapping of the counter
+         */
+        SharedSequence(std::atomic< std::int64_t >& value, const std::shared_ptr< void >& owner);
+
+        std::int64_t value() const override
+        {
+            return m_value.load(std::memory_order_acquire);
+        }
+
+        void setValue(std::int64_t value) override
+        {
+            m_value.store(value, std::memory_order_release);
+        }
+
+        bool compareAndSet(std::int64_t expectedSequence, std::int64_t nextSequence) override;
+
+        std::int64_t incrementAndGet() override;
+
+        std::int64_t addAndGet(std::int64_t value) override;
+
+        void writeDescriptionTo(std::ostream& stream) const override;
+
+    private:
+        std::atomic< std::int64_t >& m_value;
+        std::shared_ptr< void > m_owner;
+    };
+
+} // namespace Disruptor
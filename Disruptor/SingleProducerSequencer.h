@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <typeinfo>
 
 #include "Disruptor/InsufficientCapacityException.h"
 #include "Disruptor/IWaitStrategy.h"
@@ -12,8 +13,8 @@
 namespace Disruptor
 {
 
-    template <class T>
-    class SingleProducerSequencer : public Sequencer< T >
+    template <class T, class TWaitStrategy = IWaitStrategy>
+    class SingleProducerSequencer : public Sequencer< T, TWaitStrategy >
     {
         struct Fields
         {
@@ -29,8 +30,8 @@ namespace Disruptor
         };
 
     public:
-        SingleProducerSequencer(std::int32_t bufferSize, const std::shared_ptr< IWaitStrategy >& waitStrategy)
-            : Sequencer< T >(bufferSize, waitStrategy)
+        SingleProducerSequencer(std::int32_t bufferSize, const std::shared_ptr< TWaitStrategy >& waitStrategy)
+            : Sequencer< T, TWaitStrategy >(bufferSize, waitStrategy)
             , m_fields(Sequence::InitialCursorValue, Sequence::InitialCursorValue)
         {}
 
@@ -49,7 +50,7 @@ namespace Disruptor
 
             if (wrapPoint > cachedGatingSequence || cachedGatingSequence > nextValue)
             {
-                auto minSequence = Util::getMinimumSequence(this->m_gatingSequences, nextValue);
+                auto minSequence = this->m_gatingSequences.minimumSequence(nextValue, wrapPoint);
                 m_fields.cachedValue = minSequence;
 
                 if (wrapPoint > minSequence)
@@ -103,9 +104,9 @@ namespace Disruptor
 
                 SpinWait spinWait;
                 std::int64_t minSequence;
-                while (wrapPoint > (minSequence = Util::getMinimumSequence(this->m_gatingSequences, nextValue)))
+                while (wrapPoint > (minSequence = this->m_gatingSequences.minimumSequence(nextValue, wrapPoint)))
                 {
-                    this->m_waitStrategyRef.signalAllWhenBlocking();
+                    WaitStrategyDispatch< TWaitStrategy >::signalAllWhenBlocking(this->m_waitStrategyRef);
                     spinWait.spinOnce();
                 }
 
@@ -158,7 +159,7 @@ namespace Disruptor
         {
             auto nextValue = m_fields.nextValue;
 
-            auto consumed = Util::getMinimumSequence(this->m_gatingSequences, nextValue);
+            auto consumed = this->m_gatingSequences.minimumSequence(nextValue);
             auto produced = nextValue;
 
             return this->bufferSize() - (produced - consumed);
@@ -181,8 +182,8 @@ namespace Disruptor
          */ 
         void publish(std::int64_t sequence) override
         {
-            this->m_cursorRef.setValue(sequence);
-            this->m_waitStrategyRef.signalAllWhenBlocking();
+            this->m_cursorRef.Sequence::setValue(sequence);
+            WaitStrategyDispatch< TWaitStrategy >::signalAllWhenBlocking(this->m_waitStrategyRef);
         }
 
         /**
@@ -204,7 +205,7 @@ namespace Disruptor
          */ 
         bool isAvailable(std::int64_t sequence) override
         {
-            return sequence <= this->m_cursorRef.value();
+            return sequence <= this->m_cursorRef.Sequence::value();
         }
 
         /**
@@ -221,6 +222,21 @@ namespace Disruptor
             return availableSequence;
         }
 
+        /**
+         * Create a ISequenceBarrier that gates on the the cursor and a list of Sequences.
+         * The barrier is bound to the concrete sequencer and wait strategy types so its waitFor() does not go through virtual calls,
+         * unless this sequencer is an instance of a derived class.
+         *
+         * \param sequencesToTrack
+         */
+        std::shared_ptr< ISequenceBarrier > newBarrier(const std::vector< std::shared_ptr< ISequence > >& sequencesToTrack) override
+        {
+            if (typeid(*this) != typeid(SingleProducerSequencer))
+                return Sequencer< T, TWaitStrategy >::newBarrier(sequencesToTrack);
+
+            return std::make_shared< ProcessingSequenceBarrier< SingleProducerSequencer, TWaitStrategy > >(std::static_pointer_cast< SingleProducerSequencer >(this->shared_from_this()), this->m_waitStrategy, this->m_cursor, sequencesToTrack);
+        }
+
     protected:
         Fields m_fields;
     };
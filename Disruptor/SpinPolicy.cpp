@@ -0,0 +1,159 @@
+#include "stdafx.h"
+#include "SpinPolicy.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "ArgumentException.h"
+#include "BuildConfig.h"
+#include "Sequence.h"
+
+#if defined(DISRUPTOR_GNUC_COMPILER) && defined(DISRUPTOR_CPU_X86)
+# include <cpuid.h>
+# define DISRUPTOR_WAITPKG
+#endif
+
+
+namespace Disruptor
+{
+namespace
+{
+
+#if defined(DISRUPTOR_WAITPKG)
+
+    // Upper bound of a single UMWAIT, in TSC ticks, so that a missed write only delays the waiter
+    const std::uint64_t umwaitTimeoutInTicks = 100 * 1000;
+
+    bool detectWaitPkg()
+    {
+        if (__get_cpuid_max(0, nullptr) < 7)
+            return false;
+
+        unsigned int eax, ebx, ecx, edx;
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+        // CPUID.(EAX=07H, ECX=0H):ECX.WAITPKG[bit 5]
+        return (ecx & (1u << 5)) != 0;
+    }
+
+    // The instructions are emitted as bytes so that the library does not need to be compiled with -mwaitpkg
+
+    void umonitor(const void* address)
+    {
+        // umonitor rax
+        asm volatile(".byte 0xf3, 0x0f, 0xae, 0xf0" : : "a"(address) : "memory");
+    }
+
+    void umwait(std::uint64_t deadline)
+    {
+        // umwait ecx, with ecx = 1 requesting the C0.1 state which has the fastest wake-up
+        asm volatile(".byte 0xf2, 0x0f, 0xae, 0xf1"
+                     :
+                     : "c"(1u), "a"(static_cast< std::uint32_t >(deadline)), "d"(static_cast< std::uint32_t >(deadline >> 32))
+                     : "cc", "memory");
+    }
+
+#endif
+
+} // namespace
+
+
+    const std::int32_t SpinPolicy::DefaultMaxPauses = 16;
+
+
+    SpinPolicy::SpinPolicy(std::int32_t maxPauses, bool useWaitPkg)
+        : m_maxPauses(maxPauses)
+        , m_pauseCount(1)
+        , m_useWaitPkg(useWaitPkg && isWaitPkgSupported())
+    {
+        if (maxPauses < 1)
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("maxPauses must be greater than 0");
+    }
+
+    void SpinPolicy::spinOnce()
+    {
+        for (auto i = 0; i < m_pauseCount; ++i)
+            pause();
+
+        m_pauseCount = std::min(m_pauseCount * 2, m_maxPauses);
+    }
+
+    void SpinPolicy::waitForChange(const Sequence& sequence, std::int64_t observedValue)
+    {
+#if defined(DISRUPTOR_WAITPKG)
+        if (m_useWaitPkg)
+        {
+            umonitor(sequence.valueAddress());
+
+            // A write between the caller's read and the monitor being armed would otherwise be missed until the timeout
+            if (sequence.value() == observedValue)
+                umwait(__builtin_ia32_rdtsc() + umwaitTimeoutInTicks);
+
+            return;
+        }
+#else
+        (void)sequence;
+        (void)observedValue;
+#endif
+
+        spinOnce();
+    }
+
+    void SpinPolicy::reset()
+    {
+        m_pauseCount = 1;
+    }
+
+    std::int32_t SpinPolicy::pauseCount() const
+    {
+        return m_pauseCount;
+    }
+
+    bool SpinPolicy::usesWaitPkg() const
+    {
+        return m_useWaitPkg;
+    }
+
+    void SpinPolicy::pause()
+    {
+#if defined(DISRUPTOR_STD_YIELD)
+
+        std::this_thread::yield();
+        
+#elif defined(DISRUPTOR_VC_COMPILER)
+
+        ::YieldProcessor();
+
+#elif defined(DISRUPTOR_GNUC_COMPILER)
+
+#if defined(DISRUPTOR_CPU_ARM)
+        asm volatile
+        (
+            "yield"
+        );
+#else
+        asm volatile
+        (
+            "rep\n"
+            "nop"
+        );
+#endif
+
+#else
+
+# error "Unsupported platform"
+
+#endif
+    }
+
+    bool SpinPolicy::isWaitPkgSupported()
+    {
+#if defined(DISRUPTOR_WAITPKG)
+        static const bool supported = detectWaitPkg();
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+
+namespace Disruptor
+{
+
+    class Sequence;
+
+
+    /**
+     * Busy spin policy issuing PAUSE instructions with an exponential backoff, from 1 up to maxPauses per spin, to leave the pipeline
+     * to the sibling hyper-thread while spinning.
+     *
+     * When the CPU supports WAITPKG, detected at runtime through CPUID, waitForChange() monitors the cache line of a sequence with UMONITOR
+     * and sleeps with UMWAIT until it is written, instead of spinning.
+     */
+    class SpinPolicy
+    {
+    public:
+        /**
+         * \param maxPauses the upper bound of the backoff, in PAUSE instructions per spin, must be greater than 0
+         * \param useWaitPkg whether waitForChange() should use UMONITOR/UMWAIT when the CPU supports them
+         */
+        explicit SpinPolicy(std::int32_t maxPauses = DefaultMaxPauses, bool useWaitPkg = true);
+
+        /**
+         * Pause for the current backoff, then double it up to maxPauses.
+         */
+        void spinOnce();
+
+        /**
+         * Wait until the value of the sequence is likely to have changed from observedValue. May return before it changed.
+         *
+         * \param sequence the sequence to monitor
+         * \param observedValue the last value read from the sequence
+         */
+        void waitForChange(const Sequence& sequence, std::int64_t observedValue);
+
+        /**
+         * Reset the backoff to a single PAUSE.
+         */
+        void reset();
+
+        /**
+         * Number of PAUSE instructions issued by the next spinOnce()
+         */
+        std::int32_t pauseCount() const;
+
+        /**
+         * Whether waitForChange() uses UMONITOR/UMWAIT
+         */
+        bool usesWaitPkg() const;
+
+        /**
+         * Issue a single PAUSE instruction, or its equivalent on the current CPU.
+         */
+        static void pause();
+
+        /**
+         * Whether the CPU supports the UMONITOR and UMWAIT instructions
+         */
+        static bool isWaitPkgSupported();
+
+        static const std::int32_t DefaultMaxPauses;
+
+    private:
+        std::int32_t m_maxPauses;
+        std::int32_t m_pauseCount;
+        bool m_useWaitPkg;
+    };
+
+} // namespace Disruptor
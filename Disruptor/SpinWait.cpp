@@ -5,8 +5,8 @@
 #include <stdexcept>
 #include <thread>
 
-#include "BuildConfig.h"
 #include "ClockConfig.h"
+#include "SpinPolicy.h"
 
 
 namespace Disruptor
@@ -107,39 +107,7 @@ namespace Disruptor
     void SpinWait::spinWaitInternal(std::int32_t iterationCount)
     {
         for (auto i = 0; i < iterationCount; i++)
-            yieldProcessor();
-    }
-
-    void SpinWait::yieldProcessor()
-    {
-#if defined(DISRUPTOR_STD_YIELD)
-
-        std::this_thread::yield();
-        
-#elif defined(DISRUPTOR_VC_COMPILER)
-
-        ::YieldProcessor();
-
-#elif defined(DISRUPTOR_GNUC_COMPILER)
-
-#if defined(DISRUPTOR_CPU_ARM)
-        asm volatile
-        (
-            "yield"
-        );
-#else
-        asm volatile
-        (
-            "rep\n"
-            "nop"
-        );
-#endif
-
-#else
-
-# error "Unsupported platform"
-
-#endif
+            SpinPolicy::pause();
     }
 
 } // namespace Disruptor
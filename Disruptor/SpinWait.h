@@ -26,7 +26,6 @@ namespace Disruptor
 
     private:
         static void spinWaitInternal(std::int32_t iterationCount);
-        static void yieldProcessor();
 
     private:
         std::int32_t m_count;
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/IWaitStrategy.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Whether the calls made through a reference of type T are bound at compile time, i.e. whether T is a concrete class rather than an interface.
+     *
+     * The classes of the library are not final, so that they can be derived from. A statically dispatched call is a qualified call, which would bypass
+     * the overrides of a derived class: the referenced object must be exactly a T, see requireExactType().
+     */
+    template <class T>
+    struct IsStaticallyDispatched : std::integral_constant< bool, !std::is_abstract< T >::value >
+    {
+    };
+
+    /**
+     * Check that an object referenced through a statically dispatched T& is exactly a T, e.g. not a class derived from a wait strategy of the library.
+     */
+    template <class T>
+    void requireExactType(const T& object)
+    {
+        if (IsStaticallyDispatched< T >::value && typeid(object) != typeid(T))
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("The object must be exactly a " << typeid(T).name() << " to be called without virtual dispatch, not a " << typeid(object).name());
+    }
+
+
+    /**
+     * Reads of the events of a data provider of type TDataProvider, qualified when TDataProvider is a concrete data provider, e.g. RingBuffer<T>.
+     */
+    template <class TDataProvider, bool = IsStaticallyDispatched< TDataProvider >::value>
+    struct DataProviderDispatch
+    {
+        static auto get(const TDataProvider& dataProvider, std::int64_t sequence) -> decltype(dataProvider[sequence])
+        {
+            return dataProvider.TDataProvider::operator[](sequence);
+        }
+    };
+
+    template <class TDataProvider>
+    struct DataProviderDispatch< TDataProvider, false >
+    {
+        static auto get(const TDataProvider& dataProvider, std::int64_t sequence) -> decltype(dataProvider[sequence])
+        {
+            return dataProvider[sequence];
+        }
+    };
+
+
+    /**
+     * Calls to an event handler of type TEventHandler, qualified when TEventHandler is a concrete event handler.
+     */
+    template <class TEventHandler, bool = IsStaticallyDispatched< TEventHandler >::value>
+    struct EventHandlerDispatch
+    {
+        template <class T>
+        static void onEvent(TEventHandler& eventHandler, T& data, std::int64_t sequence, bool endOfBatch)
+        {
+            eventHandler.TEventHandler::onEvent(data, sequence, endOfBatch);
+        }
+    };
+
+    template <class TEventHandler>
+    struct EventHandlerDispatch< TEventHandler, false >
+    {
+        template <class T>
+        static void onEvent(TEventHandler& eventHandler, T& data, std::int64_t sequence, bool endOfBatch)
+        {
+            eventHandler.onEvent(data, sequence, endOfBatch);
+        }
+    };
+
+
+    /**
+     * Calls to a wait strategy of type TWaitStrategy, qualified when TWaitStrategy is a concrete strategy.
+     */
+    template <class TWaitStrategy, bool = IsStaticallyDispatched< TWaitStrategy >::value>
+    struct WaitStrategyDispatch
+    {
+        static std::int64_t waitFor(TWaitStrategy& waitStrategy, std::int64_t sequence, Sequence& cursor, ISequence& dependentSequence, ISequenceBarrier& barrier)
+        {
+            return waitStrategy.TWaitStrategy::waitFor(sequence, cursor, dependentSequence, barrier);
+        }
+
+        static SequenceWaitResult tryWaitFor(TWaitStrategy& waitStrategy, std::int64_t sequence, Sequence& cursor, ISequence& dependentSequence, ISequenceBarrier& barrier)
+        {
+            return waitStrategy.TWaitStrategy::tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        }
+
+        static void signalAllWhenBlocking(TWaitStrategy& waitStrategy)
+        {
+            waitStrategy.TWaitStrategy::signalAllWhenBlocking();
+        }
+    };
+
+    template <class TWaitStrategy>
+    struct WaitStrategyDispatch< TWaitStrategy, false >
+    {
+        static std::int64_t waitFor(TWaitStrategy& waitStrategy, std::int64_t sequence, Sequence& cursor, ISequence& dependentSequence, ISequenceBarrier& barrier)
+        {
+            return waitStrategy.waitFor(sequence, cursor, dependentSequence, barrier);
+        }
+
+        static SequenceWaitResult tryWaitFor(TWaitStrategy& waitStrategy, std::int64_t sequence, Sequence& cursor, ISequence& dependentSequence, ISequenceBarrier& barrier)
+        {
+            return waitStrategy.tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        }
+
+        static void signalAllWhenBlocking(TWaitStrategy& waitStrategy)
+        {
+            waitStrategy.signalAllWhenBlocking();
+        }
+    };
+
+
+    /**
+     * Calls to the claim and publish methods of a sequencer of type TSequencer, qualified when TSequencer is a concrete sequencer.
+     */
+    template <class TSequencer, bool = IsStaticallyDispatched< TSequencer >::value>
+    struct SequencerDispatch
+    {
+        static std::int64_t next(TSequencer& sequencer)
+        {
+            return sequencer.TSequencer::next();
+        }
+
+        static std::int64_t next(TSequencer& sequencer, std::int32_t n)
+        {
+            return sequencer.TSequencer::next(n);
+        }
+
+        static std::int64_t tryNext(TSequencer& sequencer)
+        {
+            return sequencer.TSequencer::tryNext();
+        }
+
+        static std::int64_t tryNext(TSequencer& sequencer, std::int32_t n)
+        {
+            return sequencer.TSequencer::tryNext(n);
+        }
+
+        static void publish(TSequencer& sequencer, std::int64_t lo, std::int64_t hi)
+        {
+            sequencer.TSequencer::publish(lo, hi);
+        }
+
+        static void publish(TSequencer& sequencer, std::int64_t sequence)
+        {
+            sequencer.TSequencer::publish(sequence);
+        }
+
+        static std::int64_t getHighestPublishedSequence(TSequencer& sequencer, std::int64_t nextSequence, std::int64_t availableSequence)
+        {
+            return sequencer.TSequencer::getHighestPublishedSequence(nextSequence, availableSequence);
+        }
+    };
+
+    template <class TSequencer>
+    struct SequencerDispatch< TSequencer, false >
+    {
+        static std::int64_t next(TSequencer& sequencer)
+        {
+            return sequencer.next();
+        }
+
+        static std::int64_t next(TSequencer& sequencer, std::int32_t n)
+        {
+            return sequencer.next(n);
+        }
+
+        static std::int64_t tryNext(TSequencer& sequencer)
+        {
+            return sequencer.tryNext();
+        }
+
+        static std::int64_t tryNext(TSequencer& sequencer, std::int32_t n)
+        {
+            return sequencer.tryNext(n);
+        }
+
+        static void publish(TSequencer& sequencer, std::int64_t lo, std::int64_t hi)
+        {
+            sequencer.publish(lo, hi);
+        }
+
+        static void publish(TSequencer& sequencer, std::int64_t sequence)
+        {
+            sequencer.publish(sequence);
+        }
+
+        static std::int64_t getHighestPublishedSequence(TSequencer& sequencer, std::int64_t nextSequence, std::int64_t availableSequence)
+        {
+            return sequencer.getHighestPublishedSequence(nextSequence, availableSequence);
+        }
+    };
+
+} // namespace Disruptor
@@ -3,8 +3,6 @@
 
 #include <ostream>
 
-#include <boost/chrono.hpp>
-
 #include "ISequenceBarrier.h"
 #include "Sequence.h"
 #include "TimeoutException.h"
@@ -15,45 +13,93 @@ namespace Disruptor
 
     TimeoutBlockingWaitStrategy::TimeoutBlockingWaitStrategy(ClockConfig::Duration timeout)
         : m_timeout(timeout)
+        , m_timeoutSpan(std::chrono::duration_cast< std::chrono::microseconds >(timeout).count())
     {
     }
 
-     std::int64_t TimeoutBlockingWaitStrategy::waitFor(std::int64_t sequence,
-                                                       Sequence& cursor,
-                                                       ISequence& dependentSequence,
-                                                       ISequenceBarrier& barrier)
+    std::int64_t TimeoutBlockingWaitStrategy::waitFor(std::int64_t sequence,
+                                                      Sequence& cursor,
+                                                      ISequence& dependentSequence,
+                                                      ISequenceBarrier& barrier)
     {
-        auto timeSpan = boost::chrono::microseconds(std::chrono::duration_cast< std::chrono::microseconds >(m_timeout).count());
+        auto result = tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+        if (result.status == SequenceWaitStatus::TimedOut)
+            DISRUPTOR_THROW_TIMEOUT_EXCEPTION();
+
+        return result.sequence;
+    }
 
+    SequenceWaitResult TimeoutBlockingWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                               Sequence& cursor,
+                                                               ISequence& dependentSequence,
+                                                               ISequenceBarrier& barrier)
+    {
         if (cursor.value() < sequence)
         {
             boost::unique_lock< decltype(m_gate) > uniqueLock(m_gate);
 
-            while (cursor.value() < sequence)
-            {
-                barrier.checkAlert();
+            // Registered under the lock, before the cursor is checked, so that a publisher either sees the waiter or the waiter sees the new cursor
+            m_waiters.fetch_add(1);
 
-                if (m_conditionVariable.wait_for(uniqueLock, timeSpan) == boost::cv_status::timeout)
-                    DISRUPTOR_THROW_TIMEOUT_EXCEPTION();
+            auto status = SequenceWaitStatus::Available;
+            try
+            {
+                while (cursor.value() < sequence)
+                {
+                    if (barrier.isAlerted())
+                    {
+                        status = SequenceWaitStatus::Alerted;
+                        break;
+                    }
+
+                    if (m_conditionVariable.wait_for(uniqueLock, m_timeoutSpan) == boost::cv_status::timeout)
+                    {
+                        status = SequenceWaitStatus::TimedOut;
+                        break;
+                    }
+                }
+            }
+            catch (...)
+            {
+                m_waiters.fetch_sub(1);
+                throw;
             }
-        }
 
-        std::int64_t availableSequence;
-        while ((availableSequence = dependentSequence.value()) < sequence)
-        {
-            barrier.checkAlert();
+            m_waiters.fetch_sub(1);
+
+            if (status != SequenceWaitStatus::Available)
+                return { status, -1 };
         }
 
-        return availableSequence;
+        return m_waiterRegistry.tryWaitFor(sequence, dependentSequence, barrier, m_timeout);
     }
 
     void TimeoutBlockingWaitStrategy::signalAllWhenBlocking()
     {
+        // Orders the cursor update before the waiter count read, pairs with the increment of m_waiters in tryWaitFor()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_waiters.load(std::memory_order_relaxed) == 0)
+            return;
+
         boost::unique_lock< decltype(m_gate) > uniqueLock(m_gate);
 
         m_conditionVariable.notify_all();
     }
 
+    void TimeoutBlockingWaitStrategy::signalAllWhenAlerted()
+    {
+        signalAllWhenBlocking();
+        m_waiterRegistry.wakeAll();
+    }
+
+    WaitQueue* TimeoutBlockingWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return &m_waiterRegistry.registerSequence(sequence);
+    }
+
     void TimeoutBlockingWaitStrategy::writeDescriptionTo(std::ostream& stream) const
     {
         stream << "TimeoutBlockingWaitStrategy";
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
+#include <boost/chrono.hpp>
 #include <boost/thread.hpp>
 
 #include "Disruptor/ClockConfig.h"
 #include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaiterRegistry.h"
 
 
 namespace Disruptor
@@ -22,17 +27,38 @@ namespace Disruptor
                              ISequence& dependentSequence,
                              ISequenceBarrier& barrier) override;
 
+        /**
+         * \see IWaitStrategy.tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
         /**
          * \see IWaitStrategy.signalAllWhenBlocking
          */ 
         void signalAllWhenBlocking() override;
 
+        /**
+         * \see IWaitStrategy.signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy.registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
         void writeDescriptionTo(std::ostream& stream) const override;
 
     private:
         ClockConfig::Duration m_timeout;
+        boost::chrono::microseconds m_timeoutSpan;
         boost::recursive_mutex m_gate;
         boost::condition_variable_any m_conditionVariable;
+        std::atomic< std::int32_t > m_waiters { 0 };
+        WaiterRegistry m_waiterRegistry;
     };
 
 } // namespace Disruptor
@@ -0,0 +1,110 @@
+#include "stdafx.h"
+#include "TimeoutFutexWaitStrategy.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <ostream>
+
+#include "Futex.h"
+#include "ISequenceBarrier.h"
+#include "Sequence.h"
+#include "TimeoutException.h"
+
+
+namespace Disruptor
+{
+
+    TimeoutFutexWaitStrategy::TimeoutFutexWaitStrategy(ClockConfig::Duration timeout)
+        : m_timeout(timeout)
+    {
+        auto seconds = std::chrono::duration_cast< std::chrono::seconds >(timeout);
+
+        m_timeoutSpec.tv_sec = static_cast< decltype(m_timeoutSpec.tv_sec) >(seconds.count());
+        m_timeoutSpec.tv_nsec = static_cast< decltype(m_timeoutSpec.tv_nsec) >(std::chrono::duration_cast< std::chrono::nanoseconds >(timeout - seconds).count());
+    }
+
+    std::int64_t TimeoutFutexWaitStrategy::waitFor(std::int64_t sequence,
+                                                   Sequence& cursor,
+                                                   ISequence& dependentSequence,
+                                                   ISequenceBarrier& barrier)
+    {
+        auto result = tryWaitFor(sequence, cursor, dependentSequence, barrier);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+        if (result.status == SequenceWaitStatus::TimedOut)
+            DISRUPTOR_THROW_TIMEOUT_EXCEPTION();
+
+        return result.sequence;
+    }
+
+    SequenceWaitResult TimeoutFutexWaitStrategy::tryWaitFor(std::int64_t sequence,
+                                                            Sequence& cursor,
+                                                            ISequence& dependentSequence,
+                                                            ISequenceBarrier& barrier)
+    {
+        if (cursor.value() < sequence)
+        {
+            m_waiters.fetch_add(1);
+
+            auto status = SequenceWaitStatus::Available;
+            while (true)
+            {
+                // The word is read before the cursor: a publish made after this read advances the word and fails the futex wait
+                auto futexValue = m_futexWord.load();
+
+                if (cursor.value() >= sequence)
+                    break;
+
+                if (barrier.isAlerted())
+                {
+                    status = SequenceWaitStatus::Alerted;
+                    break;
+                }
+
+                if (!Futex::wait(m_futexWord, futexValue, &m_timeoutSpec))
+                {
+                    status = SequenceWaitStatus::TimedOut;
+                    break;
+                }
+            }
+
+            m_waiters.fetch_sub(1);
+
+            if (status != SequenceWaitStatus::Available)
+                return { status, -1 };
+        }
+
+        return m_waiterRegistry.tryWaitFor(sequence, dependentSequence, barrier, m_timeout);
+    }
+
+    void TimeoutFutexWaitStrategy::signalAllWhenBlocking()
+    {
+        // Orders the cursor update before the waiter count read, pairs with the increment of m_waiters in tryWaitFor()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_waiters.load(std::memory_order_relaxed) != 0)
+        {
+            m_futexWord.fetch_add(1);
+            Futex::wakeAll(m_futexWord);
+        }
+    }
+
+    void TimeoutFutexWaitStrategy::signalAllWhenAlerted()
+    {
+        signalAllWhenBlocking();
+        m_waiterRegistry.wakeAll();
+    }
+
+    WaitQueue* TimeoutFutexWaitStrategy::registerDependentSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        return &m_waiterRegistry.registerSequence(sequence);
+    }
+
+    void TimeoutFutexWaitStrategy::writeDescriptionTo(std::ostream& stream) const
+    {
+        stream << "TimeoutFutexWaitStrategy";
+    }
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Disruptor/BuildConfig.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/WaiterRegistry.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Variation of the FutexWaitStrategy which throws a TimeoutException when no event was published while parked for the timeout,
+     * allowing the ITimeoutHandler of the event handlers to be notified. Publishers only wake the futex when a consumer is parked.
+     *
+     * This strategy is only available on Linux.
+     */
+    class TimeoutFutexWaitStrategy : public IWaitStrategy
+    {
+    public:
+        explicit TimeoutFutexWaitStrategy(ClockConfig::Duration timeout);
+
+        /**
+         * \see IWaitStrategy::waitFor
+         */
+        std::int64_t waitFor(std::int64_t sequence,
+                             Sequence& cursor,
+                             ISequence& dependentSequence,
+                             ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::tryWaitFor
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence,
+                                      Sequence& cursor,
+                                      ISequence& dependentSequence,
+                                      ISequenceBarrier& barrier) override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenBlocking
+         */
+        void signalAllWhenBlocking() override;
+
+        /**
+         * \see IWaitStrategy::signalAllWhenAlerted
+         */
+        void signalAllWhenAlerted() override;
+
+        /**
+         * \see IWaitStrategy::registerDependentSequence
+         */
+        WaitQueue* registerDependentSequence(const std::shared_ptr< ISequence >& sequence) override;
+
+        void writeDescriptionTo(std::ostream& stream) const override;
+
+    private:
+        ClockConfig::Duration m_timeout;
+        timespec m_timeoutSpec;
+        std::atomic< std::int32_t > m_futexWord { 0 };
+        std::atomic< std::int32_t > m_waiters { 0 };
+        WaiterRegistry m_waiterRegistry;
+    };
+
+} // namespace Disruptor
+
+#endif // DISRUPTOR_OS_FAMILY_LINUX
@@ -0,0 +1,148 @@
+#include "stdafx.h"
+#include "TopologyAwareTaskScheduler.h"
+
+#include <boost/date_time.hpp>
+
+#include "ArgumentException.h"
+#include "ArgumentOutOfRangeException.h"
+#include "InvalidOperationException.h"
+#include "ThreadHelper.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    std::vector< std::int32_t > affinityCpus(const CpuTopology& topology)
+    {
+        auto mask = ThreadHelper::getThreadAffinity();
+
+        std::vector< std::int32_t > cpus;
+        for (auto&& cpu : topology.cpus())
+        {
+            if (cpu.id < static_cast< std::int32_t >(mask.size()) && mask.test(cpu.id))
+                cpus.push_back(cpu.id);
+        }
+
+        // The affinity mask is not available on every platform
+        if (cpus.empty())
+        {
+            for (auto&& cpu : topology.cpus())
+                cpus.push_back(cpu.id);
+        }
+
+        return cpus;
+    }
+
+} // namespace
+
+
+    TopologyAwareTaskScheduler::TopologyAwareTaskScheduler(bool avoidSiblings)
+        : TopologyAwareTaskScheduler(CpuTopology::detect(), {}, avoidSiblings)
+    {
+    }
+
+    TopologyAwareTaskScheduler::TopologyAwareTaskScheduler(const CpuTopology& topology, const std::vector< std::int32_t >& cpuList, bool avoidSiblings)
+    {
+        m_placement = topology.placementOrder(cpuList.empty() ? affinityCpus(topology) : cpuList, avoidSiblings);
+
+        if (m_placement.empty())
+            DISRUPTOR_THROW_ARGUMENT_EXCEPTION("None of the CPUs of the list is part of the topology");
+    }
+
+    void TopologyAwareTaskScheduler::start(std::int32_t numberOfThreads)
+    {
+        if (numberOfThreads < 1)
+            DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(numberOfThreads);
+
+        if (m_started.exchange(true))
+            return;
+
+        createThreads(numberOfThreads);
+    }
+
+    void TopologyAwareTaskScheduler::stop()
+    {
+        if (!m_started.exchange(false))
+            return;
+
+        for (auto&& thread : m_threads)
+        {
+            if (thread.joinable())
+                thread.timed_join(boost::posix_time::seconds(10));
+        }
+
+        // A restart creates a new pool, the tasks are handed to its threads from the first one
+        m_threads.clear();
+        m_workers.clear();
+        m_nextWorkerIndex = 0;
+    }
+
+    std::future< void > TopologyAwareTaskScheduler::scheduleAndStart(std::packaged_task< void() >&& task)
+    {
+        // Each task is bound to a thread, which only exists once the scheduler is started
+        if (m_workers.empty())
+            DISRUPTOR_THROW_INVALID_OPERATION_EXCEPTION("The scheduler must be started before scheduling tasks");
+
+        auto future = task.get_future();
+
+        auto workerIndex = m_nextWorkerIndex.fetch_add(1) % static_cast< std::int32_t >(m_workers.size());
+        m_workers[workerIndex]->tasks.push(std::move(task));
+
+        return future;
+    }
+
+    std::int32_t TopologyAwareTaskScheduler::pinCurrentThread()
+    {
+        auto cpu = nextCpu();
+
+        ThreadHelper::AffinityMask mask;
+        if (cpu >= static_cast< std::int32_t >(mask.size()))
+            return -1;
+
+        mask.set(cpu);
+        return ThreadHelper::setThreadAffinity(mask) ? cpu : -1;
+    }
+
+    const std::vector< std::int32_t >& TopologyAwareTaskScheduler::placement() const
+    {
+        return m_placement;
+    }
+
+    std::int32_t TopologyAwareTaskScheduler::nextCpu()
+    {
+        return m_placement[m_nextPlacementIndex.fetch_add(1) % m_placement.size()];
+    }
+
+    void TopologyAwareTaskScheduler::createThreads(std::int32_t numberOfThreads)
+    {
+        // The CPUs are assigned here, so that producers pinned before start() come first in the placement
+        for (auto i = 0; i < numberOfThreads; ++i)
+        {
+            m_workers.push_back(std::make_shared< Worker >());
+            m_workers.back()->cpu = nextCpu();
+        }
+
+        // The threads share their worker, which outlives a thread still running a task when the scheduler is stopped
+        for (auto&& worker : m_workers)
+            m_threads.emplace_back([this, worker]() { workingLoop(*worker); });
+    }
+
+    void TopologyAwareTaskScheduler::workingLoop(Worker& worker)
+    {
+        ThreadHelper::AffinityMask mask;
+        if (worker.cpu < static_cast< std::int32_t >(mask.size()))
+            ThreadHelper::setThreadAffinity(mask.set(worker.cpu));
+
+        while (m_started)
+        {
+            std::packaged_task< void() > task;
+            while (worker.tasks.timedWaitAndPop(task, std::chrono::milliseconds(100)))
+            {
+                task();
+            }
+        }
+    }
+
+} // namespace Disruptor
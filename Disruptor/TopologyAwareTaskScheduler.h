@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include "Disruptor/BlockingQueue.h"
+#include "Disruptor/CpuTopology.h"
+#include "Disruptor/ITaskScheduler.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * An implementation of TaskScheduler which pins each thread of the pool to a single CPU, following the placement order of the CpuTopology:
+     * threads started one after the other, e.g. the event processors of a pipeline, share a NUMA node and run on distinct physical cores first.
+     *
+     * The CPUs are taken from the user-provided CPU list, or from the affinity mask of the thread creating the scheduler, which reflects
+     * taskset, cgroups and isolcpus. Each task is handed to the next thread of the pool, so the k-th scheduled task runs on the k-th CPU of the placement.
+     * A producer thread calls pinCurrentThread() to take its CPU from the same placement, next to the event processors of its ring buffer.
+     */
+    class TopologyAwareTaskScheduler : public ITaskScheduler
+    {
+        struct Worker
+        {
+            BlockingQueue< std::packaged_task< void() > > tasks;
+            std::int32_t cpu = -1;
+        };
+
+    public:
+        /**
+         * Place the threads on the CPUs of the current affinity mask, using the topology of the machine.
+         *
+         * \param avoidSiblings true to place threads on distinct physical cores before using hyperthread siblings
+         */
+        explicit TopologyAwareTaskScheduler(bool avoidSiblings = true);
+
+        /**
+         * \param topology the topology of the machine
+         * \param cpuList the CPUs threads may be placed on, all the CPUs of the current affinity mask if empty
+         * \param avoidSiblings true to place threads on distinct physical cores before using hyperthread siblings
+         */
+        TopologyAwareTaskScheduler(const CpuTopology& topology, const std::vector< std::int32_t >& cpuList, bool avoidSiblings = true);
+
+        void start(std::int32_t numberOfThreads) override;
+        void stop() override;
+
+        std::future< void > scheduleAndStart(std::packaged_task< void() >&& task) override;
+
+        /**
+         * Pin the calling thread, e.g. a producer, to the next CPU of the placement.
+         *
+         * \returns the CPU the thread is pinned to, -1 if the affinity could not be set
+         */
+        std::int32_t pinCurrentThread();
+
+        /**
+         * The CPUs in placement order. Threads and pinned producers take them in turn, wrapping around when there are more threads than CPUs.
+         */
+        const std::vector< std::int32_t >& placement() const;
+
+    private:
+        std::int32_t nextCpu();
+        void createThreads(std::int32_t numberOfThreads);
+        void workingLoop(Worker& worker);
+
+        std::vector< std::int32_t > m_placement;
+        std::atomic< std::int32_t > m_nextPlacementIndex { 0 };
+        std::atomic< std::int32_t > m_nextWorkerIndex { 0 };
+        std::atomic< bool > m_started { false };
+        std::vector< std::shared_ptr< Worker > > m_workers;
+        std::vector< boost::thread > m_threads;
+    };
+
+} // namespace Disruptor
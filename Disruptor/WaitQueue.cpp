@@ -0,0 +1,78 @@
+#include "stdafx.h"
+#include "WaitQueue.h"
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+# include "Futex.h"
+#else
+# include <boost/chrono.hpp>
+#endif
+
+
+namespace Disruptor
+{
+
+    std::int32_t WaitQueue::waiterCount() const
+    {
+        return m_waiters.load();
+    }
+
+#ifdef DISRUPTOR_OS_FAMILY_LINUX
+
+    bool WaitQueue::park(std::int32_t epoch, const ClockConfig::Duration* timeout)
+    {
+        if (timeout == nullptr)
+            return Futex::wait(m_epoch, epoch);
+
+        auto seconds = std::chrono::duration_cast< std::chrono::seconds >(*timeout);
+
+        timespec timeoutSpec;
+        timeoutSpec.tv_sec = static_cast< decltype(timeoutSpec.tv_sec) >(seconds.count());
+        timeoutSpec.tv_nsec = static_cast< decltype(timeoutSpec.tv_nsec) >(std::chrono::duration_cast< std::chrono::nanoseconds >(*timeout - seconds).count());
+
+        return Futex::wait(m_epoch, epoch, &timeoutSpec);
+    }
+
+    void WaitQueue::wakeParked()
+    {
+        m_epoch.fetch_add(1);
+        Futex::wakeAll(m_epoch);
+    }
+
+#else
+
+    bool WaitQueue::park(std::int32_t epoch, const ClockConfig::Duration* timeout)
+    {
+        boost::unique_lock< decltype(m_mutex) > uniqueLock(m_mutex);
+
+        if (timeout == nullptr)
+        {
+            while (m_epoch.load() == epoch)
+                m_conditionVariable.wait(uniqueLock);
+
+            return true;
+        }
+
+        auto timeSpan = boost::chrono::microseconds(std::chrono::duration_cast< std::chrono::microseconds >(*timeout).count());
+
+        while (m_epoch.load() == epoch)
+        {
+            if (m_conditionVariable.wait_for(uniqueLock, timeSpan) == boost::cv_status::timeout)
+                return m_epoch.load() != epoch;
+        }
+
+        return true;
+    }
+
+    void WaitQueue::wakeParked()
+    {
+        {
+            boost::unique_lock< decltype(m_mutex) > uniqueLock(m_mutex);
+            m_epoch.fetch_add(1);
+        }
+
+        m_conditionVariable.notify_all();
+    }
+
+#endif
+
+} // namespace Disruptor
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "Disruptor/BuildConfig.h"
+
+#ifndef DISRUPTOR_OS_FAMILY_LINUX
+# include <boost/thread.hpp>
+#endif
+
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/ISequenceBarrier.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Parking spot for the threads waiting for a condition, e.g. a sequence to advance, which wakeAll() signals once the condition may have changed.
+     *
+     * The waiters register themselves before checking the condition, so wakeAll() only costs a fence and an atomic load when nobody is parked.
+     * Parked threads block on a futex on Linux, on a condition variable elsewhere.
+     */
+    class WaitQueue
+    {
+    public:
+        WaitQueue() = default;
+
+        WaitQueue(const WaitQueue&) = delete;
+        WaitQueue& operator=(const WaitQueue&) = delete;
+
+        /**
+         * Park until condition() returns true, checking the alert status of the barrier before each park.
+         *
+         * \param condition the condition to wait for, called before each park and after each wake-up
+         * \param barrier the barrier whose alert interrupts the wait, by throwing an AlertException
+         */
+        template <class TCondition>
+        void waitUntil(const TCondition& condition, ISequenceBarrier& barrier)
+        {
+            if (waitUntilInternal(condition, barrier, nullptr) == SequenceWaitStatus::Alerted)
+                DISRUPTOR_THROW_ALERT_EXCEPTION();
+        }
+
+        /**
+         * Park until condition() returns true, checking the alert status of the barrier before each park.
+         *
+         * \param condition the condition to wait for, called before each park and after each wake-up
+         * \param barrier the barrier whose alert interrupts the wait, by throwing an AlertException
+         * \param timeout the maximum duration of a single park
+         * \returns false if a park timed out before condition() returned true, true otherwise
+         */
+        template <class TCondition>
+        bool waitUntil(const TCondition& condition, ISequenceBarrier& barrier, ClockConfig::Duration timeout)
+        {
+            auto status = waitUntilInternal(condition, barrier, &timeout);
+            if (status == SequenceWaitStatus::Alerted)
+                DISRUPTOR_THROW_ALERT_EXCEPTION();
+
+            return status == SequenceWaitStatus::Available;
+        }
+
+        /**
+         * Park until condition() returns true or the barrier is alerted, without throwing.
+         *
+         * \param condition the condition to wait for, called before each park and after each wake-up
+         * \param barrier the barrier whose alert interrupts the wait
+         * \returns SequenceWaitStatus::Available once condition() returned true, SequenceWaitStatus::Alerted otherwise
+         */
+        template <class TCondition>
+        SequenceWaitStatus tryWaitUntil(const TCondition& condition, ISequenceBarrier& barrier)
+        {
+            return waitUntilInternal(condition, barrier, nullptr);
+        }
+
+        /**
+         * Park until condition() returns true, the barrier is alerted or a park times out, without throwing.
+         *
+         * \param condition the condition to wait for, called before each park and after each wake-up
+         * \param barrier the barrier whose alert interrupts the wait
+         * \param timeout the maximum duration of a single park
+         * \returns SequenceWaitStatus::Available once condition() returned true, SequenceWaitStatus::Alerted or SequenceWaitStatus::TimedOut otherwise
+         */
+        template <class TCondition>
+        SequenceWaitStatus tryWaitUntil(const TCondition& condition, ISequenceBarrier& barrier, ClockConfig::Duration timeout)
+        {
+            return waitUntilInternal(condition, barrier, &timeout);
+        }
+
+        /**
+         * Wake all the parked threads. Must be called after each change which may satisfy the condition of a waiter.
+         */
+        void wakeAll()
+        {
+            // Orders the change made by the caller before the waiter count read, pairs with the increment of m_waiters in waitUntil()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (m_waiters.load(std::memory_order_relaxed) != 0)
+                wakeParked();
+        }
+
+        /**
+         * Number of threads currently waiting, parked or about to park
+         */
+        std::int32_t waiterCount() const;
+
+    private:
+        template <class TCondition>
+        SequenceWaitStatus waitUntilInternal(const TCondition& condition, ISequenceBarrier& barrier, const ClockConfig::Duration* timeout)
+        {
+            if (condition())
+                return SequenceWaitStatus::Available;
+
+            m_waiters.fetch_add(1);
+
+            auto status = SequenceWaitStatus::Available;
+            try
+            {
+                while (true)
+                {
+                    // The epoch is read before the condition: a wake-up after this read changes the epoch and fails the park
+                    auto epoch = m_epoch.load();
+
+                    if (condition())
+                        break;
+
+                    // Checked without throwing, the halt of a parked processor is not an exceptional path
+                    if (barrier.isAlerted())
+                    {
+                        status = SequenceWaitStatus::Alerted;
+                        break;
+                    }
+
+                    if (!park(epoch, timeout))
+                    {
+                        status = SequenceWaitStatus::TimedOut;
+                        break;
+                    }
+                }
+            }
+            catch (...)
+            {
+                m_waiters.fetch_sub(1);
+                throw;
+            }
+
+            m_waiters.fetch_sub(1);
+            return status;
+        }
+
+        bool park(std::int32_t epoch, const ClockConfig::Duration* timeout);
+        void wakeParked();
+
+        std::atomic< std::int32_t > m_epoch { 0 };
+        std::atomic< std::int32_t > m_waiters { 0 };
+
+#ifndef DISRUPTOR_OS_FAMILY_LINUX
+        boost::mutex m_mutex;
+        boost::condition_variable m_conditionVariable;
+#endif
+    };
+
+} // namespace Disruptor
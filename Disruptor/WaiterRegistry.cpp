@@ -0,0 +1,159 @@
+#include "stdafx.h"
+#include "WaiterRegistry.h"
+
+#include <algorithm>
+
+#include "FixedSequenceGroup.h"
+#include "ISequence.h"
+#include "ISequenceBarrier.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    template <class TCondition>
+    SequenceWaitStatus parkUntil(WaitQueue& queue, const TCondition& condition, ISequenceBarrier& barrier, const ClockConfig::Duration* timeout)
+    {
+        if (timeout == nullptr)
+            return queue.tryWaitUntil(condition, barrier);
+
+        return queue.tryWaitUntil(condition, barrier, *timeout);
+    }
+
+} // namespace
+
+
+    WaiterRegistry::WaiterRegistry()
+    {
+        m_snapshots.push_back(std::make_unique< Registrations >());
+        m_current.store(m_snapshots.back().get(), std::memory_order_release);
+    }
+
+    WaitQueue& WaiterRegistry::registerSequence(const std::shared_ptr< ISequence >& sequence)
+    {
+        std::lock_guard< std::mutex > lock(m_mutex);
+
+        auto& current = *m_current.load(std::memory_order_relaxed);
+
+        auto queue = find(current, *sequence);
+        if (queue != nullptr)
+            return *queue;
+
+        m_queues.push_back(std::make_unique< WaitQueue >());
+
+        auto snapshot = std::make_unique< Registrations >();
+        for (auto&& registration : current)
+        {
+            // Drops the sequences which have been destroyed, their address may be reused by a sequence which is not registered
+            if (!registration.owner.expired())
+                snapshot->push_back(registration);
+        }
+        snapshot->push_back({ sequence.get(), sequence, m_queues.back().get() });
+
+        m_current.store(snapshot.get(), std::memory_order_release);
+        m_snapshots.push_back(std::move(snapshot));
+
+        return *m_queues.back();
+    }
+
+    std::int64_t WaiterRegistry::waitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier)
+    {
+        auto result = tryWaitFor(sequence, dependentSequence, barrier, nullptr);
+        if (result.status == SequenceWaitStatus::Alerted)
+            DISRUPTOR_THROW_ALERT_EXCEPTION();
+
+        return result.sequence;
+    }
+
+    SequenceWaitResult WaiterRegistry::tryWaitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier)
+    {
+        return tryWaitFor(sequence, dependentSequence, barrier, nullptr);
+    }
+
+    SequenceWaitResult WaiterRegistry::tryWaitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier, ClockConfig::Duration timeout)
+    {
+        return tryWaitFor(sequence, dependentSequence, barrier, &timeout);
+    }
+
+    SequenceWaitResult WaiterRegistry::tryWaitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier, const ClockConfig::Duration* timeout)
+    {
+        std::int64_t availableSequence;
+        if ((availableSequence = dependentSequence.value()) >= sequence)
+            return SequenceWaitResult::available(availableSequence);
+
+        auto& registrations = *m_current.load(std::memory_order_acquire);
+
+        auto group = dynamic_cast< FixedSequenceGroup* >(&dependentSequence);
+        if (group == nullptr)
+        {
+            auto queue = find(registrations, dependentSequence);
+            if (queue != nullptr)
+            {
+                auto status = parkUntil(*queue, [&] { return dependentSequence.value() >= sequence; }, barrier, timeout);
+                if (status != SequenceWaitStatus::Available)
+                    return { status, -1 };
+
+                return SequenceWaitResult::available(dependentSequence.value());
+            }
+        }
+        else if (allRegistered(registrations, group->sequences()))
+        {
+            // Sequences never move backwards, so the members can be waited for one after the other, within the timeout of the whole wait
+            auto deadline = timeout != nullptr ? ClockConfig::Clock::now() + *timeout : ClockConfig::TimePoint::max();
+
+            for (auto&& member : group->sequences())
+            {
+                auto& memberRef = *member;
+                auto remaining = std::max(deadline - ClockConfig::Clock::now(), ClockConfig::Duration::zero());
+
+                auto status = parkUntil(*find(registrations, memberRef), [&] { return memberRef.value() >= sequence; }, barrier, timeout != nullptr ? &remaining : nullptr);
+                if (status != SequenceWaitStatus::Available)
+                    return { status, -1 };
+            }
+
+            return SequenceWaitResult::available(dependentSequence.value());
+        }
+
+        // Some sequences are not advanced by a registered processor, nobody would wake us up
+        while ((availableSequence = dependentSequence.value()) < sequence)
+        {
+            if (barrier.isAlerted())
+                return SequenceWaitResult::alerted();
+        }
+
+        return SequenceWaitResult::available(availableSequence);
+    }
+
+    void WaiterRegistry::wakeAll()
+    {
+        for (auto&& registration : *m_current.load(std::memory_order_acquire))
+        {
+            registration.queue->wakeAll();
+        }
+    }
+
+    bool WaiterRegistry::allRegistered(const Registrations& registrations, const std::vector< std::shared_ptr< ISequence > >& sequences) const
+    {
+        for (auto&& sequence : sequences)
+        {
+            if (find(registrations, *sequence) == nullptr)
+                return false;
+        }
+
+        return true;
+    }
+
+    WaitQueue* WaiterRegistry::find(const Registrations& registrations, const ISequence& sequence) const
+    {
+        for (auto&& registration : registrations)
+        {
+            if (registration.sequence == &sequence && !registration.owner.expired())
+                return registration.queue;
+        }
+
+        return nullptr;
+    }
+
+} // namespace Disruptor
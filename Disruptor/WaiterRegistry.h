@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Disruptor/ClockConfig.h"
+#include "Disruptor/SequenceWaitResult.h"
+#include "Disruptor/WaitQueue.h"
+
+
+namespace Disruptor
+{
+
+    class ISequence;
+    class ISequenceBarrier;
+
+
+    /**
+     * Wait queues of the sequences advanced by IEventProcessors, so that the barriers gated on these sequences park on the queues of the sequences
+     * they depend on, and are only woken up by their direct upstream processors.
+     *
+     * A processor registers its sequence once and calls WaitQueue::wakeAll() on the returned queue after each update of the sequence.
+     * Lookups read a copy-on-write snapshot of the registrations; the replaced snapshots and the queues are kept until the registry is destroyed.
+     */
+    class WaiterRegistry
+    {
+    public:
+        WaiterRegistry();
+
+        WaiterRegistry(const WaiterRegistry&) = delete;
+        WaiterRegistry& operator=(const WaiterRegistry&) = delete;
+
+        /**
+         * Register a sequence advanced by an IEventProcessor. Registering the same sequence again returns the same queue.
+         *
+         * \param sequence the sequence of the IEventProcessor
+         * \returns the queue to wake after each update of the sequence
+         */
+        WaitQueue& registerSequence(const std::shared_ptr< ISequence >& sequence);
+
+        /**
+         * Wait for the dependent sequence to reach the given sequence. Parks on the queues of the sequences it is made of when they are all
+         * registered, busy spins otherwise.
+         *
+         * \param sequence sequence to be waited on
+         * \param dependentSequence a registered sequence, or a FixedSequenceGroup of registered sequences
+         * \param barrier barrier whose alert interrupts the wait, by throwing an AlertException
+         * \returns the value of the dependent sequence
+         */
+        std::int64_t waitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier);
+
+        /**
+         * Wait for the dependent sequence to reach the given sequence, reporting an alert of the barrier as SequenceWaitStatus::Alerted.
+         *
+         * \param sequence sequence to be waited on
+         * \param dependentSequence a registered sequence, or a FixedSequenceGroup of registered sequences
+         * \param barrier barrier whose alert interrupts the wait
+         * \returns the value of the dependent sequence, or SequenceWaitStatus::Alerted
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier);
+
+        /**
+         * Wait for the dependent sequence to reach the given sequence, reporting an alert of the barrier as SequenceWaitStatus::Alerted and a park
+         * which times out as SequenceWaitStatus::TimedOut.
+         *
+         * \param sequence sequence to be waited on
+         * \param dependentSequence a registered sequence, or a FixedSequenceGroup of registered sequences
+         * \param barrier barrier whose alert interrupts the wait
+         * \param timeout the maximum duration of a single park, shared by the parks on the members of a FixedSequenceGroup
+         * \returns the value of the dependent sequence, SequenceWaitStatus::Alerted or SequenceWaitStatus::TimedOut
+         */
+        SequenceWaitResult tryWaitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier, ClockConfig::Duration timeout);
+
+        /**
+         * Wake all the threads parked on the queues of the registered sequences, e.g. to let them observe an alert.
+         */
+        void wakeAll();
+
+    private:
+        struct Registration
+        {
+            const ISequence* sequence;
+            std::weak_ptr< ISequence > owner;
+            WaitQueue* queue;
+        };
+
+        using Registrations = std::vector< Registration >;
+
+        SequenceWaitResult tryWaitFor(std::int64_t sequence, ISequence& dependentSequence, ISequenceBarrier& barrier, const ClockConfig::Duration* timeout);
+
+        bool allRegistered(const Registrations& registrations, const std::vector< std::shared_ptr< ISequence > >& sequences) const;
+        WaitQueue* find(const Registrations& registrations, const ISequence& sequence) const;
+
+        std::atomic< const Registrations* > m_current;
+        std::mutex m_mutex;
+        std::vector< std::unique_ptr< Registrations > > m_snapshots;
+        std::vector< std::unique_ptr< WaitQueue > > m_queues;
+    };
+
+} // namespace Disruptor
@@ -5,7 +5,6 @@
 #include <limits>
 #include <memory>
 
-#include "Disruptor/AlertException.h"
 #include "Disruptor/IEventProcessor.h"
 #include "Disruptor/IEventReleaseAware.h"
 #include "Disruptor/IEventReleaser.h"
@@ -17,7 +16,8 @@
 #include "Disruptor/IWorkHandler.h"
 #include "Disruptor/RingBuffer.h"
 #include "Disruptor/Sequence.h"
-#include "Disruptor/TimeoutException.h"
+#include "Disruptor/SequenceWaitResult.h"
+#include "Disruptor/WaitQueue.h"
 
 
 namespace Disruptor
@@ -84,6 +84,9 @@ namespace Disruptor
             m_workSequence = workSequence;
 
             m_timeoutHandler = std::dynamic_pointer_cast< ITimeoutHandler >(m_workHandler);
+
+            // Barriers gated on this processor may park on its sequence
+            m_sequenceWaitQueue = m_sequenceBarrier->registerDependentSequence(m_sequence);
         }
 
         /**
@@ -132,44 +135,49 @@ namespace Disruptor
 
             while (true)
             {
-                try
+                if (processedSequence)
                 {
-                    if (processedSequence)
+                    processedSequence = false;
+                    do
                     {
-                        processedSequence = false;
-                        do
-                        {
-                            nextSequence = m_workSequence->value() + 1L;
-                            m_sequence->setValue(nextSequence - 1L);
-                        } while (!m_workSequence->compareAndSet(nextSequence - 1L, nextSequence));
-                    }
+                        nextSequence = m_workSequence->value() + 1L;
+                        m_sequence->setValue(nextSequence - 1L);
+                    } while (!m_workSequence->compareAndSet(nextSequence - 1L, nextSequence));
 
-                    if (cachedAvailableSequence >= nextSequence)
+                    signalSequenceWaiters();
+                }
+
+                if (cachedAvailableSequence >= nextSequence)
+                {
+                    try
                     {
                         eventRef = &(*m_ringBuffer)[nextSequence];
                         m_workHandler->onEvent(*eventRef);
-                        processedSequence = true;
                     }
-                    else
+                    catch (std::exception& ex)
                     {
-                        cachedAvailableSequence = m_sequenceBarrier->waitFor(nextSequence);
+                        m_exceptionHandler->handleEventException(ex, nextSequence, *eventRef);
                     }
+                    processedSequence = true;
                 }
-                catch (TimeoutException&)
-                {
-                    notifyTimeout(m_sequence->value());
-                }
-                catch (AlertException&)
+                else
                 {
-                    if (m_running == 0)
+                    // Alerts and timeouts are reported as a status, the exceptions are only used to report the failures of the handler
+                    auto result = m_sequenceBarrier->tryWaitFor(nextSequence);
+
+                    if (result.status == SequenceWaitStatus::Alerted)
                     {
-                        break;
+                        if (m_running == 0)
+                            break;
+                    }
+                    else if (result.status == SequenceWaitStatus::TimedOut)
+                    {
+                        notifyTimeout(m_sequence->value());
+                    }
+                    else
+                    {
+                        cachedAvailableSequence = result.sequence;
                     }
-                }
-                catch (std::exception& ex)
-                {
-                    m_exceptionHandler->handleEventException(ex, nextSequence, *eventRef);
-                    processedSequence = true;
                 }
             }
 
@@ -179,6 +187,12 @@ namespace Disruptor
         }
         
     private:
+        void signalSequenceWaiters()
+        {
+            if (m_sequenceWaitQueue != nullptr)
+                m_sequenceWaitQueue->wakeAll();
+        }
+
         void notifyTimeout(std::int64_t availableSequence)
         {
             try
@@ -226,6 +240,7 @@ namespace Disruptor
 
         std::atomic< std::int32_t > m_running {0};
         std::shared_ptr< Sequence > m_sequence = std::make_shared< Sequence >();
+        WaitQueue* m_sequenceWaitQueue = nullptr;
         std::shared_ptr< RingBuffer< T > > m_ringBuffer;
         std::shared_ptr< ISequenceBarrier > m_sequenceBarrier;
         std::shared_ptr< IWorkHandler< T > > m_workHandler;
@@ -248,7 +263,10 @@ namespace Disruptor
         {
             auto workProcessor = m_workProcessor.lock();
             if (workProcessor != nullptr)
+            {
                 workProcessor->sequence()->setValue(std::numeric_limits< std::int64_t >::max());
+                workProcessor->signalSequenceWaiters();
+            }
         }
 
         private:
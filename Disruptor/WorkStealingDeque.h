@@ -0,0 +1,194 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Disruptor/ArgumentException.h"
+#include "Disruptor/Util.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * Chase-Lev work-stealing deque of pointers: the owner thread pushes and pops at the bottom without contention, other threads steal from the top.
+     * The owner only synchronizes with the thieves when it takes the last item. The buffer grows when full, the replaced buffers are kept
+     * until the deque is destroyed because a thief may still be reading them.
+     *
+     * push() and pop() must only be called by the owner thread, steal() may be called by any thread. The deque does not own the items.
+     *
+     * \tparam T type of the items referenced by the deque
+     */
+    template <class T>
+    class WorkStealingDeque
+    {
+        class Buffer
+        {
+        public:
+            explicit Buffer(std::int64_t capacity)
+                : m_mask(capacity - 1)
+                , m_items(new std::atomic< T* >[static_cast< std::size_t >(capacity)])
+            {
+            }
+
+            std::int64_t capacity() const
+            {
+                return m_mask + 1;
+            }
+
+            T* get(std::int64_t index) const
+            {
+                return m_items[static_cast< std::size_t >(index & m_mask)].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t index, T* item)
+            {
+                m_items[static_cast< std::size_t >(index & m_mask)].store(item, std::memory_order_relaxed);
+            }
+
+        private:
+            std::int64_t m_mask;
+            std::unique_ptr< std::atomic< T* >[] > m_items;
+        };
+
+    public:
+        /**
+         * \param initialCapacity initial capacity of the deque, must be a power of 2
+         */
+        explicit WorkStealingDeque(std::int64_t initialCapacity = 64)
+        {
+            if (initialCapacity < 1 || !Util::isPowerOf2(static_cast< std::int32_t >(initialCapacity)))
+                DISRUPTOR_THROW_ARGUMENT_EXCEPTION("initialCapacity must be a power of 2");
+
+            m_buffers.push_back(std::make_unique< Buffer >(initialCapacity));
+            m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * Push an item at the bottom of the deque. Owner thread only.
+         */
+        void push(T* item)
+        {
+            auto bottom = m_bottom.load(std::memory_order_relaxed);
+            auto top = m_top.load(std::memory_order_acquire);
+            auto buffer = m_buffer.load(std::memory_order_relaxed);
+
+            if (bottom - top > buffer->capacity() - 1)
+                buffer = grow(buffer, top, bottom);
+
+            buffer->put(bottom, item);
+
+            // Publishes the item before the new bottom, pairs with the acquire load of m_bottom in steal()
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Pop the item most recently pushed. Owner thread only.
+         *
+         * \returns the item, nullptr if the deque is empty
+         */
+        T* pop()
+        {
+            auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            auto buffer = m_buffer.load(std::memory_order_relaxed);
+            m_bottom.store(bottom, std::memory_order_relaxed);
+
+            // Orders the reservation of the bottom item before the read of m_top, so that the owner and a thief cannot both take it
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            auto item = buffer->get(bottom);
+            if (top == bottom)
+            {
+                // Last item, races with the thieves
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    item = nullptr;
+
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return item;
+        }
+
+        /**
+         * Steal the oldest item of the deque. Any thread.
+         *
+         * \returns the item, nullptr if the deque is empty or if another thread took the item first
+         */
+        T* steal()
+        {
+            auto top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto bottom = m_bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+                return nullptr;
+
+            auto item = m_buffer.load(std::memory_order_acquire)->get(top);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+
+            return item;
+        }
+
+        /**
+         * Approximate number of items, exact when called by the owner thread while no thief is running.
+         */
+        std::int64_t size() const
+        {
+            auto bottom = m_bottom.load(std::memory_order_relaxed);
+            auto top = m_top.load(std::memory_order_relaxed);
+
+            return bottom > top ? bottom - top : 0;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /**
+         * Current capacity of the deque.
+         */
+        std::int64_t capacity() const
+        {
+            return m_buffer.load(std::memory_order_relaxed)->capacity();
+        }
+
+    private:
+        Buffer* grow(Buffer* buffer, std::int64_t top, std::int64_t bottom)
+        {
+            auto grown = std::make_unique< Buffer >(buffer->capacity() * 2);
+            for (auto i = top; i < bottom; ++i)
+            {
+                grown->put(i, buffer->get(i));
+            }
+
+            m_buffers.push_back(std::move(grown));
+            m_buffer.store(m_buffers.back().get(), std::memory_order_release);
+
+            return m_buffers.back().get();
+        }
+
+        char m_padding0[56] = {};
+        std::atomic< std::int64_t > m_top { 0 };
+        char m_padding1[56] = {};
+        std::atomic< std::int64_t > m_bottom { 0 };
+        char m_padding2[56] = {};
+        std::atomic< Buffer* > m_buffer { nullptr };
+        std::vector< std::unique_ptr< Buffer > > m_buffers;
+    };
+
+} // namespace Disruptor
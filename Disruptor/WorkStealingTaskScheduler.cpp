@@ -0,0 +1,307 @@
+#include "stdafx.h"
+#include "WorkStealingTaskScheduler.h"
+
+#include <thread>
+
+#include <boost/date_time.hpp>
+
+#include "ArgumentOutOfRangeException.h"
+
+
+namespace Disruptor
+{
+namespace
+{
+
+    // Number of times an idle thread looks for a task before parking
+    const std::int32_t maxIdleSpins = 64;
+
+    thread_local const WorkStealingTaskScheduler* currentScheduler = nullptr;
+    thread_local std::int32_t currentThreadId = -1;
+
+} // namespace
+
+
+    WorkStealingTaskScheduler::~WorkStealingTaskScheduler()
+    {
+        stop();
+        deletePendingTasks();
+    }
+
+    void WorkStealingTaskScheduler::start(std::int32_t numberOfThreads)
+    {
+        if (numberOfThreads < 1)
+            DISRUPTOR_THROW_ARGUMENT_OUT_OF_RANGE_EXCEPTION(numberOfThreads);
+
+        if (m_started.exchange(true))
+            return;
+
+        createThreads(numberOfThreads);
+    }
+
+    void WorkStealingTaskScheduler::stop()
+    {
+        if (!m_started.exchange(false))
+            return;
+
+        {
+            std::lock_guard< decltype(m_parkingMutex) > lock(m_parkingMutex);
+            m_parkingCondition.notify_all();
+        }
+
+        // No spare thread is started once the scheduler is stopped, the threads are joined without the lock held by a task starting one
+        std::vector< boost::thread > threads;
+        {
+            std::lock_guard< decltype(m_threadsMutex) > lock(m_threadsMutex);
+            threads.swap(m_threads);
+        }
+
+        for (auto&& thread : threads)
+        {
+            if (thread.joinable())
+                thread.timed_join(boost::posix_time::seconds(10));
+        }
+    }
+
+    std::future< void > WorkStealingTaskScheduler::scheduleAndStart(std::packaged_task< void() >&& task)
+    {
+        auto future = task.get_future();
+        auto pendingTask = new Task(std::move(task));
+
+        if (isWorkerThread())
+            m_workers[currentThreadId]->deque.push(pendingTask);
+        else
+            inject(pendingTask);
+
+        notifyParkedWorker();
+        startSpareThreadIfAllBusy();
+
+        return future;
+    }
+
+    bool WorkStealingTaskScheduler::isWorkerThread() const
+    {
+        return currentScheduler == this;
+    }
+
+    std::int32_t WorkStealingTaskScheduler::threadCount() const
+    {
+        return m_threadCount.load(std::memory_order_acquire);
+    }
+
+    void WorkStealingTaskScheduler::createThreads(std::int32_t numberOfThreads)
+    {
+        std::lock_guard< decltype(m_threadsMutex) > lock(m_threadsMutex);
+
+        // All the deques, including those of the spare threads, exist before the first thread starts stealing
+        for (auto i = 0; i < 2 * numberOfThreads; ++i)
+            m_workers.push_back(std::make_unique< Worker >());
+
+        for (auto i = 0; i < numberOfThreads; ++i)
+            startThread(i);
+    }
+
+    void WorkStealingTaskScheduler::startThread(std::int32_t threadId)
+    {
+        m_threads.emplace_back([this, threadId]() { workingLoop(threadId); });
+        m_threadCount.store(threadId + 1, std::memory_order_release);
+    }
+
+    void WorkStealingTaskScheduler::startSpareThreadIfAllBusy()
+    {
+        // A thread running a task only takes another one once its task returns, which an IEventProcessor never does until it is halted
+        if (m_busyWorkers.load(std::memory_order_relaxed) < m_threadCount.load(std::memory_order_relaxed))
+            return;
+
+        std::lock_guard< decltype(m_threadsMutex) > lock(m_threadsMutex);
+
+        auto threadCount = m_threadCount.load(std::memory_order_relaxed);
+        if (!m_started || threadCount == static_cast< std::int32_t >(m_workers.size()) || m_busyWorkers.load() < threadCount)
+            return;
+
+        startThread(threadCount);
+    }
+
+    void WorkStealingTaskScheduler::workingLoop(std::int32_t threadId)
+    {
+        currentScheduler = this;
+        currentThreadId = threadId;
+
+        auto idleSpins = 0;
+
+        while (m_started)
+        {
+            auto task = findTask(threadId);
+            if (task != nullptr)
+            {
+                idleSpins = 0;
+
+                // The last idle thread taking a task may leave queued tasks that no other thread would ever run
+                if (m_busyWorkers.fetch_add(1) + 1 >= m_threadCount.load(std::memory_order_relaxed))
+                {
+                    // Orders the busy count update before the task checks, pairs with the fence in notifyParkedWorker()
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    if (hasTasks())
+                        startSpareThreadIfAllBusy();
+                }
+
+                executeTask(task);
+                m_busyWorkers.fetch_sub(1);
+                continue;
+            }
+
+            if (++idleSpins < maxIdleSpins)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            idleSpins = 0;
+            park();
+        }
+
+        currentScheduler = nullptr;
+        currentThreadId = -1;
+    }
+
+    void WorkStealingTaskScheduler::inject(Task* task)
+    {
+        auto head = m_injectedTasks.load(std::memory_order_relaxed);
+        do
+        {
+            task->next = head;
+        } while (!m_injectedTasks.compare_exchange_weak(head, task, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    WorkStealingTaskScheduler::Task* WorkStealingTaskScheduler::findTask(std::int32_t threadId)
+    {
+        auto& worker = *m_workers[threadId];
+
+        auto task = worker.deque.pop();
+        if (task != nullptr)
+            return task;
+
+        task = drainInjectedTasks(worker);
+        if (task != nullptr)
+            return task;
+
+        return stealTask(threadId);
+    }
+
+    WorkStealingTaskScheduler::Task* WorkStealingTaskScheduler::drainInjectedTasks(Worker& worker)
+    {
+        if (m_injectedTasks.load(std::memory_order_relaxed) == nullptr)
+            return nullptr;
+
+        // Taking the whole stack at once leaves no room for ABA between the consumers
+        auto head = m_injectedTasks.exchange(nullptr, std::memory_order_acquire);
+        if (head == nullptr)
+            return nullptr;
+
+        // Restores the submission order, the stack holds the most recent task first
+        Task* oldest = nullptr;
+        while (head != nullptr)
+        {
+            auto next = head->next;
+            head->next = oldest;
+            oldest = head;
+            head = next;
+        }
+
+        auto remaining = oldest->next;
+        if (remaining == nullptr)
+            return oldest;
+
+        // The deque pops the most recent task first, so the tasks following the oldest one are pushed newest first
+        std::vector< Task* > tasks;
+        for (auto task = remaining; task != nullptr; task = task->next)
+            tasks.push_back(task);
+
+        for (auto it = tasks.rbegin(); it != tasks.rend(); ++it)
+            worker.deque.push(*it);
+
+        notifyParkedWorker();
+
+        return oldest;
+    }
+
+    WorkStealingTaskScheduler::Task* WorkStealingTaskScheduler::stealTask(std::int32_t threadId)
+    {
+        const auto workerCount = m_threadCount.load(std::memory_order_acquire);
+
+        for (auto i = 1; i < workerCount; ++i)
+        {
+            auto task = m_workers[(threadId + i) % workerCount]->deque.steal();
+            if (task != nullptr)
+                return task;
+        }
+
+        return nullptr;
+    }
+
+    bool WorkStealingTaskScheduler::hasTasks() const
+    {
+        if (m_injectedTasks.load(std::memory_order_relaxed) != nullptr)
+            return true;
+
+        for (auto&& worker : m_workers)
+        {
+            if (!worker->deque.empty())
+                return true;
+        }
+
+        return false;
+    }
+
+    void WorkStealingTaskScheduler::park()
+    {
+        std::unique_lock< decltype(m_parkingMutex) > lock(m_parkingMutex);
+
+        m_parkedWorkers.fetch_add(1);
+
+        // Orders the parked count update before the task checks, pairs with the fence in notifyParkedWorker()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_started && !hasTasks())
+            m_parkingCondition.wait(lock);
+
+        m_parkedWorkers.fetch_sub(1);
+    }
+
+    void WorkStealingTaskScheduler::notifyParkedWorker()
+    {
+        // Orders the task publication before the parked count read, pairs with the fence in park()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_parkedWorkers.load(std::memory_order_relaxed) == 0)
+            return;
+
+        std::lock_guard< decltype(m_parkingMutex) > lock(m_parkingMutex);
+        m_parkingCondition.notify_one();
+    }
+
+    void WorkStealingTaskScheduler::executeTask(Task* task)
+    {
+        std::unique_ptr< Task > ownedTask(task);
+        ownedTask->work();
+    }
+
+    void WorkStealingTaskScheduler::deletePendingTasks()
+    {
+        for (auto&& worker : m_workers)
+        {
+            while (auto task = worker->deque.steal())
+                delete task;
+        }
+
+        auto head = m_injectedTasks.exchange(nullptr);
+        while (head != nullptr)
+        {
+            auto next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+} // namespace Disruptor
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include "Disruptor/ITaskScheduler.h"
+#include "Disruptor/WorkStealingDeque.h"
+
+
+namespace Disruptor
+{
+
+    /**
+     * An implementation of TaskScheduler where each thread of the pool owns a work-stealing deque, and idle threads steal the tasks of the busy ones.
+     *
+     * Tasks scheduled from a thread of the pool, e.g. fan-out jobs produced by an IWorkHandler<T> run by the pool, are pushed on the deque of that thread
+     * without contention. Tasks scheduled from other threads go through a lock-free injection stack, drained in batches by the threads of the pool.
+     * Idle threads park on a condition variable, which is only notified when a thread is parked.
+     *
+     * Like the other schedulers, a task runs to completion on the thread which took it: an IEventProcessor keeps its thread until it is halted.
+     * When a task is scheduled while every thread of the pool is running a task, e.g. one IEventProcessor per thread producing fan-out jobs, a spare
+     * thread is started to run it, up to as many spare threads as the number of threads given to start(). The spare threads are kept until stop().
+     */
+    class WorkStealingTaskScheduler : public ITaskScheduler
+    {
+        struct Task
+        {
+            explicit Task(std::packaged_task< void() >&& work)
+                : work(std::move(work))
+            {
+            }
+
+            std::packaged_task< void() > work;
+            Task* next = nullptr;
+        };
+
+        struct Worker
+        {
+            WorkStealingDeque< Task > deque;
+        };
+
+    public:
+        WorkStealingTaskScheduler() = default;
+        ~WorkStealingTaskScheduler() override;
+
+        void start(std::int32_t numberOfThreads) override;
+        void stop() override;
+
+        /**
+         * Schedule a task. Called from a thread of this scheduler, the task is pushed on the deque of that thread.
+         *
+         * \param task the task to run
+         * \returns the future of the task
+         */
+        std::future< void > scheduleAndStart(std::packaged_task< void() >&& task) override;
+
+        /**
+         * Returns true if the calling thread is a thread of this scheduler.
+         */
+        bool isWorkerThread() const;
+
+        /**
+         * Number of threads of the pool, including the spare threads started since start().
+         */
+        std::int32_t threadCount() const;
+
+    private:
+        void createThreads(std::int32_t numberOfThreads);
+        void startThread(std::int32_t threadId);
+        void startSpareThreadIfAllBusy();
+        void workingLoop(std::int32_t threadId);
+
+        void inject(Task* task);
+        Task* findTask(std::int32_t threadId);
+        Task* drainInjectedTasks(Worker& worker);
+        Task* stealTask(std::int32_t threadId);
+        bool hasTasks() const;
+
+        void park();
+        void notifyParkedWorker();
+
+        static void executeTask(Task* task);
+        void deletePendingTasks();
+
+        std::atomic< bool > m_started { false };
+        std::vector< std::unique_ptr< Worker > > m_workers;
+        std::vector< boost::thread > m_threads;
+        std::mutex m_threadsMutex;
+        std::atomic< std::int32_t > m_threadCount { 0 };
+        std::atomic< std::int32_t > m_busyWorkers { 0 };
+
+        std::atomic< Task* > m_injectedTasks { nullptr };
+
+        std::mutex m_parkingMutex;
+        std::condition_variable m_parkingCondition;
+        std::atomic< std::int32_t > m_parkedWorkers { 0 };
+    };
+
+} // namespace Disruptor
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <thread>
+
+#include "Disruptor/ISequence.h"
+#include "Disruptor/ISequenceBarrier.h"
 #include "Disruptor/IWaitStrategy.h"
+#include "Disruptor/Sequence.h"
 
 namespace Disruptor
 {
@@ -23,16 +28,43 @@ namespace Disruptor
          * \returns the sequence that is available which may be greater than the requested sequence.
          */ 
         std::int64_t waitFor(std::int64_t sequence,
-                             Sequence& cursor,
+                             Sequence& /*cursor*/,
                              ISequence& dependentSequence,
-                             ISequenceBarrier& barrier) override;
+                             ISequenceBarrier& barrier) override
+        {
+            std::int64_t availableSequence;
+            auto counter = m_spinTries;
+
+            while ((availableSequence = dependentSequence.value()) < sequence)
+            {
+                counter = applyWaitMethod(barrier, counter);
+            }
+
+            return availableSequence;
+        }
 
         /**
          * Signal those IEventProcessor waiting that the cursor has advanced.
          */ 
-        void signalAllWhenBlocking() override;
+        void signalAllWhenBlocking() override
+        {
+        }
+
+        static std::int32_t applyWaitMethod(ISequenceBarrier& barrier, std::int32_t counter)
+        {
+            barrier.checkAlert();
+
+            if (counter == 0)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                --counter;
+            }
 
-        static std::int32_t applyWaitMethod(ISequenceBarrier& barrier, std::int32_t counter);
+            return counter;
+        }
 
         void writeDescriptionTo(std::ostream& stream) const override;
 